@@ -0,0 +1,97 @@
+#include "arena.h"
+#include "app_util_platform.h"
+#include "log.h"
+
+static uint32_t arena_pool[ARENA_SIZE / 4];
+
+static arena_phase_t arena_owner = ARENA_PHASE_NONE;
+static uint16_t      arena_used  = 0;
+static uint16_t      high_water  = 0;
+static uint16_t      conflicts   = 0;
+
+/** Phases currently refused, so a phase polling in TaskWait is counted once */
+static uint32_t waiting_mask = 0;
+
+bool arena_begin(arena_phase_t phase)
+{
+    bool          owned   = false;
+    arena_phase_t blocker = ARENA_PHASE_NONE;
+
+    CRITICAL_REGION_ENTER();
+    if (arena_owner == ARENA_PHASE_NONE || arena_owner == phase)
+    {
+        arena_owner = phase;
+        waiting_mask &= ~(1UL << phase);
+        owned = true;
+    }
+    else if (!(waiting_mask & (1UL << phase)))
+    {
+        waiting_mask |= (1UL << phase);
+        conflicts += 1;
+        blocker = arena_owner;
+    }
+    CRITICAL_REGION_EXIT();
+
+    if (blocker != ARENA_PHASE_NONE)
+    {
+        dlog_w(HISTORY, "arena: phase %d waits for phase %d\n", phase, blocker);
+    }
+
+    return owned;
+}
+
+void *arena_alloc(arena_phase_t phase, uint16_t size)
+{
+    void *ptr = NULL;
+
+    size = (size + 3) & ~3;
+
+    CRITICAL_REGION_ENTER();
+    if (arena_owner == phase && arena_used + size <= ARENA_SIZE)
+    {
+        ptr = (uint8_t *)arena_pool + arena_used;
+        arena_used += size;
+        if (arena_used > high_water)
+        {
+            high_water = arena_used;
+        }
+    }
+    CRITICAL_REGION_EXIT();
+
+    if (ptr == NULL)
+    {
+        dlog_e(HISTORY, "arena: alloc %d for phase %d failed, owner %d used %d\n", size, phase, arena_owner, arena_used);
+    }
+    return ptr;
+}
+
+void arena_end(arena_phase_t phase)
+{
+    uint16_t used = 0;
+
+    CRITICAL_REGION_ENTER();
+    if (arena_owner == phase)
+    {
+        used        = arena_used;
+        arena_owner = ARENA_PHASE_NONE;
+        arena_used  = 0;
+    }
+    CRITICAL_REGION_EXIT();
+
+    dlog_d(HISTORY, "arena: phase %d released %d bytes, high water %d/%d\n", phase, used, high_water, ARENA_SIZE);
+}
+
+arena_phase_t arena_get_phase(void)
+{
+    return arena_owner;
+}
+
+uint16_t arena_get_high_water(void)
+{
+    return high_water;
+}
+
+uint16_t arena_get_conflicts(void)
+{
+    return conflicts;
+}
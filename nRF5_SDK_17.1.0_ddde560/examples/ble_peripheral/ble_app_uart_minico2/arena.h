@@ -0,0 +1,56 @@
+#ifndef __ARENA_H__
+#define __ARENA_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * Scratch memory shared by subsystems that are never live at the same time.
+ * One phase owns the arena at a time and allocates from it with a bump
+ * pointer; ending the phase releases everything it allocated.
+ */
+
+/** Size of the pool in bytes, each phase allocates one record_page_t (checked in history.c) */
+#define ARENA_SIZE (256)
+
+/** Phases, mutually exclusive users of the arena */
+typedef enum
+{
+    ARENA_PHASE_NONE = 0,
+    ARENA_PHASE_HISTORY_RECOVER, // boot time history recovery
+    ARENA_PHASE_HISTORY_UPLOAD,  // history page upload
+    ARENA_PHASE_FAKE_RECORDS,    // fake record population (test command)
+    ARENA_PHASE_COUNT,
+} arena_phase_t;
+
+/**
+ * @brief Take the arena for a phase
+ *
+ * @param phase Phase taking the arena
+ * @return true The phase owns the arena (also when it already owned it)
+ * @return false Another phase owns the arena, the overlap is counted
+ */
+bool arena_begin(arena_phase_t phase);
+
+/**
+ * @brief Allocate from the arena, 4-byte aligned
+ *
+ * @param phase Phase owning the arena
+ * @param size Number of bytes
+ * @return void* NULL when the phase does not own the arena or the pool is exhausted
+ */
+void *arena_alloc(arena_phase_t phase, uint16_t size);
+
+/** Release the arena and everything the phase allocated */
+void arena_end(arena_phase_t phase);
+
+/** Phase owning the arena, ARENA_PHASE_NONE when free */
+arena_phase_t arena_get_phase(void);
+
+/** Highest number of bytes allocated by any phase since boot */
+uint16_t arena_get_high_water(void);
+
+/** Number of times a phase found the arena owned by another phase */
+uint16_t arena_get_conflicts(void);
+
+#endif // __ARENA_H__
@@ -0,0 +1,208 @@
+#include "energy.h"
+#include "app_timer.h"
+#include "app_util_platform.h"
+#include "battery.h"
+#include "log.h"
+#include <string.h>
+
+/** Frequency of the RTC1 counter behind app_timer */
+#define ENERGY_RTC_HZ (APP_TIMER_CLOCK_FREQ / (APP_TIMER_CONFIG_RTC_FREQUENCY + 1))
+
+/** Active time per consumer in RTC ticks */
+static uint64_t active_ticks[ENERGY_CONSUMER_COUNT] = {0};
+
+/** RTC counter value at the moment a consumer became active (or was last folded) */
+static uint32_t start_tick[ENERGY_CONSUMER_COUNT] = {0};
+
+/** Fraction of a tick left over by energy_add_us(), in 1/1000000 ticks */
+static uint32_t add_rem[ENERGY_CONSUMER_COUNT] = {0};
+
+/** Bit mask of active consumers */
+static uint32_t active_mask = 0;
+
+/** Time covered by the ledger in RTC ticks */
+static uint64_t uptime_ticks = 0;
+static uint32_t uptime_fold  = 0;
+
+/** Current model in uA while the consumer is active, typical datasheet values at 3.7 V */
+static uint32_t current_ua[ENERGY_CONSUMER_COUNT] = {
+    [ENERGY_CPU]           = 3000,
+    [ENERGY_SCD4X_IDLE]    = 200,
+    [ENERGY_SCD4X_MEAS]    = 15000,
+    [ENERGY_SCD4X_LP_MEAS] = 450,
+    [ENERGY_TWI]           = 500,
+    [ENERGY_LCD_ON]        = 40,
+    [ENERGY_LCD_REFRESH]   = 1500,
+    [ENERGY_FLASH]         = 8000,
+    [ENERGY_BLE_ADV]       = 150,
+    [ENERGY_BLE_CONN]      = 250,
+    [ENERGY_BUZZER]        = 20000,
+    [ENERGY_VIBRATOR]      = 60000,
+    [ENERGY_LCD_HPM]       = 60,
+};
+
+static uint32_t base_ua      = ENERGY_BASE_CURRENT_UA;
+static uint32_t capacity_mah = ENERGY_BATTERY_CAPACITY_MAH;
+
+void energy_init(void)
+{
+    uint32_t now = app_timer_cnt_get();
+
+    memset(active_ticks, 0, sizeof(active_ticks));
+    memset(add_rem, 0, sizeof(add_rem));
+    active_mask  = 0;
+    uptime_ticks = 0;
+    uptime_fold  = now;
+
+    // the CPU is running when we get here
+    energy_begin(ENERGY_CPU);
+}
+
+void energy_begin(energy_consumer_t consumer)
+{
+    CRITICAL_REGION_ENTER();
+    if (!(active_mask & (1UL << consumer)))
+    {
+        start_tick[consumer] = app_timer_cnt_get();
+        active_mask |= (1UL << consumer);
+    }
+    CRITICAL_REGION_EXIT();
+}
+
+void energy_end(energy_consumer_t consumer)
+{
+    CRITICAL_REGION_ENTER();
+    if (active_mask & (1UL << consumer))
+    {
+        active_ticks[consumer] += app_timer_cnt_diff_compute(app_timer_cnt_get(), start_tick[consumer]);
+        active_mask &= ~(1UL << consumer);
+    }
+    CRITICAL_REGION_EXIT();
+}
+
+void energy_set(energy_consumer_t consumer, bool active)
+{
+    if (active)
+    {
+        energy_begin(consumer);
+    }
+    else
+    {
+        energy_end(consumer);
+    }
+}
+
+void energy_add_us(energy_consumer_t consumer, uint32_t us)
+{
+    uint64_t scaled;
+
+    // a page program is 11.5 ticks, carry the fraction instead of dropping it on every call
+    CRITICAL_REGION_ENTER();
+    scaled = (uint64_t)us * ENERGY_RTC_HZ + add_rem[consumer];
+    active_ticks[consumer] += scaled / 1000000;
+    add_rem[consumer] = (uint32_t)(scaled % 1000000);
+    CRITICAL_REGION_EXIT();
+}
+
+/**
+ * The RTC counter is 24 bits wide and wraps every 1024 s, so consumers that stay
+ * active longer than that (sensor, panel, radio) are folded into the ledger here.
+ */
+void energy_tick_second(void)
+{
+    CRITICAL_REGION_ENTER();
+    uint32_t now = app_timer_cnt_get();
+
+    uptime_ticks += app_timer_cnt_diff_compute(now, uptime_fold);
+    uptime_fold = now;
+
+    for (uint8_t i = 0; i < ENERGY_CONSUMER_COUNT; i++)
+    {
+        if (active_mask & (1UL << i))
+        {
+            active_ticks[i] += app_timer_cnt_diff_compute(now, start_tick[i]);
+            start_tick[i] = now;
+        }
+    }
+    CRITICAL_REGION_EXIT();
+}
+
+uint8_t energy_set_model(uint8_t index, uint32_t value)
+{
+    if (index == ENERGY_MODEL_BASE)
+    {
+        base_ua = value;
+    }
+    else if (index == ENERGY_MODEL_CAPACITY)
+    {
+        capacity_mah = value;
+    }
+    else if (index < ENERGY_CONSUMER_COUNT)
+    {
+        current_ua[index] = value;
+    }
+    else
+    {
+        return 1;
+    }
+
+    print("energy model %d set to %d\n", index, value);
+    return 0;
+}
+
+energy_entry_t energy_get_entry(energy_consumer_t consumer)
+{
+    energy_entry_t entry;
+    uint64_t       ticks;
+
+    CRITICAL_REGION_ENTER();
+    ticks = active_ticks[consumer];
+    CRITICAL_REGION_EXIT();
+
+    entry.active_10ms = (uint32_t)(ticks * 100 / ENERGY_RTC_HZ);
+    entry.charge_uah  = (uint32_t)(ticks * current_ua[consumer] / ENERGY_RTC_HZ / 3600);
+    return entry;
+}
+
+uint32_t energy_get_uptime_s(void)
+{
+    uint64_t ticks;
+
+    // 64 bits, not read in one access
+    CRITICAL_REGION_ENTER();
+    ticks = uptime_ticks;
+    CRITICAL_REGION_EXIT();
+
+    return (uint32_t)(ticks / ENERGY_RTC_HZ);
+}
+
+uint32_t energy_get_average_ua(void)
+{
+    uint64_t charge = 0; // uA * RTC ticks
+    uint64_t ticks;
+
+    CRITICAL_REGION_ENTER();
+    ticks = uptime_ticks;
+    for (uint8_t i = 0; i < ENERGY_CONSUMER_COUNT; i++)
+    {
+        charge += active_ticks[i] * current_ua[i];
+    }
+    CRITICAL_REGION_EXIT();
+
+    if (ticks == 0) return base_ua;
+    return base_ua + (uint32_t)(charge / ticks);
+}
+
+uint16_t energy_get_remaining_hours(void)
+{
+    uint32_t avg_ua = energy_get_average_ua();
+    uint64_t remaining_uah;
+    uint64_t hours;
+
+    if (avg_ua == 0) return 0xFFFF;
+
+    // the capacity comes from CMD_SET_ENERGY_MODEL, any 32 bit value
+    remaining_uah = (uint64_t)capacity_mah * 10 * get_battery_level(); // mAh * 1000 * level / 100
+    hours         = remaining_uah / avg_ua;
+    return hours > 0xFFFF ? 0xFFFF : (uint16_t)hours;
+}
@@ -0,0 +1,87 @@
+#ifndef __ENERGY_H__
+#define __ENERGY_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * Energy consumers tracked by the ledger.
+ * Each consumer accumulates the time it was active; the charge is that time
+ * multiplied by the consumer's current from the model below.
+ */
+typedef enum
+{
+    ENERGY_CPU = 0,       // CPU running (outside nrf_pwr_mgmt_run)
+    ENERGY_SCD4X_IDLE,    // SCD4x powered
+    ENERGY_SCD4X_MEAS,    // SCD4x periodic or single shot measurement running (on top of idle)
+    ENERGY_SCD4X_LP_MEAS, // SCD4x low power periodic measurement running (on top of idle)
+    ENERGY_TWI,           // TWI transfer to the SCD4x
+    ENERGY_LCD_ON,        // ST7301 powered
+    ENERGY_LCD_REFRESH,   // SPI transfer to the ST7301
+    ENERGY_FLASH,         // external flash program / erase
+    ENERGY_BLE_ADV,       // advertising
+    ENERGY_BLE_CONN,      // connected
+    ENERGY_BUZZER,        // buzzer driven
+    ENERGY_VIBRATOR,      // vibrator driven
+    ENERGY_LCD_HPM,       // ST7301 in high power mode (on top of ENERGY_LCD_ON, the rest of the on time is low power mode)
+    ENERGY_CONSUMER_COUNT,
+} energy_consumer_t;
+
+/** Nominal cell capacity used by the runtime estimator */
+#define ENERGY_BATTERY_CAPACITY_MAH 500
+
+/** Sleep current of the whole board (System ON idle + RTC + regulators), uA */
+#define ENERGY_BASE_CURRENT_UA 8
+
+/** Model index used by energy_set_model() for the base current */
+#define ENERGY_MODEL_BASE     0xFE
+/** Model index used by energy_set_model() for the battery capacity (mAh) */
+#define ENERGY_MODEL_CAPACITY 0xFF
+
+/** Ledger snapshot of a single consumer */
+typedef struct
+{
+    uint32_t active_10ms; // active time in 10 ms units
+    uint32_t charge_uah;  // consumed charge in uAh
+} energy_entry_t;
+
+/** Initialize the ledger, called once at startup */
+void energy_init(void);
+
+/** Mark a consumer as active, nested calls are ignored */
+void energy_begin(energy_consumer_t consumer);
+
+/** Mark a consumer as inactive, calls on an inactive consumer are ignored */
+void energy_end(energy_consumer_t consumer);
+
+/** Begin or end a consumer according to its current state */
+void energy_set(energy_consumer_t consumer, bool active);
+
+/** Add a fixed active time to a consumer, for operations that complete in the background */
+void energy_add_us(energy_consumer_t consumer, uint32_t us);
+
+/** Fold running consumers into the ledger, called once per second from the scheduler tick */
+void energy_tick_second(void);
+
+/**
+ * @brief Set one entry of the current model
+ *
+ * @param index Consumer index, ENERGY_MODEL_BASE or ENERGY_MODEL_CAPACITY
+ * @param value Current in uA, or capacity in mAh
+ * @return uint8_t 0 on success, 1 for an invalid index
+ */
+uint8_t energy_set_model(uint8_t index, uint32_t value);
+
+/** Get the ledger entry of a consumer */
+energy_entry_t energy_get_entry(energy_consumer_t consumer);
+
+/** Get the time covered by the ledger in seconds */
+uint32_t energy_get_uptime_s(void);
+
+/** Get the average current since startup in uA, base current included */
+uint32_t energy_get_average_ua(void);
+
+/** Estimate the remaining runtime in hours from the battery level and the average current */
+uint16_t energy_get_remaining_hours(void);
+
+#endif // __ENERGY_H__
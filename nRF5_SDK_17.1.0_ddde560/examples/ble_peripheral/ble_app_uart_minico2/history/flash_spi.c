@@ -1,4 +1,11 @@
 #include "flash_spi.h"
+#include "energy.h"
+#include "trace.h"
+
+/** Typical ZB25D16 program/erase times, the operations complete in the background */
+#define FLASH_PAGE_PROGRAM_US (700)
+#define FLASH_SECTOR_ERASE_US (45000)
+#define FLASH_CHIP_ERASE_US   (8000000)
 
 static zb25d16_handle_t zb_handle;
 
@@ -110,6 +117,7 @@ uint8_t flash_read_data(uint32_t addr, uint8_t *buf, uint16_t len)
  */
 uint8_t flash_write_data(uint32_t addr, uint8_t *buf, uint16_t len)
 {
+    energy_add_us(ENERGY_FLASH, FLASH_PAGE_PROGRAM_US);
     return zb25d16_single_page_write(&zb_handle, addr, buf, len);
 }
 
@@ -118,6 +126,8 @@ uint8_t flash_erase_data_sector(uint16_t sector)
 {
     uint8_t ret;
     ret = zb25d16_erase_sector(&zb_handle, sector);
+    trace_add(TRACE_EVT_FLASH_ERASE, ret, sector);
+    energy_add_us(ENERGY_FLASH, FLASH_SECTOR_ERASE_US);
     return ret;
 }
 
@@ -126,6 +136,7 @@ uint8_t flash_erase_chip(void)
 {
     uint8_t ret;
     ret = zb25d16_erase_chip(&zb_handle);
+    energy_add_us(ENERGY_FLASH, FLASH_CHIP_ERASE_US);
     return ret;
 }
 
@@ -1,12 +1,14 @@
 #include "history.h"
 
+// the history phases take the arena for one page buffer each
+STATIC_ASSERT(sizeof(record_page_t) <= ARENA_SIZE);
+
 // Add the declaration at the top of the file after includes
-extern void update_co2_history(uint16_t new_value);
+extern void     update_co2_history(uint16_t new_value);
+extern uint16_t co2_history[CO2_HISTORY_LEN];
 
 typedef uint8_t (*flash_op_func)(uint32_t addr, uint8_t *buf, uint16_t len);
 
-uint8_t sector_data_buffer[FLASH_SECTOR_SIZE] = {0};
-
 // Define circular buffer structure
 #define BUFFER_SIZE RECORDS_PER_PAGE
 typedef struct
@@ -146,7 +148,7 @@ uint8_t flash_write_data_(uint32_t addr, uint8_t *buf, uint16_t len)
 
 TaskDefine(task_history_recover)
 {
-    static record_page_t rec_page;
+    static record_page_t *rec_page;
     static uint32_t      latest_ts    = 0;
     static uint16_t      found_synced = 0;
     static uint32_t      timestamp    = 0;
@@ -154,12 +156,21 @@ TaskDefine(task_history_recover)
     static uint16_t      sector, page;
     static uint8_t       found_readings = 0;
     static store_area_t  read_area;
-    extern uint16_t      co2_history[BAR_COUNT];
 
     TTS
     {
         print("Recover history\n");
 
+        TaskWait(arena_begin(ARENA_PHASE_HISTORY_RECOVER), TICK_MAX);
+        rec_page = arena_alloc(ARENA_PHASE_HISTORY_RECOVER, sizeof(record_page_t));
+        if (rec_page == NULL)
+        {
+            // retry, writing before the current page is known would overwrite history
+            arena_end(ARENA_PHASE_HISTORY_RECOVER);
+            TaskDelay(100 / TICK_RATE_MS);
+            TaskResetThis();
+        }
+
         for (sector = 0; sector < FLASH_SECTOR_COUNT; sector++)
         {
             for (page = 0; page < FLASH_PAGE_OF_SECTOR; page++)
@@ -168,15 +179,15 @@ TaskDefine(task_history_recover)
                 area.page   = page;
 
                 ACQUIRE_SPI();
-                flash_read_data_(GET_HIS_ADDR(&area), rec_page.buf, HISTORY_SIZE);
+                flash_read_data_(GET_HIS_ADDR(&area), rec_page->buf, HISTORY_SIZE);
                 RELEASE_SPI();
 
-                if (!is_page_valid(&rec_page))
+                if (!is_page_valid(rec_page))
                 {
                     continue;
                 }
 
-                timestamp = get_last_record(&rec_page, true).timestamp;
+                timestamp = get_last_record(rec_page, true).timestamp;
 
                 // print("sector %d page %d, end_timestamp: %8X\n", area.sector, area.page, timestamp);
 
@@ -194,7 +205,7 @@ TaskDefine(task_history_recover)
 
                     latest_ts            = timestamp;
                     cur_store_area       = area;
-                    cur_store_area.count = get_record_count(&rec_page);
+                    cur_store_area.count = get_record_count(rec_page);
                 }
             }
         }
@@ -211,7 +222,7 @@ TaskDefine(task_history_recover)
             cur_store_area = get_next_store_area(&cur_store_area);
         }
 
-        integrity_check_timestamp = rec_page.records[cur_store_area.count - 1].timestamp;
+        integrity_check_timestamp = rec_page->records[cur_store_area.count - 1].timestamp;
 
         print("Integrity check timestamp: %u\n", integrity_check_timestamp);
 
@@ -222,23 +233,23 @@ TaskDefine(task_history_recover)
         read_area      = cur_store_area;
 
         // we can have one value already in the co2_history
-        // if so assign it to old_value and now we will only need BAR_COUNT - 1 readings
+        // if so assign it to old_value and now we will only need CO2_HISTORY_LEN - 1 readings
         if (co2_history[0] != 0)
         {
             found_readings = 1;
         }
 
-        // Read pages in reverse order until we have BAR_COUNT readings or hit a blank page
+        // Read pages in reverse order until we have CO2_HISTORY_LEN readings or hit a blank page
 
-        while (found_readings < BAR_COUNT)
+        while (found_readings < CO2_HISTORY_LEN)
         {
             ACQUIRE_SPI();
-            flash_read_data_(GET_HIS_ADDR(&read_area), rec_page.buf, HISTORY_SIZE);
+            flash_read_data_(GET_HIS_ADDR(&read_area), rec_page->buf, HISTORY_SIZE);
             RELEASE_SPI();
 
-            log_hex_dump("rec_page", rec_page.buf, HISTORY_SIZE);
+            dlog_hex(HISTORY, DLOG_LEVEL_DEBUG, "rec_page", rec_page->buf, HISTORY_SIZE);
 
-            if (!is_page_valid(&rec_page))
+            if (!is_page_valid(rec_page))
             {
                 break;
             }
@@ -246,13 +257,13 @@ TaskDefine(task_history_recover)
             // Read records in reverse to preserve time order
             for (int i = RECORDS_PER_PAGE - 1 - found_readings; i >= 0; i--)
             {
-                if (rec_page.records[i].type == RECORD_TYPE_CO2)
+                if (rec_page->records[i].type == RECORD_TYPE_CO2)
                 {
-                    print("CO2 value: %d\n", SWAP_ENDIAN16(rec_page.records[i].value));
-                    co2_history[found_readings] = SWAP_ENDIAN16(rec_page.records[i].value);
+                    dlog_d(HISTORY, "CO2 value: %d\n", SWAP_ENDIAN16(rec_page->records[i].value));
+                    co2_history[found_readings] = SWAP_ENDIAN16(rec_page->records[i].value);
                     found_readings++;
 
-                    if (found_readings == BAR_COUNT)
+                    if (found_readings == CO2_HISTORY_LEN)
                     {
                         break;
                     }
@@ -269,13 +280,15 @@ TaskDefine(task_history_recover)
 
         // debug print the co2_history
         print("CO2 history: \n");
-        for (int i = 0; i < BAR_COUNT; i++)
+        for (int i = 0; i < CO2_HISTORY_LEN; i++)
         {
             print("%d, ", co2_history[i]);
         }
         print("\n");
 
         print("Recovered %d CO2 readings from history\n", found_readings);
+
+        arena_end(ARENA_PHASE_HISTORY_RECOVER);
     }
     TTE
 }
@@ -427,7 +440,7 @@ TaskDefine(task_history_storage)
 TaskDefine(task_populate_fake_records)
 {
     static record_t      fake_record      = {0};
-    static record_page_t fake_record_page = {0};
+    static record_page_t *fake_record_page;
     static uint16_t      sector;
     static uint32_t      write_address = 0;
     static uint32_t      timestamp     = 0;
@@ -445,6 +458,16 @@ TaskDefine(task_populate_fake_records)
         TaskWait(EventGroupCheckBits(event_group_system, EVT_POPULATE_FAKE_DATA), TICK_MAX);
         print("Task: Populate Fake Records started.\n");
 
+        TaskWait(arena_begin(ARENA_PHASE_FAKE_RECORDS), TICK_MAX);
+        fake_record_page = arena_alloc(ARENA_PHASE_FAKE_RECORDS, sizeof(record_page_t));
+        if (fake_record_page == NULL)
+        {
+            arena_end(ARENA_PHASE_FAKE_RECORDS);
+            EventGroupClearBits(event_group_system, EVT_POPULATE_FAKE_DATA);
+            TaskResetThis();
+        }
+        memset(fake_record_page, 0, sizeof(record_page_t));
+
         // Step 1: Erase the flash
         print("Step 1: Erasing Flash sectors.\n");
 
@@ -485,7 +508,7 @@ TaskDefine(task_populate_fake_records)
                 fake_record.type                  = RECORD_TYPE_CO2;
                 fake_record.value                 = SWAP_ENDIAN16(value);
                 fake_record.reserved              = 0;
-                fake_record_page.records[rec_idx] = fake_record;
+                fake_record_page->records[rec_idx] = fake_record;
 
                 // increment the timestamp by 60 seconds for each record so that we have total of (7 days * 24 hours * 60 minutes * 60 seconds) / 60 = 10080 records
                 timestamp += 60;
@@ -495,12 +518,12 @@ TaskDefine(task_populate_fake_records)
             write_address = GET_HIS_ADDR(&cur_store_area);
 
             ACQUIRE_SPI();
-            flash_write_data_(write_address, (uint8_t *)&fake_record_page, HISTORY_SIZE);
+            flash_write_data_(write_address, (uint8_t *)fake_record_page, HISTORY_SIZE);
             RELEASE_SPI();
 
             // verify the page is written correctly
             ACQUIRE_SPI();
-            flash_read_data_(write_address, fake_record_page.buf, HISTORY_SIZE);
+            flash_read_data_(write_address, fake_record_page->buf, HISTORY_SIZE);
             TaskWait(!flash_get_busy_state(), TICK_MAX);
             RELEASE_SPI();
 
@@ -517,11 +540,12 @@ TaskDefine(task_populate_fake_records)
                 print("Next storage area: sector=%d, page=%d\n", cur_store_area.sector, cur_store_area.page);
             }
 
-            memset(&fake_record_page, 0, sizeof(record_page_t));
+            memset(fake_record_page, 0, sizeof(record_page_t));
         }
 
         print("Step 3: Flash population complete. Total pages written: %d\n", 312);
         print("Task: Populate Fake Records completed.\n");
+        arena_end(ARENA_PHASE_FAKE_RECORDS);
         send_populate_done();
 
         EventGroupClearBits(event_group_system, EVT_POPULATE_FAKE_DATA);
@@ -601,7 +625,7 @@ void add_record(uint16_t value, record_type_t type)
 
 TaskDefine(task_history_upload)
 {
-    static record_page_t record_page = {0xFF};
+    static record_page_t *record_page;
     static store_area_t  tx_store_area;
     static uint32_t      read_address = 0;
 
@@ -632,6 +656,16 @@ TaskDefine(task_history_upload)
 
             read_address = GET_HIS_ADDR(&tx_store_area);
 
+            TaskWait(arena_begin(ARENA_PHASE_HISTORY_UPLOAD), TICK_MAX);
+            record_page = arena_alloc(ARENA_PHASE_HISTORY_UPLOAD, sizeof(record_page_t));
+            if (record_page == NULL)
+            {
+                arena_end(ARENA_PHASE_HISTORY_UPLOAD);
+                EventGroupClearBits(event_group_system, EVT_REQUEST_HISTORY);
+                continue;
+            }
+            *record_page = (record_page_t){0xFF};
+
             print("\nBASE ADDR: %08X\n", read_address);
 
             // if the requested page number is odd, read the second half of the page (second 128 bytes)
@@ -641,25 +675,24 @@ TaskDefine(task_history_upload)
                 read_address += HISTORY_SIZE / 2;
             }
 
-            print("Request history: sector %d, page %d, address %08X\n", tx_store_area.sector, tx_store_area.page, read_address);
+            dlog_d(HISTORY, "Request history: sector %d, page %d, address %08X\n", tx_store_area.sector, tx_store_area.page, read_address);
 
             ACQUIRE_SPI();
-            flash_read_data_(read_address, record_page.buf, HALF_PAGE);
-            print("Read history at sector %d, page %d\n", tx_store_area.sector, tx_store_area.page);
+            flash_read_data_(read_address, record_page->buf, HALF_PAGE);
+            dlog_d(HISTORY, "Read history at sector %d, page %d\n", tx_store_area.sector, tx_store_area.page);
             RELEASE_SPI();
 
-            log_hex_dump("Read history: ", record_page.buf, HALF_PAGE);
+            dlog_hex(HISTORY, DLOG_LEVEL_DEBUG, "Read history: ", record_page->buf, HALF_PAGE);
 
-            tx_store_area.count = get_record_count(&record_page);
+            tx_store_area.count = get_record_count(record_page);
 
             NUS_TAKE();
-            send_history_data(&record_page, tx_store_area.count, record_request.half_page_number);
+            send_history_data(record_page, tx_store_area.count, record_request.half_page_number);
             EventGroupWaitBits(event_group_system, EVT_NUS_TX_RDY, TICK_MAX);
             EventGroupClearBits(event_group_system, EVT_NUS_TX_RDY);
             NUS_GIVE();
 
-            // reset the record_page buffer
-            record_page = (record_page_t){0xFF};
+            arena_end(ARENA_PHASE_HISTORY_UPLOAD);
 
             EventGroupClearBits(event_group_system, EVT_REQUEST_HISTORY);
         }
@@ -1,6 +1,7 @@
 #ifndef __HISTORY_H__
 #define __HISTORY_H__
 
+#include "arena.h"
 #include "co2.h"
 #include "flash_spi.h"
 #include "list.h"
@@ -94,6 +95,7 @@ typedef enum
     RECORD_TYPE_CO2_RETRY,
     RECORD_TYPE_FLIGHT_MODE,
     RECORD_TYPE_CO2_SCALE_FACTOR,
+    RECORD_TYPE_CALIB_CONFIDENCE, // standard error of the calibration mean in 0.1 ppm
 } record_type_t;
 
 /**
@@ -241,6 +243,6 @@ uint8_t flash_read_data_(uint32_t addr, uint8_t *buf, uint16_t len);
 /** Write Flash Data With Verification */
 uint8_t flash_write_data_(uint32_t addr, uint8_t *buf, uint16_t len);
 
-#define BAR_COUNT 32 // Number of bars in the graph
+#define CO2_HISTORY_LEN 32 // Readings kept in co2_history, at least the BAR_COUNT bars of the graph (ui.h)
 
 #endif // __HISTORY_H__
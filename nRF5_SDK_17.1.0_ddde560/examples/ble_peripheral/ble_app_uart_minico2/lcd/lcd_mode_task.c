@@ -0,0 +1,71 @@
+#include "app_timer.h"
+#include "ttask.h"
+#include "ui.h"
+
+/**
+ * ST7301功耗模式管理
+ *
+ * 发送变化的行时切换到HPM, 画面变化立即显示, 没有变化的刷新不切换. 没有闪烁,
+ * 按键未按下, 且最近一次刷新后静止LCD_MODE_IDLE_MS, 切换到LPM降低帧率. 闪烁每
+ * 300ms刷新一次, 动画和按键操作也会连续刷新, 这些期间保持HPM.
+ *
+ * 各模式的时间见能耗账本: ENERGY_LCD_ON为亮屏时间, 其中ENERGY_LCD_HPM为HPM的时间.
+ */
+
+// 画面静止多久后切换到LPM
+#define LCD_MODE_IDLE_MS 2000
+
+// 最近一次刷新的时间, RTC计数
+static uint32_t lcd_mode_active_tick = 0;
+
+/**
+ * @brief 发送变化的行前和刷新完成时调用, LPM下切换回HPM, 需要已占用SPI
+ */
+void lcd_mode_wake(void)
+{
+    lcd_mode_active_tick = app_timer_cnt_get();
+    if (st7301_get_mode() == ST7301_MODE_LPM)
+    {
+        st7301_set_mode(ST7301_MODE_HPM);
+    }
+}
+
+/** 是否可以切换到LPM */
+static bool lcd_mode_can_sleep(void)
+{
+    uint32_t idle;
+
+    if (st7301_get_mode() != ST7301_MODE_HPM)
+    {
+        return false;
+    }
+
+    if (ui_is_blinking() || EventGroupCheckBits(event_group_system, EVT_BTN_DOWN))
+    {
+        return false;
+    }
+
+    idle = app_timer_cnt_diff_compute(app_timer_cnt_get(), lcd_mode_active_tick);
+    return idle >= APP_TIMER_TICKS(LCD_MODE_IDLE_MS);
+}
+
+TaskDefine(task_lcd_mode)
+{
+    TTS
+    {
+        while (1)
+        {
+            TaskWait(lcd_mode_can_sleep(), TICK_MAX);
+            TaskWait(spi_get_usage() == SPI_NOT_USE, TICK_MAX);
+
+            // 等待SPI期间可能已经开始刷新或息屏
+            if (lcd_mode_can_sleep())
+            {
+                spi_config(SPI_LCD);
+                st7301_set_mode(ST7301_MODE_LPM);
+                spi_config(SPI_NOT_USE);
+            }
+        }
+    }
+    TTE
+}
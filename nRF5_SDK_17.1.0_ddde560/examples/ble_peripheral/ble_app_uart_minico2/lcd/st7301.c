@@ -2,6 +2,9 @@
 
 #define delay_ms nrf_delay_ms
 
+// 当前功耗模式, st7301_config后为HPM
+static st7301_mode_t st7301_mode = ST7301_MODE_OFF;
+
 void lcd_gpio_init(void)
 {
     nrf_gpio_cfg_output(PIN_LCD_PWR);
@@ -55,6 +58,36 @@ static void write_cd(uint8_t cd, uint8_t value)
     }
 }
 
+/**
+ * @brief lcd写入一个命令及其全部参数, 参数在一次传输中发送
+ *
+ * @param cmd 命令
+ * @param params 参数
+ * @param len 参数个数
+ */
+static void write_cmd(uint8_t cmd, const uint8_t *params, uint8_t len)
+{
+    static uint8_t buf[16]; // EasyDMA不能读取flash, 参数复制到RAM
+
+    write_cd(COMMAND, cmd);
+
+    if (len > sizeof(buf)) len = sizeof(buf);
+    memcpy(buf, params, len);
+    LCD_SEL_PARM();
+    if (0 != spi_write(buf, len, NULL, 10))
+    {
+        print("st7301 write %d parameters of %02x failed\n", len, cmd);
+    }
+}
+
+/** 写入命令和常量参数 */
+#define WRITE_CMD(cmd, ...)                                \
+    do                                                     \
+    {                                                      \
+        static const uint8_t _params[] = {__VA_ARGS__};    \
+        write_cmd((cmd), _params, sizeof(_params));        \
+    } while (0)
+
 void st7301_config(void)
 {
     write_cd(COMMAND, 0xEB);   // Enable OTP
@@ -69,34 +102,19 @@ void st7301_config(void)
     write_cd(COMMAND, 0xC0);   // Gate Voltage Setting
     write_cd(PARAMETER, 0xE4); //
 
-    write_cd(COMMAND, 0xC1);
-    write_cd(PARAMETER, 0x28);
-    write_cd(PARAMETER, 0x28);
-    write_cd(PARAMETER, 0x28);
-    write_cd(PARAMETER, 0x28);
-    write_cd(PARAMETER, 0x14);
-    write_cd(PARAMETER, 0x00);
+    WRITE_CMD(0xC1, 0x28, 0x28, 0x28, 0x28, 0x14, 0x00);
 
-    write_cd(COMMAND, 0xC2);
-    write_cd(PARAMETER, 0x0D);
-    write_cd(PARAMETER, 0x0D);
-    write_cd(PARAMETER, 0x0D);
-    write_cd(PARAMETER, 0x0D);
+    WRITE_CMD(0xC2, 0x0D, 0x0D, 0x0D, 0x0D);
 
     write_cd(COMMAND, 0xCB);   // VCOMH Setting
     write_cd(PARAMETER, 0x14); // VCOMH
 
-    write_cd(COMMAND, 0xB4);   // Gate EQ
-    write_cd(PARAMETER, 0xE5); //
-    write_cd(PARAMETER, 0x66); //
-    write_cd(PARAMETER, 0xFD); // HPM EQ
-    write_cd(PARAMETER, 0xFF); //
-    write_cd(PARAMETER, 0xFF); //
-    write_cd(PARAMETER, 0x7F); //
-    write_cd(PARAMETER, 0xFD); //
-    write_cd(PARAMETER, 0xFF); // LPM EQ
-    write_cd(PARAMETER, 0xFF); //
-    write_cd(PARAMETER, 0x7F); //
+    WRITE_CMD(0xB4,        // Gate EQ
+              0xE5, 0x66,  //
+              0xFD, 0xFF,  // HPM EQ
+              0xFF, 0x7F,  //
+              0xFD, 0xFF,  // LPM EQ
+              0xFF, 0x7F); //
 
     write_cd(COMMAND, 0xB7);   // Disable Source EQ
     write_cd(PARAMETER, 0x04); //
@@ -108,16 +126,12 @@ void st7301_config(void)
     write_cd(COMMAND, 0xD6); // Load 51Hz code
     write_cd(PARAMETER, 0x01);
 
-    write_cd(COMMAND, 0xC7); // 32Hz=A6,51Hz=80；
-    write_cd(PARAMETER, 0x80);
-    write_cd(PARAMETER, 0xE9);
+    WRITE_CMD(0xC7, 0x80, 0xE9); // 32Hz=A6,51Hz=80；
 
     write_cd(COMMAND, 0xCA); // 68Hz；
     write_cd(PARAMETER, 0xF7);
 
-    write_cd(COMMAND, 0xB2); // Frame rate setting
-    write_cd(PARAMETER, 0X01);
-    write_cd(PARAMETER, 0X02);
+    WRITE_CMD(0xB2, 0X01, 0X02); // Frame rate setting
 
     write_cd(COMMAND, 0xB0);   // Duty Setting
     write_cd(PARAMETER, 0x58); // 212dutyx2/4=106
@@ -160,7 +174,8 @@ void st7301_config(void)
     write_cd(COMMAND, 0xE3); //
     write_cd(PARAMETER, 0x02);
 
-    write_cd(COMMAND, 0x38); // HPM
+    st7301_mode = ST7301_MODE_OFF; // 复位后需要重新发送
+    st7301_set_mode(ST7301_MODE_HPM);
 }
 
 /**
@@ -177,12 +192,11 @@ uint8_t set_window_addr(uint8_t x, uint8_t y, uint8_t w, uint8_t h)
     // if (w == 0 || h == 0) return 1;
     // if (x + w >= 60 || y + h >= 240) return 1;
 
-    write_cd(COMMAND, 0x2A);                       // 列地址
-    write_cd(PARAMETER, (x + COL_OFFSET));         // 首列
-    write_cd(PARAMETER, (x + COL_OFFSET + w - 1)); // 末列
-    write_cd(COMMAND, 0x2B);                       // 行地址
-    write_cd(PARAMETER, (y + ROW_OFFSET));         // 首行
-    write_cd(PARAMETER, (y + ROW_OFFSET + h - 1)); // 末行
+    uint8_t col[2] = {x + COL_OFFSET, x + COL_OFFSET + w - 1}; // 首列, 末列
+    uint8_t row[2] = {y + ROW_OFFSET, y + ROW_OFFSET + h - 1}; // 首行, 末行
+
+    write_cmd(0x2A, col, 2); // 列地址
+    write_cmd(0x2B, row, 2); // 行地址
     // print("xs %d xe %d, ys %d ye %d\n",
     //       x + COL_OFFSET,
     //       x + COL_OFFSET + w - 1,
@@ -200,6 +214,31 @@ void lcd_low_power(void)
     // write_cd(COMMAND, 0x10); // Sleep in
     write_cd(COMMAND, 0xb2); // frame rate
     write_cd(PARAMETER, 0); // 0.25Hz
-    write_cd(COMMAND, 0x39); // low power mode
+    st7301_set_mode(ST7301_MODE_LPM);
+}
+
+void st7301_set_mode(st7301_mode_t mode)
+{
+    if (mode == st7301_mode)
+    {
+        return;
+    }
+
+    if (mode == ST7301_MODE_HPM)
+    {
+        write_cd(COMMAND, 0x38); // HPM
+    }
+    else if (mode == ST7301_MODE_LPM)
+    {
+        write_cd(COMMAND, 0x39); // LPM
+    }
 
+    dlog_d(UI, "st7301 mode %d -> %d\n", st7301_mode, mode);
+    st7301_mode = mode;
+    energy_set(ENERGY_LCD_HPM, mode == ST7301_MODE_HPM);
+}
+
+st7301_mode_t st7301_get_mode(void)
+{
+    return st7301_mode;
 }
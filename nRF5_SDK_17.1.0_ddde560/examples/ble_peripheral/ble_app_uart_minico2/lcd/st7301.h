@@ -6,8 +6,10 @@
 #include "string.h"
 
 #include "app_timer.h"
+#include "energy.h"
 #include "log.h"
 #include "nrf_delay.h"
+#include "trace.h"
 
 #define ST7301_XS 0
 #define ST7301_XE 0x3B
@@ -24,12 +26,12 @@
 
 #define LCD_CHIP_SEL()   nrf_gpio_pin_clear(PIN_LCD_CS);
 #define LCD_CHIP_UNSEL() nrf_gpio_pin_set(PIN_LCD_CS);
-#define LCD_RESET_LOW()  nrf_gpio_pin_clear(PIN_LCD_RST);
+#define LCD_RESET_LOW()  do { nrf_gpio_pin_clear(PIN_LCD_RST); st7301_set_mode(ST7301_MODE_OFF); } while (0); // 复位后模式未配置
 #define LCD_RESET_HIGH() nrf_gpio_pin_set(PIN_LCD_RST);
 #define LCD_BL_ON()      nrf_gpio_pin_clear(PIN_LCD_BL);
 #define LCD_BL_OFF()     nrf_gpio_pin_set(PIN_LCD_BL);
-#define LCD_PWR_ON()     nrf_gpio_pin_clear(PIN_LCD_PWR);
-#define LCD_PWR_OFF()    nrf_gpio_pin_set(PIN_LCD_PWR);
+#define LCD_PWR_ON()     do { nrf_gpio_pin_clear(PIN_LCD_PWR); energy_begin(ENERGY_LCD_ON); trace_add(TRACE_EVT_SCREEN_ON, 0, 0); } while (0);
+#define LCD_PWR_OFF()    do { nrf_gpio_pin_set(PIN_LCD_PWR); st7301_set_mode(ST7301_MODE_OFF); energy_end(ENERGY_LCD_ON); trace_add(TRACE_EVT_SCREEN_OFF, 0, 0); } while (0);
 #define LCD_SEL_CMD()    nrf_gpio_pin_clear(PIN_LCD_CD);
 #define LCD_SEL_PARM()   nrf_gpio_pin_set(PIN_LCD_CD);
 
@@ -66,4 +68,22 @@ uint8_t set_window_addr(uint8_t x, uint8_t y, uint8_t w, uint8_t h);
 
 void lcd_low_power(void);
 
+/** ST7301功耗模式 */
+typedef enum
+{
+    ST7301_MODE_OFF = 0, // 未上电或未配置
+    ST7301_MODE_HPM,     // 高功耗模式, 正常帧率
+    ST7301_MODE_LPM,     // 低功耗模式, 低帧率, 用于静止画面
+} st7301_mode_t;
+
+/**
+ * @brief 切换功耗模式, HPM的时间计入能耗账本的ENERGY_LCD_HPM
+ *
+ * @param mode 模式, ST7301_MODE_OFF只记录屏幕已断电或复位, 不发送命令
+ */
+void st7301_set_mode(st7301_mode_t mode);
+
+/** 获取当前功耗模式 */
+st7301_mode_t st7301_get_mode(void);
+
 #endif
@@ -1,4 +1,5 @@
 #include "ui.h"
+#include "app_util_platform.h"
 
 // 内存画布,1bit为1像素，写入显存时再扩展颜色也减小内存消耗
 static uint8_t gram[LCD_HIGHT][LCD_WIDTH / 8] = {0};
@@ -19,15 +20,79 @@ static uint8_t gram[LCD_HIGHT][LCD_WIDTH / 8] = {0};
         gram[(_row)][(_col) / 8] &= ~(1 << ((_col) % 8)); \
     } while (0);
 
-// SPI发送缓存, 每次写入LCD显存时，最少写入一行
-static uint8_t gram_write_buf[LCD_WIDTH] = {0};
+// 每个发送缓存的行数, 多行在一次写入中连续发送
+#define UI_WRITE_BUF_ROWS 4
+
+// SPI发送缓存, 每次写入LCD显存时，最少写入一行; 双缓存, 一个缓存发送时在任务中转换下一个
+static uint8_t  gram_write_buf[2][UI_WRITE_BUF_ROWS * LCD_WIDTH] = {0};
+static uint16_t write_buf_len[2] = {0};
+
+// 已转换待发送(含正在发送)的缓存数, 最早的是write_buf_send
+static volatile uint8_t write_buf_full = 0;
+static volatile uint8_t write_buf_send = 0;
+
+// 正在发送write_buf_send
+static volatile bool write_buf_sending = false;
+
+// 当前行每列的前景色, 显存格式
+static uint8_t row_colors[LCD_WIDTH] = {0};
+
+// 柱状图该列没有数据
+#define UI_BAR_EMPTY 0xFF
+
+// 本帧前景色用到的状态, 刷新开始时更新一次
+typedef struct
+{
+    uint8_t page;
+    uint8_t ui_mode;
+    uint8_t ble_color;
+    uint8_t co2_color;
+    uint8_t bar_height[BAR_COUNT]; // 从左到右, UI_BAR_EMPTY为无数据
+    uint8_t bar_color[BAR_COUNT];
+} ui_color_ctx_t;
+
+static ui_color_ctx_t color_ctx;
 
 // ui状态
 // static uint8_t ui_busy = 0;
 
-// 当前绘制/刷新的区域
+// 当前绘制/刷新的区域, 每次只发送一段连续的变化行及其变化的列
 static ui_rect_t refresh_rect;
 
+// 本次刷新区域的末行(不含)
+static uint8_t refresh_end = 0;
+
+// 正在刷新, 所有段发送完成后结束
+static bool refresh_active = false;
+
+// 列窗口, 0时总是发送整行
+#define UI_COLUMN_WINDOWS 1
+
+// 本次刷新每行需要发送的列组范围[lo, hi], 列组是显存列地址的单位(4像素列), lo为UI_ROW_CLEAN时该行不发送
+#define UI_ROW_CLEAN  0xFF
+#define UI_COL_GROUPS (LCD_WIDTH / 4)
+static uint8_t refresh_lo[LCD_HIGHT];
+static uint8_t refresh_hi[LCD_HIGHT];
+
+// 本次刷新的统计: 发送的行数, 窗口段数, 像素字节数, 开始时间
+static uint8_t  refresh_rows_sent  = 0;
+static uint8_t  refresh_runs       = 0;
+static uint16_t refresh_bytes_sent = 0;
+static uint32_t refresh_start_tick;
+
+// 每设置一次窗口发送的命令和参数字节数
+#define UI_WINDOW_CMD_BYTES 7
+
+// 已发送到显存的画布和颜色表, 与本帧比较得出变化的行和列
+static uint8_t        gram_sent[LCD_HIGHT][LCD_WIDTH / 8];
+static ui_color_ctx_t color_ctx_sent;
+
+// gram_sent是否与显存一致, 屏幕上电后显存内容未知
+static bool gram_sent_valid = false;
+
+// 上次刷新的页面, 息屏页刷新后屏幕断电, 显存内容丢失
+static ui_page_t refresh_page = UI_PAGE_OFF;
+
 // 当前页面 0首页，1校准页
 static ui_page_t disp_page = UI_PAGE_MAIN;
 
@@ -43,23 +108,23 @@ uint8_t ui_get_idle_state(void)
 }
 
 /**
- * @brief 给出需要跟新的窗口，实际上会更新屏幕整行
+ * @brief 给出需要跟新的窗口, 列地址以4个像素列为单位
  *
- * @param rect 区域
+ * @param rect 区域, x和w为4的倍数
  */
 void ui_set_window(ui_rect_t *rect)
 {
-    set_window_addr(0, rect->y, LCD_WIDTH / 4, rect->h);
+    set_window_addr(rect->x / 4, rect->y, rect->w / 4, rect->h);
 }
 
-// Get color based on CO2 PPM value
-static uint8_t get_bar_color(uint16_t ppm)
+// Get color based on CO2 PPM value and the graph thresholds
+static uint8_t get_bar_color(uint16_t ppm, uint16_t yellow_start, uint16_t red_start)
 {
-    if (ppm < cfg_fstorage_get_graph_yellow_start())
+    if (ppm < yellow_start)
     {
         return COLOR_GREEN;
     }
-    else if (ppm < cfg_fstorage_get_graph_red_start())
+    else if (ppm < red_start)
     {
         return COLOR_YELLOW;
     }
@@ -69,211 +134,527 @@ static uint8_t get_bar_color(uint16_t ppm)
     }
 }
 
+// Bar height for a CO2 PPM value on the graph scale min_value..max_value
+static uint8_t ui_bar_height(uint16_t ppm, uint16_t min_value, uint16_t max_value)
+{
+    uint8_t height;
+
+    // Ensure ppm is within the range
+    if (ppm < min_value)
+    {
+        // If value is below minimum, don't show any bar
+        return 0;
+    }
+
+    // Calculate height based on the range from min to max
+    if (max_value > min_value)
+    {
+        // Calculate the percentage of the range and apply to bar height
+        height = ((ppm - min_value) * BAR_HEIGHT) / (max_value - min_value);
+    }
+    else
+    {
+        // Prevent division by zero
+        height = 0;
+    }
+
+    // Ensure height doesn't exceed maximum
+    if (height > BAR_HEIGHT)
+    {
+        height = BAR_HEIGHT;
+    }
+
+    return height;
+}
+
 /**
- * @brief 根据像素所在位置，获取它的前景色,屏幕颜色简单，仅有少数不规则的前景色，用本函数给出
- *
- * @param x 像素的x坐标
- * @param y 像素的y坐标
- * @return uint8_t 像素的前景色
+ * @brief 按本帧的颜色表更新, 在刷新开始时于任务中读取配置和数据, 逐行转换时只查表
  */
-uint8_t ui_get_pix_forcolor(uint8_t x, uint8_t y)
+static void ui_color_ctx_update(void)
 {
     extern uint8_t  get_ble_state(void);
     extern uint16_t co2_history[BAR_COUNT];
 
-    if (disp_page == UI_PAGE_MAIN)
+    uint16_t ppm = get_co2_value();
+    uint16_t bar_ppm;
+    uint16_t yellow_start, red_start, min_value, max_value;
+    uint8_t  ble;
+
+    memset(&color_ctx, 0, sizeof(color_ctx));
+    color_ctx.page = disp_page;
+    if (disp_page != UI_PAGE_MAIN)
+    {
+        return;
+    }
+
+    // 配置每帧只读一次
+    yellow_start = cfg_fstorage_get_graph_yellow_start();
+    red_start    = cfg_fstorage_get_graph_red_start();
+    ble          = get_ble_state();
+
+    color_ctx.ui_mode   = cfg_fstorage_get_ui_mode();
+    color_ctx.co2_color = ppm == 0 ? COLOR_WHITE : get_bar_color(ppm, yellow_start, red_start);
+    if (ble == CONNECTED)
+    {
+        color_ctx.ble_color = COLOR_BLE_CONN;
+    }
+    else if (ble == ADVERTISING)
+    {
+        color_ctx.ble_color = COLOR_BLE_ADV;
+    }
+    else
+    {
+        color_ctx.ble_color = COLOR_BLE_DISCON;
+    }
+
+    if (color_ctx.ui_mode == 0)
     {
-        if (cfg_fstorage_get_ui_mode() == 0)
+        min_value = cfg_fstorage_get_graph_min_value();
+        max_value = cfg_fstorage_get_graph_max_value();
+
+        // 柱状图从左到右, 最新的数据在最右边
+        for (uint8_t i = 0; i < BAR_COUNT; i++)
         {
-            // Check if pixel is in graph area
-            if (x >= BAR_START_X &&
-                x < LCD_WIDTH &&
-                y >= BAR_START_Y &&
-                y <= LCD_HIGHT)
+            bar_ppm = co2_history[BAR_COUNT - 1 - i];
+            if (bar_ppm == 0)
             {
-                // Find which bar this pixel belongs to
-                uint8_t  bar_index = (x - BAR_START_X) / (BAR_WIDTH + BAR_SPACING);
-                uint16_t ppm       = co2_history[BAR_COUNT - 1 - bar_index];
+                color_ctx.bar_height[i] = UI_BAR_EMPTY; // 无数据不绘制
+                continue;
+            }
+            color_ctx.bar_height[i] = ui_bar_height(bar_ppm, min_value, max_value);
+            color_ctx.bar_color[i]  = get_bar_color(bar_ppm, yellow_start, red_start);
+        }
+    }
+}
 
-                // If CO2 value is 0, don't draw anything (transparent)
-                if (ppm == 0)
-                {
-                    return COLOR_BKG; // Return background color
-                }
+/**
+ * @brief 区域与行相交的部分填充颜色
+ *
+ * @param colors 行颜色
+ * @param rect 区域
+ * @param y 行
+ * @param color 颜色
+ */
+static void ui_fill_span(uint8_t *colors, const ui_rect_t *rect, uint8_t y, uint8_t color)
+{
+    uint8_t w = rect->w;
+
+    if (y < rect->y || y >= rect->y + rect->h || rect->x >= LCD_WIDTH)
+    {
+        return;
+    }
+    if (rect->x + w > LCD_WIDTH)
+    {
+        w = LCD_WIDTH - rect->x;
+    }
+    memset(colors + rect->x, ST7301_COLOR(color), w);
+}
 
-                // Get the height of the bar
-                uint8_t bar_height = ui_get_bar_height_from_ppm(ppm);
+/**
+ * @brief 给出一行像素的前景色,屏幕颜色简单，仅有少数不规则的前景色, 后填充的区域优先
+ *
+ * @param y 行
+ * @param colors 每列的前景色, 已转换为显存格式
+ */
+static void ui_fill_row_colors(uint8_t y, uint8_t *colors)
+{
+    uint8_t x, i, end, color;
 
-                // Calculate pixel position from bottom of graph
-                uint8_t pixel_height_from_bottom = BAR_START_Y + BAR_HEIGHT - y;
+    memset(colors, ST7301_COLOR(COLOR_WHITE), LCD_WIDTH);
 
-                // Calculate bar's top position from bottom
-                uint8_t bar_top_from_bottom = bar_height;
+    if (color_ctx.page == UI_PAGE_MAIN)
+    {
+        ui_fill_span(colors, &elem_ppm_1000x.rect, y, color_ctx.co2_color);
+        ui_fill_span(colors, &elem_ppm_100x.rect, y, color_ctx.co2_color);
+        ui_fill_span(colors, &elem_ppm_10x.rect, y, color_ctx.co2_color);
+        ui_fill_span(colors, &elem_ppm_1x.rect, y, color_ctx.co2_color);
+        ui_fill_span(colors, &elem_ble.rect, y, color_ctx.ble_color);
 
-                // If pixel is within the active part of the bar
-                if (pixel_height_from_bottom <= bar_top_from_bottom)
+        if (color_ctx.ui_mode == 1)
+        {
+            ui_fill_span(colors, &elem_rect_g, y, COLOR_GREEN);
+            ui_fill_span(colors, &elem_rect_y, y, COLOR_YELLOW);
+            ui_fill_span(colors, &elem_rect_r, y, COLOR_RED);
+        }
+        else if (color_ctx.ui_mode == 0 && y >= BAR_START_Y)
+        {
+            // 每根柱子连同间隔一列, 柱子以上为稀疏的点阵背景
+            for (i = 0, x = BAR_START_X; i < BAR_COUNT && x < LCD_WIDTH; i++)
+            {
+                end = x + BAR_WIDTH + BAR_SPACING;
+                if (end > LCD_WIDTH) end = LCD_WIDTH;
+
+                if (color_ctx.bar_height[i] == UI_BAR_EMPTY)
+                {
+                    memset(colors + x, ST7301_COLOR(COLOR_BKG), end - x);
+                    x = end;
+                    continue;
+                }
+                if (BAR_START_Y + BAR_HEIGHT - y <= color_ctx.bar_height[i])
                 {
-                    return get_bar_color(ppm);
+                    memset(colors + x, ST7301_COLOR(color_ctx.bar_color[i]), end - x);
+                    x = end;
+                    continue;
                 }
-                else
+                for (; x < end; x++)
                 {
-                    // Create a very subtle dotted pattern for the background
-                    // Only show a dot every few pixels to create a subtle effect
-                    if ((x + y) % 4 == 0)
-                    {
-                        return COLOR_GRAY; // Show a dot
-                    }
-                    else
-                    {
-                        return COLOR_BKG; // Most pixels are background color
-                    }
+                    color     = (x + y) % 4 == 0 ? COLOR_GRAY : COLOR_BKG;
+                    colors[x] = ST7301_COLOR(color);
                 }
             }
         }
-        else if (cfg_fstorage_get_ui_mode() == 1)
+    }
+    else if (color_ctx.page == UI_PAGE_COLOR_PLATE) // 调色盘
+    {
+        for (x = 0; x < LCD_WIDTH; x++)
         {
-            if (INRECT(x, y, &elem_rect_g))
-            {
-                return COLOR_GREEN;
-            }
-            if (INRECT(x, y, &elem_rect_y))
-            {
-                return COLOR_YELLOW;
-            }
-            if (INRECT(x, y, &elem_rect_r))
-            {
-                return COLOR_RED;
-            }
+            colors[x] = ST7301_COLOR((y / 22) * 8 + x / 22);
         }
+    }
+    else if (color_ctx.page == UI_PAGE_BAT_LOW)
+    {
+        ui_fill_span(colors, &elem_bat_low_red.rect, y, COLOR_RED);
+    }
+    else if (color_ctx.page == UI_PAGE_POWER_ON)
+    {
+        ui_fill_span(colors, &logo_g, y, COLOR_GREEN);
+        ui_fill_span(colors, &logo_y, y, COLOR_YELLOW);
+        ui_fill_span(colors, &logo_r, y, COLOR_RED);
+    }
+}
+
+/** 显存内容未知, 下次刷新发送区域内所有行 */
+void ui_refresh_invalidate(void)
+{
+    gram_sent_valid = false;
+}
+
+/**
+ * @brief 将画布的一行转换为显存格式
+ *
+ * @param y 行
+ * @param x 起始列, 4的倍数
+ * @param w 宽度, 4的倍数
+ * @param buf 发送缓存
+ */
+static void ui_render_row(uint8_t y, uint8_t x, uint8_t w, uint8_t *buf)
+{
+    uint8_t col = x, end = x + w, bits;
+
+    ui_fill_row_colors(y, row_colors);
+    buf -= x;
 
-        if (INRECT(x, y, &elem_ble.rect))
+    // 窗口两端可能只有半个画布字节
+    if (col % 8 != 0)
+    {
+        bits = gram[y][col / 8] >> 4;
+        for (uint8_t i = 0; i < 4; i++)
         {
-            if (get_ble_state() == 1)
-            {
-                return COLOR_BLE_CONN;
-            }
-            else if (get_ble_state() == 2)
-            {
-                return COLOR_BLE_ADV;
-            }
-            else
-            {
-                return COLOR_BLE_DISCON;
-            }
+            buf[col + i] = (bits & (1 << i)) ? row_colors[col + i] : ST7301_COLOR(COLOR_BKG);
         }
+        col += 4;
+    }
 
-        if (INRECT(x, y, &elem_ppm_1000x.rect) || INRECT(x, y, &elem_ppm_100x.rect) || INRECT(x, y, &elem_ppm_10x.rect) || INRECT(x, y, &elem_ppm_1x.rect))
-        {
-            int16_t ppm = get_co2_value();
-            if (ppm == 0) return COLOR_WHITE;
+    // 按画布字节转换, 全空或全满的字节整块填充
+    for (; col + 8 <= end; col += 8)
+    {
+        bits = gram[y][col / 8];
 
-            if (ppm < cfg_fstorage_get_graph_yellow_start())
-            {
-                return COLOR_GREEN;
-            }
-            else if (ppm < cfg_fstorage_get_graph_red_start())
-            {
-                return COLOR_YELLOW;
-            }
-            else
+        if (bits == 0)
+        {
+            memset(buf + col, ST7301_COLOR(COLOR_BKG), 8);
+        }
+        else if (bits == 0xFF)
+        {
+            memcpy(buf + col, row_colors + col, 8);
+        }
+        else
+        {
+            for (uint8_t i = 0; i < 8; i++)
             {
-                return COLOR_RED;
+                buf[col + i] = (bits & (1 << i)) ? row_colors[col + i] : ST7301_COLOR(COLOR_BKG);
             }
         }
     }
-    else if (disp_page == UI_PAGE_COLOR_PLATE) // 调色盘
-    {
-        return (y / 22) * 8 + x / 22;
-    }
-    else if (disp_page == UI_PAGE_BAT_LOW)
+
+    if (col < end)
     {
-        if (INRECT(x, y, &elem_bat_low_red.rect))
+        bits = gram[y][col / 8];
+        for (uint8_t i = 0; i < 4; i++)
         {
-            // 圆角部分
-            // if(x == 17)
-            // {
-            //     if(y == 68 || y == 69 || y == 105 || y == 106) return COLOR_WHITE;
-            // }
-            // else if(x == 18)
-            // {
-            //     if(y == 68 || y == 106) return COLOR_WHITE;
-            // }
-            return COLOR_RED;
+            buf[col + i] = (bits & (1 << i)) ? row_colors[col + i] : ST7301_COLOR(COLOR_BKG);
         }
     }
-    else if (disp_page == UI_PAGE_POWER_ON)
+}
+
+static void ui_refresh_buf_sent(void);
+
+/**发送最早的缓存, 失败时丢弃缓存的行, 下次刷新发送所有行 */
+static void ui_refresh_send(void)
+{
+    write_buf_sending = true;
+    if (0 != spi_write(gram_write_buf[write_buf_send], write_buf_len[write_buf_send], ui_refresh_buf_sent, 10))
     {
-        if (INRECT(x, y, &logo_g))
-        {
-            return COLOR_GREEN;
-        }
-        if (INRECT(x, y, &logo_y))
+        write_buf_sending = false;
+        write_buf_full    = 0;
+        gram_sent_valid     = false;
+    }
+}
+
+/**一个缓存发送完成(SPI中断), 只开始发送已经准备好的下一个 */
+static void ui_refresh_buf_sent(void)
+{
+    write_buf_full -= 1;
+    write_buf_send ^= 1;
+    write_buf_sending = false;
+
+    if (write_buf_full != 0)
+    {
+        ui_refresh_send();
+    }
+}
+
+/**在任务中转换本段剩余的行, 填满空闲的缓存, SPI空闲时开始发送 */
+static void ui_refresh_pump(void)
+{
+    uint8_t idx, rows;
+
+    while (refresh_rect.h != 0 && write_buf_full < 2)
+    {
+        // 两个缓存轮流使用, 未满时下一个要写的缓存一定空闲; 窗口窄时每个缓存放更多行
+        // 两个变量在SPI中断中一起改变, 需要关中断读取; 发送完成不改变下一个要写的缓存
+        CRITICAL_REGION_ENTER();
+        idx = write_buf_send ^ write_buf_full;
+        CRITICAL_REGION_EXIT();
+        rows = sizeof(gram_write_buf[0]) / refresh_rect.w;
+        if (rows > refresh_rect.h) rows = refresh_rect.h;
+        for (uint8_t i = 0; i < rows; i++)
         {
-            return COLOR_YELLOW;
+            ui_render_row(refresh_rect.y + i, refresh_rect.x, refresh_rect.w, gram_write_buf[idx] + i * refresh_rect.w);
         }
-        if (INRECT(x, y, &logo_r))
+        write_buf_len[idx] = rows * refresh_rect.w;
+        refresh_rect.y += rows;
+        refresh_rect.h -= rows;
+
+        CRITICAL_REGION_ENTER();
+        write_buf_full += 1;
+        if (!write_buf_sending)
         {
-            return COLOR_RED;
+            ui_refresh_send();
         }
+        CRITICAL_REGION_EXIT();
     }
+}
 
-    return COLOR_WHITE;
+/**
+ * @brief 从当前行开始找下一段连续的变化行, 设置窗口并开始发送, 窗口的列覆盖段内所有行变化的列
+ *
+ * @return uint8_t 开始发送返回1, 没有变化的行返回0
+ */
+static uint8_t ui_refresh_next_run(void)
+{
+    uint8_t y  = refresh_rect.y;
+    uint8_t h  = 0;
+    uint8_t lo = UI_ROW_CLEAN;
+    uint8_t hi = 0;
+
+    while (y < refresh_end && refresh_lo[y] == UI_ROW_CLEAN)
+    {
+        y++;
+    }
+    while (y + h < refresh_end && refresh_lo[y + h] != UI_ROW_CLEAN)
+    {
+        if (refresh_lo[y + h] < lo) lo = refresh_lo[y + h];
+        if (refresh_hi[y + h] > hi) hi = refresh_hi[y + h];
+        h++;
+    }
+    if (h == 0)
+    {
+        return 0;
+    }
+
+    refresh_rect.x = lo * 4;
+    refresh_rect.w = (hi - lo + 1) * 4;
+    refresh_rect.y = y;
+    refresh_rect.h = h;
+    refresh_rows_sent += h;
+    refresh_runs += 1;
+    refresh_bytes_sent += h * refresh_rect.w;
+    lcd_mode_wake(); // 画面变化, LPM下切换回HPM, 没有变化的行时保持LPM
+    ui_set_window(&refresh_rect);
+    ui_refresh_pump();
+    return 1;
 }
 
-/**将需要跟新的画布部分发送到显存 */
-static void ui_refresh_row(void)
+/**
+ * @brief 区域与本次刷新的行相交的部分加入刷新, 用于前景色改变的元素
+ *
+ * @param area 区域
+ */
+static void ui_refresh_mark(const ui_rect_t *area)
 {
-    if (0 == refresh_rect.h) // 结束
+    uint8_t lo = area->x / 4;
+    uint8_t hi = (area->x + area->w - 1) / 4;
+
+    if (area->w == 0 || lo >= UI_COL_GROUPS)
     {
-        // ui_busy = 0;
-        // spi_config(SPI_NOT_USE);
-        // print("ui refresh done\n");
         return;
     }
+    if (hi >= UI_COL_GROUPS) hi = UI_COL_GROUPS - 1;
+#if UI_COLUMN_WINDOWS == 0
+    lo = 0;
+    hi = UI_COL_GROUPS - 1;
+#endif
 
-    for (uint8_t col = 0; col < LCD_WIDTH; col++)
+    for (uint8_t y = area->y; y < area->y + area->h && y < refresh_end; y++)
     {
-        if (GRAM_GET_PIX(refresh_rect.y, col))
+        if (y < refresh_rect.y) continue;
+        if (refresh_lo[y] == UI_ROW_CLEAN)
         {
-            gram_write_buf[col] = ST7301_COLOR(ui_get_pix_forcolor(col, refresh_rect.y));
+            refresh_lo[y] = lo;
+            refresh_hi[y] = hi;
+            continue;
         }
-        else
+        if (lo < refresh_lo[y]) refresh_lo[y] = lo;
+        if (hi > refresh_hi[y]) refresh_hi[y] = hi;
+    }
+}
+
+/** 与已发送的颜色表比较, 前景色改变的元素加入刷新, 像素不变也要重发 */
+static void ui_refresh_mark_colors(void)
+{
+    ui_rect_t bar = {.y = BAR_START_Y, .w = BAR_WIDTH + BAR_SPACING, .h = LCD_HIGHT - BAR_START_Y};
+
+    if (color_ctx.co2_color != color_ctx_sent.co2_color)
+    {
+        ui_refresh_mark(&elem_ppm_1000x.rect);
+        ui_refresh_mark(&elem_ppm_100x.rect);
+        ui_refresh_mark(&elem_ppm_10x.rect);
+        ui_refresh_mark(&elem_ppm_1x.rect);
+    }
+    if (color_ctx.ble_color != color_ctx_sent.ble_color)
+    {
+        ui_refresh_mark(&elem_ble.rect);
+    }
+    for (uint8_t i = 0; i < BAR_COUNT; i++)
+    {
+        bar.x = BAR_START_X + i * (BAR_WIDTH + BAR_SPACING);
+        if (bar.x >= LCD_WIDTH) break;
+        if (color_ctx.bar_height[i] != color_ctx_sent.bar_height[i] || color_ctx.bar_color[i] != color_ctx_sent.bar_color[i])
         {
-            gram_write_buf[col] = ST7301_COLOR(COLOR_BKG);
+            ui_refresh_mark(&bar);
         }
     }
-
-    // print("lcd write row %d\n", refresh_rect.y);
-    refresh_rect.y += 1;
-    refresh_rect.h -= 1;
-    // print("lcd row reamin %d\n", refresh_rect.h);
-    spi_write(gram_write_buf, LCD_WIDTH, ui_refresh_row, 10);
-    // spi_write(gram_write_buf, 64, ui_refresh_row, 10);
 }
 
 /**
- * @brief 刷新屏幕指定的区域,实际上每次总是刷新屏幕的整行
+ * @brief 刷新屏幕指定的区域(整行), 只发送变化的行和列
  *
  * @param rect 刷新区域
  * @return busy 1错误， 0成功
  */
 uint8_t ui_refresh(ui_rect_t *rect)
 {
+    uint8_t lo, hi;
+    bool    full_screen = rect->y == 0 && rect->h >= LCD_HIGHT;
+
     // print("ui refresh\n");
 
+    if (refresh_page == UI_PAGE_OFF)
+    {
+        gram_sent_valid = false;
+    }
+    refresh_page = disp_page;
+
+    // 页面或模式改变时所有行都需要刷新; 其它颜色改变时整屏刷新只重发该颜色的元素,
+    // 部分刷新不能重发区域外的元素, 同样发送所有行
+    ui_color_ctx_update();
+    if (color_ctx.page != color_ctx_sent.page || color_ctx.ui_mode != color_ctx_sent.ui_mode ||
+        (!full_screen && memcmp(&color_ctx, &color_ctx_sent, sizeof(color_ctx)) != 0))
+    {
+        gram_sent_valid = false;
+    }
     refresh_rect.y = rect->y;
-    refresh_rect.h = rect->h;
+    refresh_end    = rect->y + rect->h > LCD_HIGHT ? LCD_HIGHT : rect->y + rect->h;
 
-    ui_set_window(&refresh_rect);
-    ui_refresh_row();
+    // 只发送与gram_sent不同的行和列组, gram_sent先更新为画布的内容
+    // 画布字节的低4位是左边的列组
+    memset(refresh_lo, UI_ROW_CLEAN, sizeof(refresh_lo));
+    for (uint8_t y = rect->y; y < refresh_end; y++)
+    {
+        lo = 0;
+        hi = UI_COL_GROUPS - 1;
+        if (gram_sent_valid)
+        {
+            uint8_t b = 0, e = LCD_WIDTH / 8 - 1;
+
+            while (b <= e && gram[y][b] == gram_sent[y][b]) b++;
+            if (b > e) continue;
+            while (gram[y][e] == gram_sent[y][e]) e--;
+            lo = b * 2 + (((gram[y][b] ^ gram_sent[y][b]) & 0x0F) == 0);
+            hi = e * 2 + (((gram[y][e] ^ gram_sent[y][e]) & 0xF0) != 0);
+        }
+#if UI_COLUMN_WINDOWS == 0
+        lo = 0;
+        hi = UI_COL_GROUPS - 1;
+#endif
+        refresh_lo[y] = lo;
+        refresh_hi[y] = hi;
+        memcpy(gram_sent[y], gram[y], LCD_WIDTH / 8);
+    }
+    if (gram_sent_valid)
+    {
+        ui_refresh_mark_colors();
+    }
+    color_ctx_sent = color_ctx;
+    if (full_screen)
+    {
+        gram_sent_valid = true; // 整屏发送后显存与gram_sent一致
+    }
+
+    refresh_rect.x     = 0;
+    refresh_rect.w     = LCD_WIDTH;
+    refresh_rect.h     = 0;
+    refresh_rows_sent  = 0;
+    refresh_runs       = 0;
+    refresh_bytes_sent = 0;
+    refresh_start_tick = app_timer_cnt_get();
+    refresh_active     = true;
+
+    energy_begin(ENERGY_LCD_REFRESH);
+    ui_refresh_next_run();
 
     return 0;
 }
 
-/**检查是否刷新完成 */
+/**检查是否刷新完成, 在此转换后续的行, 一段发送完成后开始下一段, 设置窗口不能在SPI中断中进行 */
 uint8_t ui_refresh_done(void)
 {
-    return refresh_rect.h == 0;
+    ui_refresh_pump();
+    if (refresh_rect.h != 0 || write_buf_full != 0 || spi_get_busy_state())
+    {
+        return 0;
+    }
+    if (refresh_active && ui_refresh_next_run())
+    {
+        return 0;
+    }
+    if (refresh_active)
+    {
+        refresh_active = false;
+        energy_end(ENERGY_LCD_REFRESH);
+        if (refresh_runs != 0)
+        {
+            lcd_mode_wake(); // 从刷新完成开始计算静止时间
+        }
+        dlog_d(UI, "ui refresh page %d: %d rows in %d runs, %d bytes, %d ms\n",
+               refresh_page,
+               refresh_rows_sent,
+               refresh_runs,
+               refresh_bytes_sent + refresh_runs * UI_WINDOW_CMD_BYTES,
+               app_timer_cnt_diff_compute(app_timer_cnt_get(), refresh_start_tick) * 1000 * (APP_TIMER_CONFIG_RTC_FREQUENCY + 1) / APP_TIMER_CLOCK_FREQ);
+    }
+    return 1;
 }
 
 /**
@@ -286,55 +667,169 @@ void ui_draw_bkg(void)
     memset(gram, 0, LCD_HIGHT * LCD_WIDTH / 8);
 }
 
+/** 位块传送的方式 */
+typedef enum
+{
+    UI_BLIT_COPY = 0, // 元素的像素覆盖区域
+    UI_BLIT_XOR,      // 元素设置的像素反色
+    UI_BLIT_SET,      // 区域填充前景, 等同全1位图的COPY
+    UI_BLIT_CLR,      // 区域清除为背景, 等同全0位图的COPY
+} ui_blit_op_t;
+
+/** 游程编码中表示游程未结束的值, 格式见tools/ui_rle.py */
+#define UI_RLE_RUN_EXT 15
+
+/** 游程编码位图的流式解码状态 */
+typedef struct
+{
+    const uint8_t *src;   // 下一个游程所在字节
+    uint8_t        high;  // 下一个游程在高4位
+    uint8_t        next;  // 下一个游程的像素值
+    uint8_t        color; // 当前游程的像素值
+    uint8_t        left;  // 当前游程剩余像素
+} ui_rle_t;
+
 /**
- * @brief 绘制元素,仅仅绘制到画布，颜色在写入显存时才赋值
+ * @brief 从游程编码位图中解码出接下来的len字节, 与原始位图的字节一致
  *
- * @param elem
+ * @param rle 解码状态
+ * @param dst 输出
+ * @param len 字节数
  */
-void ui_draw_elem(ui_elem_t *elem)
+static void ui_rle_read(ui_rle_t *rle, uint8_t *dst, uint8_t len)
 {
-    for (uint8_t row = 0; row < elem->rect.h; row++)
+    uint8_t run, n;
+
+    for (uint8_t i = 0; i < len; i++)
     {
-        for (uint8_t col = 0; col < elem->rect.w; col++)
+        dst[i] = 0;
+        for (uint8_t b = 0; b < 8; b += n)
         {
-            if (PIX_IS_SET(elem, row, col))
+            while (rle->left == 0)
             {
-                GRAM_SET_PIX(row + elem->rect.y, col + elem->rect.x);
+                run = rle->high ? *rle->src++ >> 4 : *rle->src & 0x0F;
+                rle->high ^= 1;
+                rle->left  = run;
+                rle->color = rle->next;
+                if (run != UI_RLE_RUN_EXT)
+                {
+                    rle->next ^= 1;
+                }
             }
-            else
+
+            n = rle->left < 8 - b ? rle->left : 8 - b;
+            if (rle->color)
             {
-                GRAM_CLR_PIX(row + elem->rect.y, col + elem->rect.x);
+                dst[i] |= (uint8_t)(((1 << n) - 1) << b);
             }
+            rle->left -= n;
         }
     }
 }
 
 /**
- * @brief 以反色绘制元素
+ * @brief 将1bit位图按字节移位和掩码写入画布, 超出画布的部分裁剪掉
  *
- * @param elem
+ * @param rect 区域
+ * @param pix 位图, 行优先, 每行(rect->w + 7) / 8字节; UI_BLIT_SET和UI_BLIT_CLR不使用
+ * @param rle pix为游程编码, 逐行解码后写入
+ * @param op 方式
  */
-void ui_draw_elem_inverted(ui_elem_t *elem)
+static void ui_blit(const ui_rect_t *rect, const uint8_t *pix, uint8_t rle, ui_blit_op_t op)
 {
-    for (uint8_t row = 0; row < elem->rect.h; row++)
+    uint8_t        stride = (rect->w + 7) / 8;
+    uint8_t        w      = rect->w;
+    uint8_t        bits, n, sh, *dst;
+    uint16_t       pos, mask, data;
+    uint8_t        line[32]; // 解码出的一行, 最宽255像素
+    const uint8_t *src     = NULL;
+    ui_rle_t       decoder = {.src = pix};
+
+    if (rect->x >= LCD_WIDTH)
+    {
+        return;
+    }
+    if (rect->x + w > LCD_WIDTH)
     {
-        for (uint8_t col = 0; col < elem->rect.w; col++)
+        w = LCD_WIDTH - rect->x;
+    }
+
+    for (uint8_t row = 0; row < rect->h && rect->y + row < LCD_HIGHT; row++)
+    {
+        if (rle && (op == UI_BLIT_COPY || op == UI_BLIT_XOR))
+        {
+            ui_rle_read(&decoder, line, stride); // 裁剪掉的列也要解码, 保持流的位置
+            src = line;
+        }
+        else if (op == UI_BLIT_COPY || op == UI_BLIT_XOR)
         {
-            if (PIX_IS_SET(elem, row, col))
+            src = pix + row * stride;
+        }
+
+        for (uint8_t k = 0; k * 8 < w; k++)
+        {
+            n = w - k * 8 > 8 ? 8 : w - k * 8;
+            if (op == UI_BLIT_SET)
             {
-                if (GRAM_GET_PIX(row + elem->rect.y, col + elem->rect.x))
-                {
-                    GRAM_CLR_PIX(row + elem->rect.y, col + elem->rect.x);
-                }
-                else
-                {
-                    GRAM_SET_PIX(row + elem->rect.y, col + elem->rect.x);
-                }
+                bits = 0xFF;
+            }
+            else if (op == UI_BLIT_CLR)
+            {
+                bits = 0;
+            }
+            else
+            {
+                bits = src[k];
+            }
+            bits &= (uint8_t)((1 << n) - 1);
+
+            pos = rect->x + k * 8;
+            dst = &gram[rect->y + row][pos / 8];
+            sh  = pos % 8;
+
+            if (sh == 0 && n == 8) // 字节对齐, 整字节写入
+            {
+                dst[0] = (op == UI_BLIT_XOR) ? dst[0] ^ bits : bits;
+                continue;
+            }
+
+            // 移位后最多跨两个字节, 裁剪保证仍在本行内
+            mask = (uint16_t)((1 << n) - 1) << sh;
+            data = (uint16_t)bits << sh;
+            if (op == UI_BLIT_XOR)
+            {
+                dst[0] ^= (uint8_t)data;
+                if (mask >> 8) dst[1] ^= (uint8_t)(data >> 8);
+            }
+            else
+            {
+                dst[0] = (dst[0] & ~(uint8_t)mask) | (uint8_t)data;
+                if (mask >> 8) dst[1] = (dst[1] & ~(uint8_t)(mask >> 8)) | (uint8_t)(data >> 8);
             }
         }
     }
 }
 
+/**
+ * @brief 绘制元素,仅仅绘制到画布，颜色在写入显存时才赋值
+ *
+ * @param elem
+ */
+void ui_draw_elem(ui_elem_t *elem)
+{
+    ui_blit(&elem->rect, elem->pix, elem->rle, UI_BLIT_COPY);
+}
+
+/**
+ * @brief 以反色绘制元素
+ *
+ * @param elem
+ */
+void ui_draw_elem_inverted(ui_elem_t *elem)
+{
+    ui_blit(&elem->rect, elem->pix, elem->rle, UI_BLIT_XOR);
+}
+
 /**
  * @brief 以背景色清除区域
  *
@@ -342,13 +837,7 @@ void ui_draw_elem_inverted(ui_elem_t *elem)
  */
 void ui_undraw_rect(ui_rect_t *rect)
 {
-    for (uint8_t row = 0; row < rect->h; row++)
-    {
-        for (uint8_t col = 0; col < rect->w; col++)
-        {
-            GRAM_CLR_PIX(row + rect->y, col + rect->x);
-        }
-    }
+    ui_blit(rect, NULL, 0, UI_BLIT_CLR);
 }
 
 /**
@@ -358,13 +847,7 @@ void ui_undraw_rect(ui_rect_t *rect)
  */
 void ui_draw_fill_rect(ui_rect_t *rect)
 {
-    for (uint8_t row = 0; row < rect->h; row++)
-    {
-        for (uint8_t col = 0; col < rect->w; col++)
-        {
-            GRAM_SET_PIX(row + rect->y, col + rect->x);
-        }
-    }
+    ui_blit(rect, NULL, 0, UI_BLIT_SET);
 }
 
 /**
@@ -586,10 +1069,10 @@ void ui_draw_co2_ppm(uint16_t ppm, ui_bool_t visible)
         ppm_10x   = (ppm % 100) / 10;
         ppm_1x    = ppm % 10;
 
-        elem_ppm_1000x.pix = (uint8_t *)pix_co2_ppm_num[ppm_1000x];
-        elem_ppm_100x.pix  = (uint8_t *)pix_co2_ppm_num[ppm_100x];
-        elem_ppm_10x.pix   = (uint8_t *)pix_co2_ppm_num[ppm_10x];
-        elem_ppm_1x.pix    = (uint8_t *)pix_co2_ppm_num[ppm_1x];
+        elem_ppm_1000x.pix = UI_RLE_PIX(pix_co2_ppm_num, ppm_1000x);
+        elem_ppm_100x.pix  = UI_RLE_PIX(pix_co2_ppm_num, ppm_100x);
+        elem_ppm_10x.pix   = UI_RLE_PIX(pix_co2_ppm_num, ppm_10x);
+        elem_ppm_1x.pix    = UI_RLE_PIX(pix_co2_ppm_num, ppm_1x);
 
         ui_draw_elem(&elem_ppm_1000x);
         ui_draw_elem(&elem_ppm_100x);
@@ -702,9 +1185,10 @@ void ui_draw_sensor_error(void)
     ui_draw_text(-1, -1, "SENSOR ERROR", true);
     ui_draw_text(-1, 96, error_str, true);
 
-    // This display only shows on 3rd error (error_count >= 2)
-    // 1st and 2nd errors are handled silently in background
-    ui_draw_text(-1, 116, "REBOOTING...", true);
+    // This display only shows in degraded mode (error_count == CO2_RECOVERY_DEGRADED),
+    // the earlier recovery stages run silently in background and the sensor is retried periodically
+    (void)error_count;
+    ui_draw_text(-1, 116, "RETRYING...", true);
 }
 
 /**
@@ -719,9 +1203,9 @@ void ui_draw_recalibrating_countdown(uint16_t seconds)
     sec_10x  = (seconds % 100) / 10;
     sec_1x   = seconds % 10;
 
-    elem_cali_time_100x.pix = (uint8_t *)pix_co2_ppm_num[sec_100x];
-    elem_cali_time_10x.pix  = (uint8_t *)pix_co2_ppm_num[sec_10x];
-    elem_cali_time_1x.pix   = (uint8_t *)pix_co2_ppm_num[sec_1x];
+    elem_cali_time_100x.pix = UI_RLE_PIX(pix_co2_ppm_num, sec_100x);
+    elem_cali_time_10x.pix  = UI_RLE_PIX(pix_co2_ppm_num, sec_10x);
+    elem_cali_time_1x.pix   = UI_RLE_PIX(pix_co2_ppm_num, sec_1x);
 
     ui_draw_elem(&elem_cali_time_100x);
     ui_draw_elem(&elem_cali_time_10x);
@@ -736,11 +1220,11 @@ void ui_draw_cc_value(int16_t cc)
     int16_t cc_abs = (cc > 0) ? cc : -cc;
     if (cc > 0)
     {
-        elem_cali_sign_1000x.pix = (uint8_t *)pix_co2_ppm_num[11];
+        elem_cali_sign_1000x.pix = UI_RLE_PIX(pix_co2_ppm_num, 11);
     }
     else
     {
-        elem_cali_sign_1000x.pix = (uint8_t *)pix_co2_ppm_num[10];
+        elem_cali_sign_1000x.pix = UI_RLE_PIX(pix_co2_ppm_num, 10);
     }
 
     uint8_t cc_100x, cc_10x, cc_1x;
@@ -750,9 +1234,9 @@ void ui_draw_cc_value(int16_t cc)
 
     print("CC: 100: %d 10: %d 1:%d, isPositive: %d ", cc_100x, cc_10x, cc_1x, cc > 0);
 
-    elem_cali_time_100x.pix = (uint8_t *)pix_co2_ppm_num[cc_100x];
-    elem_cali_time_10x.pix  = (uint8_t *)pix_co2_ppm_num[cc_10x];
-    elem_cali_time_1x.pix   = (uint8_t *)pix_co2_ppm_num[cc_1x];
+    elem_cali_time_100x.pix = UI_RLE_PIX(pix_co2_ppm_num, cc_100x);
+    elem_cali_time_10x.pix  = UI_RLE_PIX(pix_co2_ppm_num, cc_10x);
+    elem_cali_time_1x.pix   = UI_RLE_PIX(pix_co2_ppm_num, cc_1x);
 
     if (cc_abs != 0)
     {
@@ -797,12 +1281,12 @@ void ui_draw_color_plate(void)
  */
 void ui_draw_passkey(uint8_t *key)
 {
-    passkey_100000x.pix = (uint8_t *)pix_passkey_num[key[0]];
-    passkey_10000x.pix  = (uint8_t *)pix_passkey_num[key[1]];
-    passkey_1000x.pix   = (uint8_t *)pix_passkey_num[key[2]];
-    passkey_100x.pix    = (uint8_t *)pix_passkey_num[key[3]];
-    passkey_10x.pix     = (uint8_t *)pix_passkey_num[key[4]];
-    passkey_1x.pix      = (uint8_t *)pix_passkey_num[key[5]];
+    passkey_100000x.pix = UI_RLE_PIX(pix_passkey_num, key[0]);
+    passkey_10000x.pix  = UI_RLE_PIX(pix_passkey_num, key[1]);
+    passkey_1000x.pix   = UI_RLE_PIX(pix_passkey_num, key[2]);
+    passkey_100x.pix    = UI_RLE_PIX(pix_passkey_num, key[3]);
+    passkey_10x.pix     = UI_RLE_PIX(pix_passkey_num, key[4]);
+    passkey_1x.pix      = UI_RLE_PIX(pix_passkey_num, key[5]);
 
     ui_draw_elem(&passkey_100000x);
     ui_draw_elem(&passkey_10000x);
@@ -921,7 +1405,8 @@ void ui_draw_text(int16_t x, int16_t y, const char *text, bool draw)
                     .w = FONT_WIDTH, // Use precomputed width
                     .h = FONT_HEIGHT,
                 },
-                .pix = (uint8_t *)font[*text - 32] // Get font bitmap
+                .pix = UI_RLE_PIX(font, *text - 32), // Get font bitmap
+                .rle = 1,
             };
 
             ui_draw_elem(&elem);            // Draw or clear based on `draw`
@@ -958,36 +1443,7 @@ void ui_draw_bar_graph(void)
 
 uint8_t ui_get_bar_height_from_ppm(uint16_t ppm)
 {
-    uint16_t max_value = cfg_fstorage_get_graph_max_value();
-    uint16_t min_value = cfg_fstorage_get_graph_min_value();
-    uint8_t  height;
-
-    // Ensure ppm is within the range
-    if (ppm < min_value)
-    {
-        // If value is below minimum, don't show any bar
-        return 0;
-    }
-
-    // Calculate height based on the range from min to max
-    if (max_value > min_value)
-    {
-        // Calculate the percentage of the range and apply to bar height
-        height = ((ppm - min_value) * BAR_HEIGHT) / (max_value - min_value);
-    }
-    else
-    {
-        // Prevent division by zero
-        height = 0;
-    }
-
-    // Ensure height doesn't exceed maximum
-    if (height > BAR_HEIGHT)
-    {
-        height = BAR_HEIGHT;
-    }
-
-    return height;
+    return ui_bar_height(ppm, cfg_fstorage_get_graph_min_value(), cfg_fstorage_get_graph_max_value());
 }
 
 void ui_draw_airspot_text(void)
@@ -66,8 +66,12 @@ typedef struct
 {
     ui_rect_t rect;
     uint8_t  *pix; // Pixels (1 bit per pixel, row-major order)
+    uint8_t   rle; // pix is run-length encoded by tools/ui_rle.py (lcd/ui_res_rle.c)
 } ui_elem_t;
 
+/** Entry _i of a run-length encoded 2D bitmap in lcd/ui_res_rle.c */
+#define UI_RLE_PIX(_name, _i) ((uint8_t *)&(_name)[(_name##_idx)[_i]])
+
 /** Get pixel state at specified position */
 #define PIX_IS_SET(_elem, _row, _col) ((*((_elem)->pix + ((_elem)->rect.w + 7) / 8 * (_row) + (_col) / 8)) & (1 << ((_col) % 8)))
 
@@ -97,6 +101,14 @@ typedef struct
 #define BAR_MODE_PPM_Y   44
 #define PLAIN_MODE_PPM_Y 66
 
+/** Bluetooth state, get_ble_state() */
+typedef enum
+{
+    IDLE,
+    CONNECTED,
+    ADVERTISING
+} BleState;
+
 /** Bluetooth connection state, determines the color of the Bluetooth icon */
 extern uint8_t ble_state;
 
@@ -113,12 +125,14 @@ extern const uint8_t pixdash[36];
 extern const uint8_t pix_error_code[42];
 
 /** CO2 PPM elements */
-extern const uint8_t pix_co2_ppm_num[12][220];
-extern ui_elem_t     elem_ppm_1000x, elem_ppm_100x, elem_ppm_10x, elem_ppm_1x;
+extern const uint8_t  pix_co2_ppm_num[];
+extern const uint16_t pix_co2_ppm_num_idx[12];
+extern ui_elem_t      elem_ppm_1000x, elem_ppm_100x, elem_ppm_10x, elem_ppm_1x;
 
 /** Passkey elements */
-extern const uint8_t pix_passkey_num[10][132];
-extern ui_elem_t     passkey_1x, passkey_10x, passkey_100x, passkey_1000x, passkey_10000x, passkey_100000x;
+extern const uint8_t  pix_passkey_num[];
+extern const uint16_t pix_passkey_num_idx[10];
+extern ui_elem_t      passkey_1x, passkey_10x, passkey_100x, passkey_1000x, passkey_10000x, passkey_100000x;
 
 /** Bluetooth icon area */
 extern ui_elem_t     elem_ble;
@@ -145,7 +159,7 @@ extern const uint8_t pix_dnd[54];
 
 /** Power on */
 extern ui_elem_t     elem_power_on_text, elem_down_arrow, elem_airspot_text;
-extern const uint8_t pix_power_on_text[1060], pix_down_arrow[136], pix_airspot_text[500];
+extern const uint8_t pix_power_on_text[], pix_down_arrow[136], pix_airspot_text[];
 extern ui_rect_t     logo_g, logo_y, logo_r;
 /** POWER MODE */
 extern ui_elem_t     elem_power_mode;
@@ -168,14 +182,16 @@ extern const uint8_t pixel_calib_on[32];
 extern ui_rect_t elem_rect_g, elem_rect_y, elem_rect_r;
 
 /** Calibration page elements */
-extern ui_elem_t elem_sensor_error, elem_sensor_error_code, elem_cali_sign_1000x, elem_cali_time_100x, elem_cali_time_10x, elem_cali_time_1x;
+extern ui_elem_t     elem_sensor_error, elem_sensor_error_code, elem_cali_sign_1000x, elem_cali_time_100x, elem_cali_time_10x, elem_cali_time_1x;
+extern const uint8_t pix_sensor_error[];
 
 /** Low battery warning elements */
 extern ui_elem_t elem_bat_low_frame, elem_bat_low_red, elem_bat_low_text;
 
 /** VGA FONT 8 x 16 */
-extern const uint8_t font[96][40];
-extern const uint8_t font_widths[96];
+extern const uint8_t  font[];
+extern const uint16_t font_idx[96];
+extern const uint8_t  font_widths[96];
 
 /** Get error code */
 extern uint8_t get_error_code(void);
@@ -195,12 +211,21 @@ ui_bool_t get_screen_const_on_state(void);
 /** Get UI idle state, only draw when idle */
 uint8_t ui_get_idle_state(void);
 
-/** Refresh specified area of the screen, actually refreshes the entire row each time */
+/** Refresh specified rows of the screen, only the rows and columns changed since the last refresh are sent */
 uint8_t ui_refresh(ui_rect_t *rect);
 
-/** Check if refresh is done */
+/** Check if refresh is done, starts the next run of changed rows */
 uint8_t ui_refresh_done(void);
 
+/** Forget the display RAM content, the next refresh sends every row (done after the off screen page) */
+void ui_refresh_invalidate(void);
+
+/** Called when a refresh starts or completes with the SPI taken, switches the ST7301 back to high power mode (lcd_mode_task.c) */
+void lcd_mode_wake(void);
+
+/** Check if an element of the main page is blinking (ui_task.c) */
+bool ui_is_blinking(void);
+
 /** Clear memory canvas to background color */
 void ui_draw_bkg(void);
 
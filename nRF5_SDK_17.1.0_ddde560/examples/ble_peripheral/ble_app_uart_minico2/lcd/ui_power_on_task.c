@@ -98,6 +98,7 @@ TaskDefine(task_power_on)
             .y = LCD_HIGHT - 1,
             .h = 1,
         };
+        ui_refresh_invalidate(); // unchanged rows are skipped, send the last row again
         LCD_REFRESH(&rect);
         LCD_RELEASE();
         LCD_BL_ON();
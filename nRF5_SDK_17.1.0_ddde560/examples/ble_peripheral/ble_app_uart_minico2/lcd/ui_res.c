@@ -87,23 +87,6 @@ ui_elem_t elem_time_m0 = {
     .pix = NULL, // 待绘制时间函数赋值
 };
 
-// co2_ppm数值,校准倒计时数值
-const uint8_t pix_co2_ppm_num[12][220] CODE_SECTION = {
-    //  0(0) 1(1) 2(2) 3(3) 4(4) 5(5) 6(6) 7(7) 8(8) 9(9)
-    {0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0x00, 0xFE, 0xFF, 0x0F, 0x00, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0x80, 0x3F, 0xC0, 0x1F, 0x00, 0xC0, 0x1F, 0x80, 0x3F, 0x00, 0xC0, 0x0F, 0x00, 0x7F, 0x00, 0xE0, 0x07, 0x00, 0x7E, 0x00, 0xE0, 0x07, 0x00, 0xFC, 0x00, 0xF0, 0x03, 0x00, 0xFC, 0x00, 0xF0, 0x03, 0x00, 0xF8, 0x00, 0xF0, 0x01, 0x00, 0xF8, 0x01, 0xF0, 0x01, 0x00, 0xF8, 0x01, 0xF8, 0x01, 0x00, 0xF0, 0x01, 0xF8, 0x00, 0x00, 0xF0, 0x01, 0xF8, 0x00, 0x00, 0xF0, 0x01, 0xF8, 0x00, 0x00, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0xF0, 0x01, 0xF8, 0x01, 0x00, 0xF0, 0x01, 0xF8, 0x01, 0x00, 0xF0, 0x01, 0xF0, 0x01, 0x00, 0xF8, 0x01, 0xF0, 0x01, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0x00, 0xF8, 0x00, 0xF0, 0x03, 0x00, 0xFC, 0x00, 0xE0, 0x07, 0x00, 0x7C, 0x00, 0xE0, 0x07, 0x00, 0x7E, 0x00, 0xC0, 0x0F, 0x00, 0x3F, 0x00, 0x80, 0x1F, 0x80, 0x3F, 0x00, 0x80, 0x7F, 0xE0, 0x1F, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xFE, 0xFF, 0x07, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00}, /*"0",0*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0xC0, 0xFF, 0x07, 0x00, 0x00, 0xE0, 0xCF, 0x07, 0x00, 0x00, 0xF8, 0xC7, 0x07, 0x00, 0x00, 0xF8, 0xC3, 0x07, 0x00, 0x00, 0xF8, 0xC0, 0x07, 0x00, 0x00, 0x78, 0xC0, 0x07, 0x00, 0x00, 0x38, 0xC0, 0x07, 0x00, 0x00, 0x08, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"1",1*/
-    {0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x80, 0xFF, 0xFF, 0x07, 0x00, 0xC0, 0xFF, 0xFF, 0x0F, 0x00, 0xC0, 0x1F, 0xE0, 0x1F, 0x00, 0xE0, 0x07, 0x80, 0x1F, 0x00, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0xF0, 0x01, 0x00, 0x3E, 0x00, 0xF8, 0x01, 0x00, 0x7E, 0x00, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x7F, 0x00, 0xF8, 0xFF, 0xFF, 0x7F, 0x00, 0xF8, 0xFF, 0xFF, 0x7F, 0x00, 0xF8, 0xFF, 0xFF, 0x7F, 0x00, 0xF8, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"2",2*/
-    {0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x80, 0xFF, 0xFF, 0x07, 0x00, 0xC0, 0xFF, 0xFF, 0x0F, 0x00, 0xC0, 0x1F, 0xC0, 0x1F, 0x00, 0xE0, 0x07, 0x80, 0x3F, 0x00, 0xE0, 0x03, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0x00, 0x3E, 0x00, 0xF0, 0x01, 0x00, 0x7E, 0x00, 0xF0, 0x01, 0x00, 0x7E, 0x00, 0xF0, 0x01, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0xF0, 0xFF, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0xF0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0xF8, 0x01, 0x00, 0xFC, 0x00, 0xF8, 0x01, 0x00, 0xFC, 0x00, 0xF0, 0x03, 0x00, 0x7E, 0x00, 0xF0, 0x07, 0x00, 0x7F, 0x00, 0xE0, 0x1F, 0xC0, 0x3F, 0x00, 0xC0, 0xFF, 0xFF, 0x1F, 0x00, 0x80, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00}, /*"3",3*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0x7C, 0x1F, 0x00, 0x00, 0x00, 0x3E, 0x1F, 0x00, 0x00, 0x00, 0x3F, 0x1F, 0x00, 0x00, 0x80, 0x1F, 0x1F, 0x00, 0x00, 0x80, 0x0F, 0x1F, 0x00, 0x00, 0xC0, 0x0F, 0x1F, 0x00, 0x00, 0xE0, 0x07, 0x1F, 0x00, 0x00, 0xE0, 0x03, 0x1F, 0x00, 0x00, 0xF0, 0x03, 0x1F, 0x00, 0x00, 0xF8, 0x01, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0xFC, 0x00, 0x1F, 0x00, 0x00, 0x7E, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x80, 0x0F, 0x00, 0x1F, 0x00, 0xC0, 0x0F, 0x00, 0x1F, 0x00, 0xC0, 0x07, 0x00, 0x1F, 0x00, 0xE0, 0x03, 0x00, 0x1F, 0x00, 0xF0, 0x03, 0x00, 0x1F, 0x00, 0xF0, 0x01, 0x00, 0x1F, 0x00, 0xF8, 0x01, 0x00, 0x1F, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0xFC, 0x00, 0x00, 0x1F, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x07, 0xFC, 0xFF, 0xFF, 0xFF, 0x07, 0xFC, 0xFF, 0xFF, 0xFF, 0x07, 0xFC, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"4",4*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x7F, 0x00, 0xC0, 0xFF, 0xFF, 0x7F, 0x00, 0xC0, 0xFF, 0xFF, 0x7F, 0x00, 0xC0, 0xFF, 0xFF, 0x7F, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x7F, 0x00, 0x00, 0xE0, 0xE3, 0xFF, 0x01, 0x00, 0xE0, 0xFB, 0xFF, 0x07, 0x00, 0xE0, 0xFF, 0xFF, 0x0F, 0x00, 0xE0, 0xFF, 0xFF, 0x1F, 0x00, 0xF0, 0x3F, 0xC0, 0x3F, 0x00, 0xF0, 0x0F, 0x00, 0x7F, 0x00, 0xF0, 0x07, 0x00, 0xFE, 0x00, 0xF0, 0x03, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0xF0, 0x01, 0xF8, 0x01, 0x00, 0xF0, 0x01, 0xF0, 0x01, 0x00, 0xF8, 0x01, 0xF0, 0x01, 0x00, 0xF8, 0x00, 0xF0, 0x03, 0x00, 0xFC, 0x00, 0xF0, 0x03, 0x00, 0xFC, 0x00, 0xE0, 0x07, 0x00, 0x7E, 0x00, 0xE0, 0x0F, 0x00, 0x7F, 0x00, 0xC0, 0x3F, 0xC0, 0x3F, 0x00, 0x80, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00}, /*"5",5*/
-    {0x00, 0x80, 0x7F, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x03, 0x00, 0x00, 0xFC, 0xFF, 0x0F, 0x00, 0x00, 0xFE, 0xFF, 0x1F, 0x00, 0x00, 0xFF, 0xFF, 0x3F, 0x00, 0x80, 0x7F, 0x80, 0x7F, 0x00, 0x80, 0x1F, 0x00, 0x7E, 0x00, 0xC0, 0x0F, 0x00, 0xFC, 0x00, 0xE0, 0x07, 0x00, 0xF8, 0x00, 0xE0, 0x07, 0x00, 0xF8, 0x01, 0xE0, 0x03, 0x00, 0xF0, 0x01, 0xF0, 0x03, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0xC0, 0xFF, 0x03, 0x00, 0xF8, 0xF0, 0xFF, 0x07, 0x00, 0xF8, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0xFC, 0xFF, 0x3F, 0x00, 0xF8, 0x7E, 0xC0, 0x7F, 0x00, 0xF8, 0x1F, 0x00, 0x7F, 0x00, 0xF8, 0x0F, 0x00, 0xFC, 0x00, 0xF8, 0x07, 0x00, 0xFC, 0x01, 0xF8, 0x03, 0x00, 0xF8, 0x01, 0xF8, 0x03, 0x00, 0xF0, 0x01, 0xF8, 0x01, 0x00, 0xF0, 0x01, 0xF8, 0x01, 0x00, 0xF0, 0x03, 0xF8, 0x01, 0x00, 0xF0, 0x03, 0xF8, 0x01, 0x00, 0xF0, 0x03, 0xF0, 0x01, 0x00, 0xF0, 0x03, 0xF0, 0x01, 0x00, 0xF0, 0x03, 0xF0, 0x03, 0x00, 0xF0, 0x01, 0xF0, 0x03, 0x00, 0xF8, 0x01, 0xE0, 0x03, 0x00, 0xF8, 0x01, 0xE0, 0x07, 0x00, 0xFC, 0x00, 0xC0, 0x0F, 0x00, 0xFE, 0x00, 0x80, 0x1F, 0x00, 0x7F, 0x00, 0x80, 0x7F, 0xC0, 0x7F, 0x00, 0x00, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xFE, 0xFF, 0x0F, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00}, /*"6",6*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x3F, 0x00, 0xFC, 0xFF, 0xFF, 0x3F, 0x00, 0xFC, 0xFF, 0xFF, 0x3F, 0x00, 0xFC, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"7",7*/
-    {0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0x00, 0xFE, 0xFF, 0x07, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0x00, 0x80, 0xFF, 0xFF, 0x1F, 0x00, 0xC0, 0x1F, 0xC0, 0x3F, 0x00, 0xE0, 0x0F, 0x00, 0x7F, 0x00, 0xE0, 0x07, 0x00, 0x7E, 0x00, 0xE0, 0x03, 0x00, 0x7C, 0x00, 0xF0, 0x03, 0x00, 0x7C, 0x00, 0xF0, 0x03, 0x00, 0xFC, 0x00, 0xF0, 0x03, 0x00, 0xFC, 0x00, 0xF0, 0x03, 0x00, 0x7C, 0x00, 0xE0, 0x03, 0x00, 0x7C, 0x00, 0xE0, 0x03, 0x00, 0x7C, 0x00, 0xE0, 0x07, 0x00, 0x7E, 0x00, 0xC0, 0x0F, 0x00, 0x3F, 0x00, 0x80, 0x1F, 0x80, 0x1F, 0x00, 0x00, 0xFF, 0xF0, 0x0F, 0x00, 0x00, 0xFE, 0xFF, 0x07, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x07, 0x00, 0x80, 0xFF, 0xFF, 0x0F, 0x00, 0xC0, 0x7F, 0xE0, 0x3F, 0x00, 0xE0, 0x0F, 0x00, 0x7F, 0x00, 0xF0, 0x07, 0x00, 0x7E, 0x00, 0xF0, 0x03, 0x00, 0xFC, 0x00, 0xF8, 0x01, 0x00, 0xF8, 0x01, 0xF8, 0x00, 0x00, 0xF8, 0x01, 0xF8, 0x00, 0x00, 0xF0, 0x01, 0xF8, 0x00, 0x00, 0xF0, 0x01, 0xF8, 0x00, 0x00, 0xF0, 0x01, 0xF8, 0x00, 0x00, 0xF0, 0x01, 0xF8, 0x00, 0x00, 0xF0, 0x01, 0xF8, 0x01, 0x00, 0xF8, 0x01, 0xF8, 0x01, 0x00, 0xFC, 0x01, 0xF0, 0x03, 0x00, 0xFC, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xE0, 0x3F, 0xC0, 0x7F, 0x00, 0xC0, 0xFF, 0xFF, 0x3F, 0x00, 0x80, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xFE, 0xFF, 0x07, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00}, /*"8",8*/
-    {0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x00, 0x80, 0xFF, 0xFF, 0x07, 0x00, 0xC0, 0xFF, 0xFF, 0x0F, 0x00, 0xE0, 0x1F, 0xE0, 0x1F, 0x00, 0xF0, 0x0F, 0x80, 0x3F, 0x00, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0xF8, 0x01, 0x00, 0x7E, 0x00, 0xF8, 0x01, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0x00, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0xF8, 0x01, 0xFC, 0x00, 0x00, 0xF8, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0x01, 0xF8, 0x01, 0x00, 0xFE, 0x01, 0xF8, 0x03, 0x00, 0xFE, 0x01, 0xF0, 0x07, 0x00, 0xFF, 0x01, 0xE0, 0x0F, 0xC0, 0xFF, 0x01, 0xE0, 0x7F, 0xF0, 0xF7, 0x01, 0xC0, 0xFF, 0xFF, 0xF3, 0x01, 0x80, 0xFF, 0xFF, 0xF1, 0x01, 0x00, 0xFE, 0xFF, 0xF0, 0x01, 0x00, 0xF8, 0x1F, 0xF0, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0x00, 0x7E, 0x00, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0xF0, 0x03, 0x00, 0x3F, 0x00, 0xE0, 0x0F, 0xC0, 0x1F, 0x00, 0xE0, 0x1F, 0xF0, 0x0F, 0x00, 0xC0, 0xFF, 0xFF, 0x07, 0x00, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xFE, 0xFF, 0x01, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00}, /*"9",9*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"-",-*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"+",+*/
-};
-
 // CO2的PPM数值剧中显示的x起始坐标
 #define CO2_PPM_YS     GRAPH_MODE_PPM_Y
 #define CO2_PPM_CHAR_W 36
@@ -126,6 +109,7 @@ ui_elem_t elem_ppm_1000x = {
         .h = CO2_PPM_CHAR_H,
     },
     .pix = NULL, // 待绘制时间函数赋值
+    .rle = 1,
 };
 
 // PPM 显示数值百位
@@ -137,6 +121,7 @@ ui_elem_t elem_ppm_100x = {
         .h = CO2_PPM_CHAR_H,
     },
     .pix = NULL, // 待绘制时间函数赋值
+    .rle = 1,
 };
 
 // PPM 显示数值十位
@@ -148,6 +133,7 @@ ui_elem_t elem_ppm_10x = {
         .h = CO2_PPM_CHAR_H,
     },
     .pix = NULL, // 待绘制时间函数赋值
+    .rle = 1,
 };
 
 // PPM 显示数值个位
@@ -159,21 +145,7 @@ ui_elem_t elem_ppm_1x = {
         .h = CO2_PPM_CHAR_H,
     },
     .pix = NULL, // 待绘制时间函数赋值
-};
-
-// passkey数值,校准倒计时数值
-const uint8_t pix_passkey_num[10][132] CODE_SECTION = {
-    // 0(0)1(1)2(2)3(3)4(4)5(5)6(6)7(7)8(8)9(9)
-    {0x00, 0x20, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0xE0, 0x07, 0x3F, 0x00, 0xE0, 0x01, 0x3C, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x78, 0x00, 0xF8, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xE0, 0x01, 0x3C, 0x00, 0xE0, 0x01, 0x3C, 0x00, 0xE0, 0x01, 0x3C, 0x00, 0xE0, 0x01, 0x3C, 0x00, 0xE0, 0x01, 0x3C, 0x00, 0xE0, 0x01, 0x3C, 0x00, 0xE0, 0x01, 0x3C, 0x00, 0xE0, 0x01, 0x3C, 0x00, 0xE0, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x78, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0xF0, 0x01, 0x3C, 0x00, 0xE0, 0x07, 0x3F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0x20, 0x00, 0x00}, /*"0",0*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0xF8, 0x3C, 0x00, 0x00, 0x7C, 0x3C, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x0C, 0x3C, 0x00, 0x00, 0x04, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"1",1*/
-    {0x00, 0x10, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0xC0, 0xFF, 0x07, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0xF0, 0x81, 0x1F, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x38, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x80, 0x0F, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x7F, 0x00, 0xF8, 0xFF, 0x7F, 0x00, 0xF8, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"2",2*/
-    {0x00, 0x10, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0xC0, 0xFF, 0x07, 0x00, 0xE0, 0xFF, 0x1F, 0x00, 0xF0, 0x01, 0x1F, 0x00, 0xF0, 0x00, 0x3E, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x78, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0xF0, 0x01, 0x3F, 0x00, 0xF0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x00, 0x30, 0x00, 0x00}, /*"3",3*/
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0xF0, 0x1E, 0x00, 0x00, 0xF8, 0x1E, 0x00, 0x00, 0x78, 0x1E, 0x00, 0x00, 0x3C, 0x1E, 0x00, 0x00, 0x3E, 0x1E, 0x00, 0x00, 0x1E, 0x1E, 0x00, 0x00, 0x0F, 0x1E, 0x00, 0x80, 0x0F, 0x1E, 0x00, 0x80, 0x07, 0x1E, 0x00, 0xC0, 0x03, 0x1E, 0x00, 0xC0, 0x03, 0x1E, 0x00, 0xE0, 0x01, 0x1E, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x38, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0xFC, 0xFF, 0xFF, 0x01, 0xFC, 0xFF, 0xFF, 0x01, 0xFC, 0xFF, 0xFF, 0x01, 0xFC, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"4",4*/
-    {0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x3F, 0x00, 0xE0, 0xFF, 0x3F, 0x00, 0xF0, 0xFF, 0x3F, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x70, 0xFC, 0x07, 0x00, 0x78, 0xFF, 0x0F, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0xF8, 0x03, 0x3F, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x78, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0xF0, 0x03, 0x3F, 0x00, 0xE0, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x30, 0x00, 0x00}, /*"5",5*/
-    {0x00, 0x60, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0x3F, 0x00, 0xE0, 0x07, 0x7E, 0x00, 0xE0, 0x01, 0x7C, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0xFC, 0x07, 0x00, 0x3C, 0xFE, 0x0F, 0x00, 0xBC, 0xFF, 0x3F, 0x00, 0xFC, 0x07, 0x7F, 0x00, 0xFC, 0x01, 0x7C, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0xFC, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0xE0, 0x01, 0x7C, 0x00, 0xE0, 0x01, 0x78, 0x00, 0xE0, 0x01, 0x78, 0x00, 0xE0, 0x01, 0x78, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0xE0, 0x01, 0x7C, 0x00, 0xE0, 0x07, 0x7E, 0x00, 0xC0, 0xFF, 0x3F, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x60, 0x00, 0x00}, /*"6",6*/
-    {0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x3F, 0x00, 0xFC, 0xFF, 0x3F, 0x00, 0xFC, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"7",7*/
-    {0x00, 0x30, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0xE0, 0xFF, 0x1F, 0x00, 0xF0, 0x03, 0x3F, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF8, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x78, 0x00, 0xF0, 0x01, 0x3C, 0x00, 0xE0, 0x03, 0x1F, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0xFF, 0x03, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0xE0, 0xFF, 0x3F, 0x00, 0xF0, 0x01, 0x7E, 0x00, 0xF8, 0x00, 0x78, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0xF0, 0x03, 0x7E, 0x00, 0xF0, 0xFF, 0x3F, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x30, 0x00, 0x00}, /*"8",8*/
-    {0x00, 0x38, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0xC0, 0xFF, 0x07, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0xF0, 0x03, 0x1F, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0xF8, 0x00, 0x3C, 0x00, 0xF8, 0x00, 0x78, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0xEE, 0x00, 0xF0, 0x83, 0xEF, 0x00, 0xE0, 0xFF, 0xE7, 0x00, 0xC0, 0xFF, 0xF3, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x70, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x78, 0x00, 0x78, 0x00, 0x3C, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0xF0, 0x81, 0x1F, 0x00, 0xE0, 0xFF, 0x0F, 0x00, 0xC0, 0xFF, 0x07, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00}, /*"9",9*/
+    .rle = 1,
 };
 
 // passkey数值剧中显示的x起始坐标
@@ -191,6 +163,7 @@ ui_elem_t passkey_1x = {
         .h = PASSKEY_CHAR_H,
     },
     .pix = NULL, // 待绘制时间函数赋值
+    .rle = 1,
 };
 
 // passkey 显示数值10位
@@ -202,6 +175,7 @@ ui_elem_t passkey_10x = {
         .h = PASSKEY_CHAR_H,
     },
     .pix = NULL, // 待绘制时间函数赋值
+    .rle = 1,
 };
 
 // passkey 显示数值100位
@@ -213,6 +187,7 @@ ui_elem_t passkey_100x = {
         .h = PASSKEY_CHAR_H,
     },
     .pix = NULL, // 待绘制时间函数赋值
+    .rle = 1,
 };
 
 // passkey 显示数值1000位
@@ -224,6 +199,7 @@ ui_elem_t passkey_1000x = {
         .h = PASSKEY_CHAR_H,
     },
     .pix = NULL, // 待绘制时间函数赋值
+    .rle = 1,
 };
 
 // passkey 显示数值10000位
@@ -235,6 +211,7 @@ ui_elem_t passkey_10000x = {
         .h = PASSKEY_CHAR_H,
     },
     .pix = NULL, // 待绘制时间函数赋值
+    .rle = 1,
 };
 
 // passkey 显示数值100000位
@@ -246,6 +223,7 @@ ui_elem_t passkey_100000x = {
         .h = PASSKEY_CHAR_H,
     },
     .pix = NULL, // 待绘制时间函数赋值
+    .rle = 1,
 };
 
 const uint8_t pix_alarm[40] CODE_SECTION     = {0x10, 0x00, 0x30, 0x00, 0x70, 0x00, 0xf0, 0x00, 0xf0, 0x01, 0xf0, 0x03, 0xf0, 0x7f, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0x7f, 0xf0, 0x03, 0xf0, 0x01, 0xf0, 0x00, 0x70, 0x00, 0x30, 0x00, 0x10, 0x00}; /*"D:\projects_tai\二氧化碳检测仪\UI\alarm.bmp",0*/
@@ -422,10 +400,6 @@ ui_elem_t elem_indicator = {
     .pix = (uint8_t *)pix_delta_down,
 };
 
-// pixel for sensor error text
-const uint8_t pix_sensor_error[] CODE_SECTION = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x1f, 0xfc, 0x03, 0xfc, 0x03, 0xf8, 0x01, 0xfe, 0x01, 0x00, 0xfe, 0x1f, 0xfe, 0x07, 0xfe, 0x07, 0xfc, 0x03, 0xff, 0x03, 0x00, 0xfe, 0x1f, 0xff, 0x0f, 0xff, 0x0f, 0xfe, 0x87, 0xff, 0x07, 0x00, 0xfe, 0x1f, 0x8f, 0x1f, 0x8f, 0x1f, 0xff, 0x8f, 0xc7, 0x0f, 0x00, 0x1e, 0x00, 0x0f, 0x1f, 0x0f, 0x1f, 0xff, 0x8f, 0x87, 0x0f, 0x00, 0x1e, 0x00, 0x0f, 0x1f, 0x0f, 0x1f, 0x0f, 0x8f, 0x87, 0x0f, 0x00, 0x1e, 0x00, 0x0f, 0x1f, 0x0f, 0x1f, 0x07, 0x8e, 0x87, 0x0f, 0x00, 0x1e, 0x00, 0x0f, 0x1f, 0x0f, 0x1f, 0x07, 0x8e, 0x87, 0x0f, 0x00, 0xfe, 0x1f, 0x8f, 0x0f, 0x8f, 0x0f, 0x07, 0x8e, 0xc7, 0x07, 0x00, 0xfe, 0x1f, 0xff, 0x07, 0xff, 0x07, 0x07, 0x8e, 0xff, 0x03, 0x00, 0xfe, 0x1f, 0xff, 0x03, 0xff, 0x03, 0x07, 0x8e, 0xff, 0x01, 0x00, 0xfe, 0x1f, 0xff, 0x00, 0xff, 0x00, 0x07, 0x8e, 0x7f, 0x00, 0x00, 0x1e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x07, 0x8e, 0x1f, 0x00, 0x00, 0x1e, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x07, 0x8e, 0x3f, 0x00, 0x00, 0x1e, 0x00, 0xff, 0x00, 0xff, 0x00, 0x07, 0x8e, 0x7f, 0x00, 0x00, 0x1e, 0x00, 0xff, 0x01, 0xff, 0x01, 0x0f, 0x8f, 0xff, 0x00, 0x00, 0xfe, 0x1f, 0xef, 0x03, 0xef, 0x03, 0xff, 0x8f, 0xf7, 0x01, 0x00, 0xfe, 0x1f, 0xcf, 0x07, 0xcf, 0x07, 0xff, 0x8f, 0xe7, 0x03, 0x00, 0xfe, 0x1f, 0x8f, 0x0f, 0x8f, 0x0f, 0xfe, 0x87, 0xc7, 0x07, 0x00, 0xfe, 0x1f, 0x0f, 0x1f, 0x0f, 0x1f, 0xfc, 0x83, 0x87, 0x0f, 0x00, 0xfc, 0x1f, 0x0f, 0x1e, 0x0f, 0x1e, 0xf8, 0x81, 0x07, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x48, 0xa2, 0xe7, 0x79, 0x10, 0x0c, 0x81, 0x29, 0xa1, 0x90, 0x0c, 0x48, 0x92, 0x24, 0x08, 0x10, 0x12, 0x41, 0x5a, 0x81, 0x97, 0x12, 0x78, 0x8a, 0x24, 0x08, 0x7c, 0x12, 0x41, 0x4a, 0xa1, 0x94, 0x12, 0x08, 0x86, 0x27, 0x08, 0x10, 0x12, 0x41, 0x4a, 0xa7, 0x94, 0x0e, 0x08, 0x82, 0xe0, 0x79, 0x10, 0x12, 0x41, 0x4a, 0xa1, 0x94, 0x02, 0x08, 0x82, 0x00, 0x41, 0x10, 0x12, 0x41, 0x4a, 0xa1, 0x94, 0x02, 0x08, 0x82, 0x00, 0x41, 0x10, 0x12, 0x41, 0x4a, 0xa1, 0x94, 0x02, 0x08, 0x82, 0xe7, 0x79, 0xf0, 0x0c, 0x8e, 0x49, 0xaf, 0xf4, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}; /*"D:\projects_tai\二氧化碳检测仪\UI\SFProDisplay\recali.bmp",0*/
-
 const uint8_t pix_error_code[42] CODE_SECTION = {
     0xf8, 0x03, 0xfc, 0x07, 0x0e, 0x0e, 0x07, 0x1c, 0x03, 0x18, 0x03, 0x18, 0x03, 0x18, 0x03, 0x18, 0x03, 0x18, 0x03, 0x18, 0x03, 0x18, 0x03, 0x18, 0x03, 0x18, 0x03, 0x18, 0x03, 0x18, 0x03, 0x18, 0x03, 0x18, 0x07, 0x1c, 0x0e, 0x0e, 0xfc, 0x07, 0xf8, 0x03}; /*"D:\projects_tai\二氧化碳检测仪\UI\SFProDisplay\error_code.bmp",0*/
 
@@ -437,6 +411,7 @@ ui_elem_t elem_sensor_error = {
         .h = 80,
     },
     .pix = (uint8_t *)pix_sensor_error,
+    .rle = 1,
 };
 
 ui_elem_t elem_sensor_error_code = {
@@ -459,6 +434,7 @@ ui_elem_t elem_cali_sign_1000x = {
         .h = CO2_PPM_CHAR_H,
     },
     .pix = NULL, // 等待程序赋值
+    .rle = 1,
 };
 
 ui_elem_t elem_cali_time_100x = {
@@ -469,6 +445,7 @@ ui_elem_t elem_cali_time_100x = {
         .h = CO2_PPM_CHAR_H,
     },
     .pix = NULL, // 等待程序赋值
+    .rle = 1,
 };
 
 ui_elem_t elem_cali_time_10x = {
@@ -479,6 +456,7 @@ ui_elem_t elem_cali_time_10x = {
         .h = CO2_PPM_CHAR_H,
     },
     .pix = NULL, // 等待程序赋值
+    .rle = 1,
 };
 
 ui_elem_t elem_cali_time_1x = {
@@ -489,6 +467,7 @@ ui_elem_t elem_cali_time_1x = {
         .h = CO2_PPM_CHAR_H,
     },
     .pix = NULL, // 等待程序赋值
+    .rle = 1,
 };
 
 /**电量低电池框 */
@@ -635,10 +614,6 @@ ui_elem_t elem_bat_low_text = {
 
 #define COLOR_RECT_Y 36
 
-// 157 x 25
-const uint8_t pix_airspot_text[500] = {
-    0x00, 0x1e, 0x00, 0xc0, 0x07, 0xe0, 0xff, 0x01, 0x00, 0xfc, 0x03, 0xe0, 0x7f, 0x00, 0x00, 0xfe, 0x01, 0xc0, 0xff, 0x1f, 0x00, 0x1e, 0x00, 0xc0, 0x07, 0xe0, 0xff, 0x07, 0x00, 0xfe, 0x07, 0xe0, 0xff, 0x01, 0x80, 0xff, 0x0f, 0xc0, 0xff, 0x1f, 0x00, 0x3f, 0x00, 0xc0, 0x07, 0xe0, 0xff, 0x0f, 0x00, 0x07, 0x0e, 0x60, 0xc0, 0x03, 0xc0, 0x03, 0x3e, 0x00, 0x60, 0x00, 0x00, 0x3f, 0x00, 0xc0, 0x07, 0xe0, 0xff, 0x1f, 0x80, 0x03, 0x1c, 0x60, 0x00, 0x07, 0xe0, 0x00, 0x70, 0x00, 0x60, 0x00, 0x80, 0x7f, 0x00, 0xc0, 0x07, 0xe0, 0xff, 0x1f, 0x80, 0x01, 0x08, 0x60, 0x00, 0x06, 0x70, 0x00, 0xe0, 0x00, 0x60, 0x00, 0x80, 0x7f, 0x00, 0xc0, 0x07, 0xe0, 0x03, 0x3f, 0x80, 0x01, 0x00, 0x60, 0x00, 0x0c, 0x38, 0x00, 0xc0, 0x00, 0x60, 0x00, 0x80, 0x7f, 0x00, 0xc0, 0x07, 0xe0, 0x03, 0x3e, 0x80, 0x01, 0x00, 0x60, 0x00, 0x0c, 0x18, 0x00, 0xc0, 0x01, 0x60, 0x00, 0xc0, 0xf3, 0x00, 0xc0, 0x07, 0xe0, 0x03, 0x3e, 0x80, 0x03, 0x00, 0x60, 0x00, 0x0c, 0x0c, 0x00, 0x80, 0x03, 0x60, 0x00, 0xc0, 0xf3, 0x00, 0xc0, 0x07, 0xe0, 0x03, 0x3e, 0x00, 0x07, 0x00, 0x60, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x03, 0x60, 0x00, 0xc0, 0xe1, 0x00, 0xc0, 0x07, 0xe0, 0x03, 0x3e, 0x00, 0x1e, 0x00, 0x60, 0x00, 0x0c, 0x0c, 0x00, 0x00, 0x03, 0x60, 0x00, 0xe0, 0xe1, 0x01, 0xc0, 0x07, 0xe0, 0x03, 0x3f, 0x00, 0x3c, 0x00, 0x60, 0x00, 0x06, 0x0e, 0x00, 0x00, 0x03, 0x60, 0x00, 0xe0, 0xe1, 0x01, 0xc0, 0x07, 0xe0, 0xff, 0x3f, 0x00, 0xf8, 0x00, 0x60, 0x00, 0x07, 0x06, 0x00, 0x00, 0x03, 0x60, 0x00, 0xe0, 0xe1, 0x01, 0xc0, 0x07, 0xe0, 0xff, 0x1f, 0x00, 0xe0, 0x03, 0x60, 0x80, 0x03, 0x06, 0x00, 0x00, 0x03, 0x60, 0x00, 0xf0, 0xc0, 0x03, 0xc0, 0x07, 0xe0, 0xff, 0x0f, 0x00, 0x80, 0x0f, 0xe0, 0xff, 0x01, 0x06, 0x00, 0x00, 0x03, 0x60, 0x00, 0xf0, 0xc0, 0x03, 0xc0, 0x07, 0xe0, 0xff, 0x07, 0x00, 0x00, 0x1e, 0xe0, 0x7f, 0x00, 0x0e, 0x00, 0x00, 0x03, 0x60, 0x00, 0xf8, 0xff, 0x07, 0xc0, 0x07, 0xe0, 0xff, 0x03, 0x00, 0x00, 0x18, 0x60, 0x00, 0x00, 0x0c, 0x00, 0x80, 0x03, 0x60, 0x00, 0xf8, 0xff, 0x07, 0xc0, 0x07, 0xe0, 0xe3, 0x01, 0x00, 0x00, 0x18, 0x60, 0x00, 0x00, 0x0c, 0x00, 0x80, 0x01, 0x60, 0x00, 0xf8, 0xff, 0x07, 0xc0, 0x07, 0xe0, 0xc3, 0x03, 0x00, 0x00, 0x18, 0x60, 0x00, 0x00, 0x1c, 0x00, 0xc0, 0x01, 0x60, 0x00, 0xfc, 0xff, 0x0f, 0xc0, 0x07, 0xe0, 0xc3, 0x07, 0x00, 0x00, 0x18, 0x60, 0x00, 0x00, 0x18, 0x00, 0xc0, 0x00, 0x60, 0x00, 0x7c, 0x80, 0x0f, 0xc0, 0x07, 0xe0, 0x83, 0x07, 0xc0, 0x00, 0x18, 0x60, 0x00, 0x00, 0x38, 0x00, 0x60, 0x00, 0x60, 0x00, 0x3e, 0x00, 0x1f, 0xc0, 0x07, 0xe0, 0x83, 0x0f, 0xc0, 0x00, 0x0c, 0x60, 0x00, 0x00, 0x70, 0x00, 0x70, 0x00, 0x60, 0x00, 0x3e, 0x00, 0x1f, 0xc0, 0x07, 0xe0, 0x03, 0x0f, 0xc0, 0x03, 0x0c, 0x60, 0x00, 0x00, 0xe0, 0x00, 0x38, 0x00, 0x60, 0x00, 0x3e, 0x00, 0x1f, 0xc0, 0x07, 0xe0, 0x03, 0x1f, 0x80, 0x07, 0x0f, 0x60, 0x00, 0x00, 0xc0, 0x03, 0x1e, 0x00, 0x60, 0x00, 0x1f, 0x00, 0x3e, 0xc0, 0x07, 0xe0, 0x03, 0x3e, 0x00, 0xfe, 0x07, 0x60, 0x00, 0x00, 0x80, 0xff, 0x0f, 0x00, 0x60, 0x00, 0x1f, 0x00, 0x3e, 0xc0, 0x07, 0xe0, 0x03, 0x7c, 0x00, 0xfc, 0x01, 0x60, 0x00, 0x00, 0x00, 0xfe, 0x01, 0x00, 0x60, 0x00};
-
 // 24 x 28
 const uint8_t pix_down_arrow[136] = {
     0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0xff, 0xff, 0xff, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0x1f, 0xf8, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff, 0x07, 0xe0, 0xff, 0xff, 0x03, 0xc0, 0xff, 0xff, 0x01, 0x80, 0xff, 0xff, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x00, 0xfe, 0x3f, 0x00, 0x00, 0xfc, 0x1f, 0x00, 0x00, 0xf8, 0x0f, 0x00, 0x00, 0xf0, 0x07, 0x00, 0x00, 0xe0, 0x03, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00};
@@ -651,6 +626,7 @@ ui_elem_t elem_airspot_text = {
         .h = 25,
     },
     .pix = (uint8_t *)pix_airspot_text,
+    .rle = 1,
 };
 
 // 157 x 53
@@ -662,6 +638,7 @@ ui_elem_t elem_power_on_text = {
         .h = 53,
     },
     .pix = (uint8_t *)pix_power_on_text,
+    .rle = 1,
 };
 
 #define LOGO_RECT_W 50
@@ -723,104 +700,6 @@ ui_elem_t elem_calib_on = {
     },
     .pix = (uint8_t *)pixel_calib_on,
 };
-const uint8_t font[96][40] = {
-    /*   (32) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* ! (33) */ {0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* " (34) */ {0x00, 0x00, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* # (35) */ {0x00, 0x00, 0x00, 0x00, 0x98, 0x01, 0x98, 0x01, 0x98, 0x01, 0xFF, 0x03, 0xFF, 0x03, 0xCC, 0x00, 0xCC, 0x00, 0xFF, 0x03, 0xFF, 0x03, 0x66, 0x00, 0x66, 0x00, 0x66, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* $ (36) */ {0x00, 0x00, 0x18, 0x00, 0x3C, 0x00, 0xFF, 0x00, 0xDB, 0x00, 0x1B, 0x00, 0x1B, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0xDB, 0x00, 0xDB, 0x00, 0x7E, 0x00, 0x3C, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* % (37) */ {0x00, 0x00, 0x00, 0x00, 0x0E, 0x01, 0x9F, 0x00, 0x5B, 0x00, 0x5B, 0x00, 0x3F, 0x00, 0x2E, 0x00, 0xD0, 0x01, 0xF0, 0x03, 0x68, 0x03, 0x68, 0x03, 0x64, 0x03, 0xE4, 0x03, 0xC2, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* & (38) */ {0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x7E, 0x00, 0x66, 0x00, 0x66, 0x00, 0x3C, 0x00, 0x1C, 0x00, 0x36, 0x00, 0xB3, 0x01, 0xE3, 0x01, 0xE3, 0x01, 0xC3, 0x00, 0xFE, 0x01, 0x3C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* ' (39) */ {0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* ( (40) */ {0x00, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x07, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* ) (41) */ {0x00, 0x00, 0x03, 0x00, 0x06, 0x00, 0x1C, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* * (42) */ {0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xD6, 0x00, 0x38, 0x00, 0xFF, 0x01, 0x38, 0x00, 0x54, 0x00, 0x92, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* + (43) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* , (44) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* - (45) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* . (46) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* / (47) */ {0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xC0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x30, 0x00, 0x30, 0x00, 0x18, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* 0 (48) */ {0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x7E, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xDB, 0x00, 0xDB, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0x66, 0x00, 0x7E, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* 1 (49) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0f, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* 2 (50) */ {0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xFF, 0x00, 0xC3, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* 3 (51) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0xff, 0x00, 0xc3, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0x78, 0x00, 0x78, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0x7e, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* 4 (52) */ {0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x70, 0x00, 0x78, 0x00, 0x6C, 0x00, 0x66, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* 5 (53) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x03, 0x00, 0x03, 0x00, 0x3f, 0x00, 0x7f, 0x00, 0xc3, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0x7e, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* 6 (54) */ {0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xFF, 0x00, 0x03, 0x00, 0x03, 0x00, 0x3B, 0x00, 0x7F, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0x7E, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* 7 (55) */ {0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x60, 0x00, 0x60, 0x00, 0x30, 0x00, 0x30, 0x00, 0x18, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* 8 (56) */ {0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xFF, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0x66, 0x00, 0x3C, 0x00, 0x66, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0x7E, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* 9 (57) */ {0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xFF, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xFE, 0x00, 0xDC, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC3, 0x00, 0x7E, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* : (58) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* ; (59) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* < (60) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* = (61) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* > (62) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* ? (63) */ {0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xFF, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* @ (64) */ {0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x03, 0x03, 0xD9, 0x02, 0xFD, 0x02, 0xCD, 0x02, 0xCD, 0x02, 0xCD, 0x02, 0xCD, 0x02, 0xFD, 0x02, 0xD9, 0x02, 0x81, 0x01, 0x02, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* A (65) */ {0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x38, 0x00, 0x38, 0x00, 0x6C, 0x00, 0x6C, 0x00, 0x6C, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xFE, 0x00, 0xFF, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* B (66) */ {0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFF, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* C (67) */ {0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0xfe, 0x01, 0x83, 0x01, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x83, 0x01, 0x83, 0x01, 0xfe, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* D (68) */ {0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0xff, 0x00, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xc3, 0x00, 0x7f, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* E (69) */ {0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0xff, 0x01, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xff, 0x00, 0xff, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xff, 0x01, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* F (70) */ {0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0x01, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* G (71) */ {0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xFF, 0x01, 0x83, 0x01, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xE3, 0x01, 0xE3, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xFE, 0x01, 0xBC, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* H (72) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xff, 0x01, 0xff, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* I (73) */ {0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* J (74) */ {0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0x7E, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* K (75) */ {0x00, 0x00, 0x00, 0x00, 0x83, 0x01, 0xE3, 0x00, 0x33, 0x00, 0x1B, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x0F, 0x00, 0x1B, 0x00, 0x33, 0x00, 0x63, 0x00, 0xC3, 0x00, 0x83, 0x01, 0x83, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* L (76) */ {0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFF, 0x01, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* M (77) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x87, 0x03, 0x87, 0x03, 0xcf, 0x03, 0xcf, 0x03, 0xcf, 0x03, 0xff, 0x03, 0x7b, 0x03, 0x7b, 0x03, 0x33, 0x03, 0x33, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* N (78) */ {0x00, 0x00, 0x00, 0x00, 0x83, 0x01, 0x87, 0x01, 0x8f, 0x01, 0x8f, 0x01, 0x9b, 0x01, 0x9b, 0x01, 0xb3, 0x01, 0xb3, 0x01, 0xe3, 0x01, 0xe3, 0x01, 0xc3, 0x01, 0xc3, 0x01, 0x83, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* O (79) */ {0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0xff, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xfe, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* P (80) */ {0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFF, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* Q (81) */ {0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xFF, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x9B, 0x01, 0xB3, 0x01, 0xFE, 0x00, 0xFC, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* R (82) */ {0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xFF, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x63, 0x00, 0x63, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0x83, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* S (83) */ {0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xFF, 0x01, 0x83, 0x01, 0x03, 0x00, 0x03, 0x00, 0x7E, 0x00, 0xFC, 0x00, 0x80, 0x01, 0x80, 0x01, 0x83, 0x01, 0x83, 0x01, 0xFE, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* T (84) */ {0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xFF, 0x03, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* U (85) */ {0x00, 0x00, 0x00, 0x00, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xFE, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* V (86) */ {0x00, 0x00, 0x00, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0x66, 0x00, 0x66, 0x00, 0x66, 0x00, 0x66, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* W (87) */ {0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x33, 0x03, 0x33, 0x03, 0xB6, 0x01, 0xB6, 0x01, 0xB6, 0x01, 0xB6, 0x01, 0xB6, 0x01, 0xFC, 0x00, 0xCC, 0x00, 0xCC, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* X (88) */ {0x00, 0x00, 0x00, 0x00, 0x83, 0x01, 0xC7, 0x01, 0xC6, 0x00, 0xC6, 0x00, 0x6C, 0x00, 0x38, 0x00, 0x38, 0x00, 0x6C, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0x83, 0x01, 0x83, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* Y (89) */ {0x00, 0x00, 0x00, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0x66, 0x00, 0x66, 0x00, 0x66, 0x00, 0x3C, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* Z (90) */ {0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0x01, 0x60, 0x00, 0x60, 0x00, 0x30, 0x00, 0x30, 0x00, 0x18, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x06, 0x00, 0xFF, 0x01, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* [ (91) */ {0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* \ (92) */ {0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x18, 0x00, 0x30, 0x00, 0x30, 0x00, 0x60, 0x00, 0x60, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* ] (93) */ {0x00, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* ^ (94) */ {0x0C, 0x00, 0x1E, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* _ (95) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03},
-    /* ` (96) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x7f, 0x00, 0x63, 0x00, 0x30, 0x00, 0x18, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* a (97) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x7E, 0x00, 0xC2, 0x00, 0xE0, 0x00, 0xFC, 0x00, 0xDE, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xFE, 0x00, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* b (98) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x3b, 0x00, 0x7f, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0x7f, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* c (99) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x7E, 0x00, 0xC3, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xC3, 0x00, 0x7E, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* d (100) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xdc, 0x00, 0xfe, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0xfe, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* e (101) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x7E, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x03, 0x00, 0xC3, 0x00, 0x7E, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* f (102) */ {0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x0C, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* g (103) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x00, 0xFE, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xFE, 0x00, 0xDC, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x7E, 0x00, 0x3E, 0x00},
-    /* h (104) */ {0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x3B, 0x00, 0x7F, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* i (105) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* j (106) */ {0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00},
-    /* k (107) */ {0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xC3, 0x00, 0x63, 0x00, 0x33, 0x00, 0x1B, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1B, 0x00, 0x33, 0x00, 0x63, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* l (108) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* m (109) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0x00, 0xFF, 0x01, 0x33, 0x03, 0x33, 0x03, 0x33, 0x03, 0x33, 0x03, 0x33, 0x03, 0x33, 0x03, 0x33, 0x03, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* n (110) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x00, 0x7F, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* o (111) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x7E, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0x7E, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* p (112) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x00, 0x7F, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0x7F, 0x00, 0x3B, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00},
-    /* q (113) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x00, 0xFE, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xFE, 0x00, 0xDC, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00},
-    /* r (114) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x00, 0x3F, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* s (115) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x7E, 0x00, 0xC3, 0x00, 0x03, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xC0, 0x00, 0xC3, 0x00, 0x7E, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* t (116) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x3c, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* u (117) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xFE, 0x00, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* v (118) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0x66, 0x00, 0x66, 0x00, 0x66, 0x00, 0x3C, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* w (119) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x33, 0x03, 0xB6, 0x01, 0xB6, 0x01, 0xFE, 0x01, 0xCC, 0x00, 0xCC, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* x (120) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0x66, 0x00, 0x3C, 0x00, 0x18, 0x00, 0x3C, 0x00, 0x66, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* y (121) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0x66, 0x00, 0x66, 0x00, 0x66, 0x00, 0x66, 0x00, 0x3C, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x07, 0x00, 0x03, 0x00},
-    /* z (122) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* { (123) */ {0x00, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x07, 0x00, 0x07, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x3C, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* | (124) */ {0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00},
-    /* } (125) */ {0x00, 0x00, 0x07, 0x00, 0x0F, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x38, 0x00, 0x38, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /* ~ (126) */ {0x36, 0x00, 0x3F, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    /*  (127) */ {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x28, 0x00, 0x44, 0x00, 0x82, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-};
 
 const uint8_t font_widths[96] = {
     /*   (32) */ 1,
@@ -920,6 +799,3 @@ const uint8_t font_widths[96] = {
     /* ~ (126) */ 6,
     /*  (127) */ 9,
 };
-
-const uint8_t pix_power_on_text[1060] = {
-    0x07, 0xe0, 0x00, 0x00, 0xe0, 0x00, 0x80, 0x03, 0x70, 0x00, 0x00, 0x00, 0x80, 0x03, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0xe0, 0x00, 0x80, 0x03, 0x70, 0x00, 0x00, 0x00, 0x80, 0x03, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0xe0, 0x00, 0x80, 0x03, 0x70, 0x00, 0x00, 0x00, 0x80, 0x03, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0xe0, 0x00, 0x80, 0x03, 0x70, 0x00, 0x00, 0x00, 0x80, 0x03, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0xe0, 0x00, 0x80, 0x03, 0x70, 0x00, 0x00, 0x00, 0x80, 0x03, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0xe0, 0x00, 0x80, 0x03, 0x70, 0x00, 0x00, 0x00, 0x80, 0x03, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x80, 0x3f, 0xe0, 0x80, 0x9f, 0x03, 0x70, 0x7e, 0xc0, 0x01, 0xe7, 0x7f, 0xfe, 0x07, 0x7f, 0x00, 0x00, 0x00, 0x07, 0xe0, 0xc0, 0x7f, 0xe0, 0xc0, 0xff, 0x03, 0x70, 0xff, 0xc1, 0x01, 0xe7, 0x7f, 0xfe, 0x87, 0xff, 0xe0, 0xfc, 0x00, 0x07, 0xe0, 0xe0, 0xf1, 0xe0, 0xe0, 0xf1, 0x03, 0xf0, 0xe7, 0xc3, 0x01, 0xe7, 0x7f, 0xfe, 0xc7, 0xe3, 0xe1, 0xfe, 0x01, 0xff, 0xff, 0x70, 0xc0, 0xe1, 0x70, 0xc0, 0x03, 0xf0, 0x81, 0xc7, 0x01, 0x87, 0x03, 0x38, 0xe0, 0x80, 0xe3, 0xef, 0x03, 0xff, 0xff, 0x70, 0x80, 0xe3, 0x38, 0x80, 0x03, 0xf0, 0x00, 0xc7, 0x01, 0x87, 0x03, 0x38, 0xe0, 0x00, 0xe7, 0x83, 0x03, 0xff, 0xff, 0x38, 0x80, 0xe3, 0x38, 0x80, 0x03, 0x70, 0x00, 0xc6, 0x01, 0x87, 0x03, 0x38, 0x70, 0x00, 0xe7, 0x01, 0x07, 0x07, 0xe0, 0x18, 0x00, 0xe3, 0x38, 0x80, 0x03, 0x70, 0x00, 0xc6, 0x01, 0x87, 0x03, 0x38, 0x30, 0x00, 0xe6, 0x00, 0x07, 0x07, 0xe0, 0x18, 0x00, 0xe3, 0x38, 0x80, 0x03, 0x70, 0x00, 0xc6, 0x01, 0x87, 0x03, 0x38, 0x30, 0x00, 0xe6, 0x00, 0x07, 0x07, 0xe0, 0x18, 0x00, 0xe3, 0x38, 0x80, 0x03, 0x70, 0x00, 0xc6, 0x01, 0x87, 0x03, 0x38, 0x30, 0x00, 0xe6, 0x00, 0x07, 0x07, 0xe0, 0x38, 0x80, 0xe3, 0x38, 0x80, 0x03, 0x70, 0x00, 0xc7, 0x01, 0x87, 0x03, 0x38, 0x70, 0x00, 0xe7, 0x00, 0x07, 0x07, 0xe0, 0x70, 0x80, 0xe3, 0x70, 0x80, 0x03, 0xf0, 0x00, 0xc7, 0x01, 0x87, 0x03, 0x38, 0xe0, 0x00, 0xe7, 0x00, 0x07, 0x07, 0xe0, 0x70, 0xc0, 0xe1, 0x70, 0xc0, 0x03, 0xf0, 0x81, 0x83, 0x83, 0x03, 0x07, 0x70, 0xe0, 0x80, 0xe3, 0x00, 0x07, 0x07, 0xe0, 0xe0, 0xf1, 0xe0, 0xe0, 0xf1, 0x03, 0xf0, 0xe7, 0x83, 0xef, 0x03, 0xcf, 0xf0, 0xcc, 0xe3, 0xe1, 0x00, 0x07, 0x07, 0xe0, 0xc0, 0x7f, 0xe0, 0xc0, 0xff, 0x03, 0x70, 0xff, 0x01, 0xfe, 0x01, 0xfe, 0xe0, 0x8f, 0xff, 0xe0, 0x00, 0x07, 0x07, 0xe0, 0x80, 0x3f, 0xe0, 0x80, 0x9f, 0x03, 0x70, 0x7e, 0x00, 0x78, 0x00, 0x7c, 0xc0, 0x07, 0x7f, 0xe0, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xc0, 0x1f, 0x00, 0xff, 0xe3, 0x80, 0xe3, 0x9e, 0xf3, 0x03, 0x00, 0xfe, 0xc0, 0xf9, 0x01, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xe0, 0x3f, 0x00, 0xff, 0xe3, 0x80, 0xe3, 0x9f, 0xfb, 0x07, 0x00, 0xff, 0xc1, 0xfd, 0x03, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xf0, 0x78, 0x00, 0xff, 0xe3, 0x80, 0xe3, 0x9f, 0xbf, 0x0f, 0x80, 0xc7, 0xc3, 0xdf, 0x07, 0x00, 0x00, 0x00, 0x00, 0x07, 0x38, 0xe0, 0x00, 0x1c, 0xe0, 0x80, 0xe3, 0x81, 0x0f, 0x0e, 0xc0, 0x01, 0xc7, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x07, 0x38, 0xc0, 0x01, 0x1c, 0xe0, 0x80, 0xe3, 0x80, 0x07, 0x1c, 0xc0, 0x01, 0xce, 0x03, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1c, 0xc0, 0x01, 0x1c, 0xe0, 0x80, 0xe3, 0x80, 0x03, 0x1c, 0xe0, 0x00, 0xce, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0c, 0x80, 0x01, 0x1c, 0xe0, 0x80, 0xe3, 0x80, 0x03, 0x1c, 0x60, 0x00, 0xcc, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0c, 0x80, 0x01, 0x1c, 0xe0, 0x80, 0xe3, 0x80, 0x03, 0x1c, 0x60, 0x00, 0xcc, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0c, 0x80, 0x01, 0x1c, 0xe0, 0x80, 0xe3, 0x80, 0x03, 0x1c, 0x60, 0x00, 0xcc, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1c, 0xc0, 0x01, 0x1c, 0xe0, 0x80, 0xe3, 0x80, 0x03, 0x1c, 0xe0, 0x00, 0xce, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x07, 0x38, 0xc0, 0x01, 0x1c, 0xe0, 0x80, 0xe3, 0x80, 0x03, 0x1c, 0xc0, 0x01, 0xce, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x38, 0xe0, 0x00, 0x38, 0xc0, 0xc1, 0xe1, 0x80, 0x03, 0x1c, 0xc0, 0x01, 0xc7, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xf1, 0x78, 0x00, 0x78, 0xce, 0xf7, 0xe1, 0x80, 0x03, 0x1c, 0x80, 0xc7, 0xc3, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xe1, 0x3f, 0x00, 0xf0, 0x0f, 0xff, 0xe0, 0x80, 0x03, 0x1c, 0x00, 0xff, 0xc1, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xc0, 0x1f, 0x00, 0x80, 0x07, 0x3c, 0xe0, 0x80, 0x03, 0x1c, 0x00, 0xfe, 0xc0, 0x01, 0x00, 0x00, 0x00};
\ No newline at end of file
@@ -0,0 +1,295 @@
+/**
+ * UI位图, 游程编码, 由tools/ui_rle.py从tools/ui_assets.c生成, 不要手工修改
+ */
+#include "stdint.h"
+#include "ui.h"
+
+const uint8_t pix_co2_ppm_num[1095] = {
+    0x8e, 0xff, 0xd0, 0xaf, 0x1f, 0x8f, 0x4f, 0x5f, 0x6f, 0x3f, 0x87, 0xf7, 0x72, 0x7a, 0x1f, 0xc6, 0xe7, 0xe6, 0xe6, 0xf6,
+    0x60, 0x6c, 0x1f, 0xc6, 0xf6, 0x52, 0x5c, 0x3f, 0xb6, 0xf5, 0x63, 0x6a, 0x4f, 0xa5, 0xf5, 0x55, 0x5a, 0x5f, 0xa5, 0xf5,
+    0x65, 0x59, 0x5f, 0x96, 0xf5, 0x65, 0x59, 0x5f, 0x96, 0xf5, 0x65, 0x59, 0x5f, 0x96, 0xf5, 0x65, 0x59, 0x5f, 0x96, 0xf5,
+    0x65, 0x59, 0x5f, 0x96, 0xf5, 0x55, 0x6a, 0x4f, 0xa5, 0xf6, 0x54, 0x5b, 0x3f, 0xb6, 0xf5, 0x63, 0x6b, 0x2f, 0xc5, 0xf6,
+    0x61, 0x6d, 0x0f, 0xe5, 0xe6, 0xf6, 0x60, 0x6c, 0x2f, 0xa6, 0xf7, 0x82, 0x86, 0x4f, 0x5f, 0x6f, 0x3f, 0x8f, 0x1f, 0xbf,
+    0xfc, 0x2f, 0xf5, 0x04, 0xff, 0x8f, 0xf6, 0x3f, 0xf7, 0x1f, 0xf9, 0x0f, 0xfa, 0xbe, 0xcf, 0xfd, 0x7b, 0x52, 0x9f, 0x38,
+    0xf5, 0x79, 0x54, 0x9f, 0x65, 0xf5, 0x49, 0x57, 0x9f, 0x83, 0xf5, 0x19, 0x5a, 0xff, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff,
+    0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff,
+    0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff,
+    0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0xff, 0x01, 0x8d, 0xef, 0xfe, 0xfa, 0xf2, 0xf6,
+    0xf5, 0xf4, 0xf7, 0x73, 0x88, 0x1f, 0xc6, 0xf6, 0x60, 0x6e, 0x6e, 0x6e, 0x5e, 0x1f, 0xd5, 0xf6, 0x61, 0x5c, 0x2f, 0xc6,
+    0xf5, 0x62, 0xff, 0x54, 0xff, 0x55, 0xff, 0x55, 0xff, 0x64, 0xff, 0x54, 0xff, 0x64, 0xff, 0x63, 0xff, 0x63, 0xff, 0x63,
+    0xff, 0x73, 0xff, 0x72, 0xff, 0x63, 0xff, 0x63, 0xff, 0x63, 0xff, 0x63, 0xff, 0x63, 0xff, 0x63, 0xff, 0x63, 0xff, 0x63,
+    0xff, 0x63, 0xff, 0x63, 0xff, 0x63, 0xff, 0x63, 0xff, 0x63, 0xff, 0x63, 0xff, 0xf3, 0xcc, 0xdf, 0xfc, 0xcd, 0xdf, 0xfc,
+    0xfd, 0xff, 0x04, 0x9d, 0xdf, 0xfe, 0xfa, 0xf2, 0xf6, 0xf5, 0xf4, 0xf7, 0x73, 0x79, 0x1f, 0xc6, 0xf7, 0x50, 0x6e, 0x6e,
+    0x0f, 0xe5, 0xf5, 0x61, 0x5d, 0x1f, 0xd6, 0xf5, 0x61, 0xff, 0x64, 0xff, 0x54, 0xff, 0x55, 0xff, 0x64, 0xff, 0x54, 0xff,
+    0x63, 0xff, 0x72, 0xaf, 0xfe, 0xcb, 0xdf, 0xfd, 0xfc, 0xf0, 0x1f, 0xfb, 0x4f, 0xf7, 0x4f, 0xf7, 0x4f, 0xf6, 0x5f, 0xf6,
+    0x5f, 0xf5, 0x5f, 0xf5, 0x5f, 0xf5, 0x5f, 0xb5, 0xf5, 0x54, 0x5b, 0x4f, 0xb5, 0xf6, 0x62, 0x6b, 0x2f, 0xc6, 0xf6, 0x60,
+    0x7d, 0x7d, 0x8e, 0x89, 0x1f, 0x8f, 0x3f, 0x6f, 0x6f, 0x2f, 0xaf, 0xfd, 0x0f, 0xf6, 0x05, 0xff, 0xff, 0x90, 0xff, 0x91,
+    0xff, 0xa0, 0xef, 0xfb, 0x5e, 0x51, 0xdf, 0x25, 0xf5, 0x6c, 0x52, 0xbf, 0x36, 0xf5, 0x5b, 0x54, 0xaf, 0x46, 0xf5, 0x69,
+    0x55, 0x9f, 0x65, 0xf5, 0x68, 0x56, 0x7f, 0x76, 0xf5, 0x57, 0x58, 0x6f, 0x86, 0xf5, 0x65, 0x59, 0x5f, 0xa5, 0xf5, 0x64,
+    0x5a, 0x4f, 0xb5, 0xf5, 0x53, 0x5c, 0x2f, 0xc6, 0xf5, 0x52, 0x5d, 0x1f, 0xe5, 0xf5, 0x60, 0x5e, 0x0f, 0xf5, 0x50, 0x6e,
+    0x0f, 0xe5, 0xf5, 0x51, 0x6d, 0x1f, 0xd5, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0xf3, 0x5e, 0xff, 0x55, 0xff, 0x55,
+    0xff, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0x6f, 0xff, 0x1f, 0xaf, 0x0f, 0xaf, 0x0f,
+    0xaf, 0x0f, 0xaf, 0x0f, 0xf5, 0x5f, 0xf5, 0x5f, 0xf5, 0x5f, 0xf4, 0x6f, 0xf4, 0x5f, 0xf5, 0x5f, 0xf5, 0x5f, 0xf5, 0x5f,
+    0xf5, 0x5f, 0xf5, 0x5f, 0x65, 0xf7, 0x57, 0xc3, 0x5f, 0x15, 0x1f, 0x3f, 0x8f, 0x2f, 0x9f, 0x0f, 0x8a, 0xe8, 0xc8, 0xd7,
+    0xe7, 0xc7, 0xf6, 0x61, 0xff, 0x55, 0xff, 0x65, 0xff, 0x64, 0xff, 0x55, 0xff, 0x55, 0xff, 0x55, 0xff, 0x55, 0x6a, 0x4f,
+    0xb5, 0xf5, 0x63, 0x5b, 0x3f, 0xc5, 0xf6, 0x61, 0x6c, 0x1f, 0xd6, 0xe6, 0xe6, 0xc7, 0xf7, 0x80, 0x88, 0x2f, 0x7f, 0x4f,
+    0x5f, 0x7f, 0x1f, 0xaf, 0xfd, 0x1f, 0xf6, 0x04, 0x0f, 0xf8, 0xee, 0x9f, 0x3f, 0x6f, 0x5f, 0x4f, 0x7f, 0x2f, 0x88, 0xf8,
+    0x61, 0x6c, 0x0f, 0xe6, 0xd6, 0xf6, 0x51, 0x6d, 0x1f, 0xc6, 0xf5, 0x53, 0x6b, 0xff, 0x54, 0xff, 0x55, 0xff, 0x64, 0xff,
+    0x54, 0x59, 0x6f, 0x65, 0xfc, 0x52, 0xf4, 0xf0, 0x51, 0xf3, 0xe3, 0x25, 0x5f, 0x5d, 0x61, 0x97, 0xac, 0x7b, 0x9c, 0x6e,
+    0x8b, 0x0f, 0xa7, 0xf7, 0x62, 0x7a, 0x3f, 0xa5, 0xf6, 0x54, 0x6a, 0x4f, 0x96, 0xf6, 0x64, 0x69, 0x4f, 0xa6, 0xf5, 0x64,
+    0x5a, 0x4f, 0xa6, 0xf6, 0x53, 0x6b, 0x2f, 0xc6, 0xf5, 0x62, 0x6c, 0x0f, 0xe6, 0xd6, 0xf7, 0x60, 0x7b, 0x1f, 0x78, 0xf9,
+    0xf2, 0xf7, 0xf4, 0xf4, 0xf8, 0xf1, 0xcb, 0xff, 0x61, 0x3f, 0xff, 0xfc, 0xcd, 0xdf, 0xfc, 0xcd, 0xdf, 0xff, 0x55, 0xff,
+    0x64, 0xff, 0x54, 0xff, 0x64, 0xff, 0x54, 0xff, 0x64, 0xff, 0x54, 0xff, 0x64, 0xff, 0x54, 0xff, 0x64, 0xff, 0x54, 0xff,
+    0x64, 0xff, 0x54, 0xff, 0x64, 0xff, 0x54, 0xff, 0x64, 0xff, 0x54, 0xff, 0x64, 0xff, 0x54, 0xff, 0x64, 0xff, 0x54, 0xff,
+    0x64, 0xff, 0x54, 0xff, 0x64, 0xff, 0x54, 0xff, 0x64, 0xff, 0x54, 0xff, 0x64, 0xff, 0x54, 0xff, 0x64, 0xff, 0x54, 0xff,
+    0x64, 0xff, 0x54, 0xff, 0x64, 0xff, 0x54, 0xff, 0x64, 0xff, 0x54, 0xff, 0x64, 0xff, 0xff, 0x08, 0x8e, 0xef, 0xfe, 0xf9,
+    0xf3, 0xf6, 0xf5, 0xf4, 0xf7, 0x72, 0x89, 0x0f, 0xc7, 0xe7, 0xe6, 0xe6, 0xf5, 0x51, 0x6d, 0x1f, 0xd5, 0xf6, 0x61, 0x6c,
+    0x1f, 0xc6, 0xf6, 0x51, 0x5e, 0x1f, 0xe5, 0xf5, 0x51, 0x6e, 0x6e, 0x0f, 0xc6, 0xf6, 0x62, 0x6a, 0x4f, 0x48, 0xf8, 0xf6,
+    0xf3, 0xd9, 0xaf, 0x3f, 0x5f, 0x6f, 0x3f, 0x69, 0xf9, 0x70, 0x7c, 0x7d, 0x6e, 0x6d, 0x1f, 0xb6, 0xf6, 0x63, 0x5a, 0x4f,
+    0xa6, 0xf5, 0x55, 0x5a, 0x5f, 0xa5, 0xf5, 0x55, 0x5a, 0x5f, 0xa5, 0xf5, 0x55, 0x6a, 0x3f, 0xa6, 0xf6, 0x72, 0x6b, 0x1f,
+    0xc6, 0xc8, 0xd8, 0x89, 0xf9, 0xf0, 0xf9, 0xf2, 0xf7, 0xf5, 0xf3, 0xe9, 0xff, 0x60, 0x4f, 0x8d, 0xef, 0xfe, 0xf9, 0xf3,
+    0xf6, 0xf5, 0xf4, 0xf7, 0x82, 0x88, 0x0f, 0xb8, 0xe7, 0xe6, 0xd6, 0xf6, 0x61, 0x6c, 0x2f, 0xc5, 0xf5, 0x63, 0x6a, 0x4f,
+    0xa5, 0xf6, 0x54, 0x6a, 0x4f, 0xa5, 0xf6, 0x64, 0x69, 0x4f, 0x96, 0xf6, 0x64, 0x5a, 0x3f, 0xa7, 0xf5, 0x73, 0x6a, 0x1f,
+    0xa8, 0xf7, 0x80, 0x7b, 0x9d, 0x7c, 0xba, 0xac, 0x75, 0x51, 0xfd, 0x25, 0xe5, 0x3f, 0x53, 0x1f, 0x0f, 0x54, 0x3f, 0x7a,
+    0xf5, 0x4f, 0xf6, 0x4f, 0xf5, 0x5f, 0xf5, 0x5f, 0xf5, 0x4f, 0xb6, 0xf5, 0x53, 0x6c, 0x1f, 0xd6, 0xe6, 0xe6, 0xe6, 0xf6,
+    0x70, 0x7a, 0x1f, 0x78, 0xf8, 0xf3, 0xf6, 0xf5, 0xf4, 0xf8, 0xf1, 0xcb, 0xff, 0x61, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x9f, 0xff, 0xa0, 0xff, 0xa0, 0xff, 0xa0, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x47, 0xff, 0x46, 0xff, 0x46, 0xff, 0x46, 0xff, 0x46, 0xff, 0x46, 0xff,
+    0x46, 0xff, 0x46, 0xff, 0x46, 0xff, 0x46, 0xff, 0x46, 0xff, 0x46, 0x8f, 0xff, 0xa0, 0xff, 0xa0, 0xff, 0xa0, 0xff, 0xf0,
+    0x48, 0xff, 0x46, 0xff, 0x46, 0xff, 0x46, 0xff, 0x46, 0xff, 0x46, 0xff, 0x46, 0xff, 0x46, 0xff, 0x46, 0xff, 0x46, 0xff,
+    0x46, 0xff, 0x46, 0xff, 0x46, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef,
+};
+const uint16_t pix_co2_ppm_num_idx[12] = {
+    0, 104, 194, 283, 375, 474, 568, 670, 756, 855, 955, 1017,
+};
+
+const uint8_t pix_passkey_num[599] = {
+    0x1d, 0xcf, 0xf9, 0xd6, 0x3f, 0x0f, 0x1f, 0x56, 0xf6, 0x40, 0x49, 0x4e, 0x5a, 0x4d, 0x4b, 0x4c, 0x5c, 0x4b, 0x4d, 0x4b,
+    0x4d, 0x4a, 0x4e, 0x4a, 0x0f, 0x94, 0xf4, 0x40, 0x49, 0x0f, 0x94, 0xf4, 0x40, 0x49, 0x0f, 0x94, 0xf4, 0x40, 0x49, 0x0f,
+    0x94, 0xf4, 0x40, 0x49, 0x0f, 0xa3, 0xe4, 0xb4, 0xd4, 0xb4, 0xd4, 0xb4, 0xd4, 0xb4, 0xb5, 0xd4, 0xa4, 0xd5, 0x95, 0xf4,
+    0x60, 0x65, 0x1f, 0x0f, 0x3f, 0xfd, 0x96, 0xcf, 0xf1, 0x03, 0xff, 0x4c, 0xbf, 0xf6, 0x7a, 0x8f, 0xf9, 0xa7, 0x6f, 0x25,
+    0xf4, 0x55, 0x43, 0x5f, 0x44, 0xf4, 0x25, 0x46, 0x5f, 0x71, 0xf4, 0x4d, 0xdf, 0xf4, 0x4d, 0xdf, 0xf4, 0x4d, 0xdf, 0xf4,
+    0x4d, 0xdf, 0xf4, 0x4d, 0xdf, 0xf4, 0x4d, 0xdf, 0xf4, 0x4d, 0xdf, 0xf4, 0x4d, 0xdf, 0xf4, 0x4d, 0xdf, 0xf4, 0x4d, 0xdf,
+    0xf4, 0x4d, 0xff, 0x5f, 0x1c, 0xcf, 0xf9, 0xd6, 0x3f, 0x0f, 0x1f, 0x65, 0xe6, 0x95, 0xd5, 0xb4, 0xd4, 0xb4, 0xc4, 0xd4,
+    0xc3, 0xd4, 0xf3, 0x4d, 0xdf, 0xf4, 0x4d, 0xcf, 0xf4, 0x5c, 0xcf, 0xf4, 0x4c, 0xcf, 0xf4, 0x4c, 0xcf, 0xf5, 0x5b, 0xbf,
+    0xf5, 0x5b, 0xbf, 0xf5, 0x5b, 0xbf, 0xf5, 0x5b, 0xbf, 0xf5, 0x5b, 0xcf, 0x5f, 0xfc, 0xc5, 0x5f, 0xff, 0x0b, 0x1c, 0xcf,
+    0xfa, 0xd5, 0x3f, 0x1f, 0x0f, 0x75, 0xf5, 0x40, 0x59, 0x4d, 0x4b, 0x4d, 0x4b, 0x3d, 0x3d, 0xef, 0xf3, 0x4d, 0xdf, 0xf4,
+    0x4c, 0xcf, 0xf5, 0xb5, 0x6f, 0xf9, 0xa8, 0x7f, 0xfc, 0x5d, 0xdf, 0xf5, 0x4d, 0xef, 0xf4, 0x4d, 0xdf, 0xa4, 0xe4, 0xa4,
+    0xe4, 0xb4, 0xc4, 0xc4, 0xa5, 0xd5, 0x75, 0xe6, 0x2f, 0x2f, 0xfe, 0xb4, 0xbf, 0xf2, 0x03, 0xff, 0x2f, 0xf6, 0x7a, 0xaf,
+    0xf7, 0x89, 0x8f, 0x14, 0xf4, 0x57, 0x41, 0x7f, 0x24, 0xf4, 0x46, 0x43, 0x5f, 0x35, 0xf4, 0x45, 0x44, 0x4f, 0x54, 0xf4,
+    0x53, 0x45, 0x3f, 0x64, 0xf4, 0x42, 0x47, 0x2f, 0x74, 0xf4, 0x41, 0x48, 0x0f, 0x94, 0xf4, 0x40, 0x49, 0x4e, 0x4a, 0x3e,
+    0x4b, 0x4d, 0x4b, 0xfd, 0x98, 0x8f, 0xf9, 0x98, 0x8f, 0x9f, 0xf4, 0x4d, 0xdf, 0xf4, 0x4d, 0xdf, 0xf4, 0x4d, 0xff, 0x0d,
+    0xff, 0xf7, 0xf2, 0xf0, 0xe2, 0x3f, 0x4e, 0xdf, 0xf4, 0x4d, 0xdf, 0xf4, 0x4d, 0xdf, 0xf3, 0x3e, 0xef, 0xf3, 0x3e, 0x93,
+    0x1f, 0x14, 0xfc, 0xf0, 0xe3, 0x67, 0xd6, 0xa5, 0xc5, 0xc4, 0xf4, 0x4e, 0xdf, 0xf4, 0x4d, 0xdf, 0xf4, 0x4d, 0xdf, 0xb4,
+    0xd4, 0xb4, 0xd4, 0xb4, 0xc4, 0xd4, 0xa4, 0xd5, 0x66, 0xf6, 0xf0, 0xf1, 0xe2, 0x5f, 0xfa, 0x2b, 0x3f, 0x2d, 0xbf, 0xfa,
+    0xe5, 0x2f, 0x1f, 0x0f, 0x66, 0xe6, 0x94, 0xd5, 0xb4, 0xc5, 0xc4, 0xb4, 0xd4, 0xb4, 0xf4, 0x3d, 0xdf, 0xf4, 0x4d, 0x94,
+    0x0f, 0x34, 0xeb, 0x14, 0x0f, 0x9c, 0x75, 0x7b, 0x59, 0x6b, 0x5b, 0x6a, 0x4c, 0x5a, 0x4d, 0x5a, 0x4e, 0x59, 0x4e, 0x4a,
+    0x4e, 0x4a, 0x4e, 0x4a, 0x4d, 0x5b, 0x4c, 0x4c, 0x5b, 0x4d, 0x59, 0x6e, 0x66, 0x0f, 0x1f, 0x2f, 0xfd, 0xa6, 0xbf, 0xf2,
+    0x02, 0xff, 0xf4, 0xc5, 0x5f, 0xfc, 0xf5, 0x4d, 0xdf, 0xf4, 0x4c, 0xdf, 0xf4, 0x4c, 0xdf, 0xf4, 0x4c, 0xdf, 0xf4, 0x4c,
+    0xdf, 0xf4, 0x4c, 0xdf, 0xf4, 0x4c, 0xdf, 0xf4, 0x4c, 0xdf, 0xf4, 0x4c, 0xdf, 0xf4, 0x4c, 0xdf, 0xf4, 0x4c, 0xdf, 0xf4,
+    0x4c, 0xdf, 0xf4, 0x4c, 0xdf, 0xf4, 0x4c, 0xdf, 0xf4, 0xff, 0x0a, 0x2c, 0xbf, 0xfa, 0xe5, 0x2f, 0x1f, 0x0f, 0x66, 0xe6,
+    0xa4, 0xd4, 0xb5, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xc4, 0xd4, 0xb4, 0xd4, 0x95, 0xf4, 0x50, 0x56, 0x2f, 0xfe,
+    0xa5, 0x5f, 0xfe, 0xf2, 0xe2, 0x85, 0xc6, 0xb5, 0xc4, 0xd4, 0xa4, 0xe4, 0xa4, 0xe4, 0xa4, 0xe4, 0xa4, 0xe4, 0xa4, 0xe4,
+    0xa4, 0xc5, 0xb5, 0xa5, 0xd5, 0x76, 0xd6, 0x3f, 0x1f, 0x0f, 0x4f, 0xfb, 0x2a, 0x3f, 0x3b, 0xbf, 0xf9, 0xd6, 0x3f, 0x0f,
+    0x1f, 0x66, 0xe5, 0x95, 0xd5, 0xb4, 0xc4, 0xd4, 0xb4, 0xd4, 0xb4, 0xe4, 0xa4, 0xe4, 0xa4, 0xe4, 0xa4, 0xe4, 0xa4, 0xd4,
+    0xa5, 0xd4, 0xb5, 0xb4, 0xb6, 0x95, 0x13, 0xc3, 0x56, 0x15, 0xd3, 0x2e, 0xe3, 0x2c, 0xf4, 0x81, 0x44, 0xdf, 0xf4, 0x4d,
+    0xdf, 0xb3, 0xd4, 0xb4, 0xd4, 0xc4, 0xb4, 0xd4, 0x95, 0xe5, 0x65, 0xf6, 0xf1, 0xf0, 0xd3, 0x6f, 0xf9, 0x1c, 0x4f,
+};
+const uint16_t pix_passkey_num_idx[10] = {
+    0, 70, 124, 178, 235, 300, 357, 421, 471, 534,
+};
+
+const uint8_t pix_sensor_error[471] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x85, 0x88, 0x69, 0x88, 0x1f, 0x4c, 0x6a, 0x7a, 0x68, 0xfa,
+    0xc0, 0xc3, 0xc4, 0xa5, 0xc4, 0xce, 0x43, 0x63, 0x43, 0x63, 0xc3, 0x43, 0x63, 0x4d, 0x4b, 0x54, 0x43, 0x54, 0xc3, 0x43,
+    0x54, 0x4d, 0x4b, 0x54, 0x43, 0x54, 0x43, 0x44, 0x43, 0x54, 0x4d, 0x4b, 0x54, 0x43, 0x54, 0x33, 0x36, 0x43, 0x54, 0x4d,
+    0x4b, 0x54, 0x43, 0x54, 0x33, 0x36, 0x43, 0x54, 0xcd, 0x43, 0x53, 0x44, 0x53, 0x34, 0x36, 0x43, 0x53, 0xce, 0xb3, 0xb5,
+    0x35, 0x36, 0xb3, 0x0f, 0x3c, 0x6a, 0x6a, 0x63, 0x33, 0xfa, 0xc1, 0x83, 0x88, 0x38, 0x36, 0x83, 0x3f, 0xb4, 0xa6, 0xa6,
+    0x63, 0x33, 0xf6, 0x45, 0x7b, 0x79, 0x39, 0x36, 0x73, 0x4f, 0xb4, 0x88, 0x88, 0x63, 0x33, 0xf8, 0x43, 0x9b, 0x97, 0x47,
+    0x44, 0x93, 0x2f, 0x3c, 0x14, 0x65, 0x14, 0x65, 0x3c, 0x14, 0xf5, 0xc1, 0x43, 0x52, 0x45, 0x52, 0xc5, 0x43, 0x52, 0x0f,
+    0x3c, 0x34, 0x45, 0x34, 0x55, 0x4a, 0x34, 0xe5, 0x3c, 0x44, 0x35, 0x44, 0x55, 0x58, 0x44, 0xe5, 0x3b, 0x54, 0x34, 0x54,
+    0x64, 0x66, 0x54, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xf3, 0x0f, 0xc1, 0xf3,
+    0x9f, 0x11, 0xf2, 0x1e, 0x1b, 0xff, 0x1c, 0x12, 0x12, 0x13, 0x41, 0x42, 0x42, 0x15, 0x25, 0x14, 0x26, 0x12, 0x11, 0x12,
+    0x14, 0x11, 0x14, 0x12, 0x22, 0x17, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x15, 0x18, 0x14, 0x12, 0x13, 0x15, 0x12, 0x21,
+    0x11, 0x11, 0x46, 0x11, 0x12, 0x11, 0x12, 0x46, 0x12, 0x11, 0x13, 0x12, 0x12, 0x15, 0x56, 0x12, 0x12, 0x13, 0x15, 0x12,
+    0x11, 0x12, 0x11, 0x14, 0x11, 0x12, 0x11, 0x12, 0x11, 0x12, 0x16, 0x25, 0x44, 0x12, 0x15, 0x18, 0x14, 0x12, 0x13, 0x15,
+    0x12, 0x11, 0x12, 0x31, 0x12, 0x11, 0x12, 0x11, 0x12, 0x31, 0x17, 0x15, 0x15, 0x45, 0x42, 0x15, 0x14, 0x12, 0x13, 0x15,
+    0x12, 0x11, 0x12, 0x11, 0x14, 0x11, 0x12, 0x11, 0x12, 0x11, 0x19, 0x15, 0x15, 0x18, 0x15, 0x15, 0x14, 0x12, 0x13, 0x15,
+    0x12, 0x11, 0x12, 0x11, 0x14, 0x11, 0x12, 0x11, 0x12, 0x11, 0x19, 0x15, 0x15, 0x18, 0x15, 0x15, 0x14, 0x12, 0x13, 0x15,
+    0x12, 0x11, 0x12, 0x11, 0x14, 0x11, 0x12, 0x11, 0x12, 0x11, 0x19, 0x15, 0x45, 0x42, 0x42, 0x45, 0x22, 0x35, 0x23, 0x12,
+    0x12, 0x41, 0x11, 0x11, 0x12, 0x41, 0x32, 0xff, 0xff, 0xff, 0x01,
+};
+
+const uint8_t pix_airspot_text[279] = {
+    0x49, 0x2f, 0xa5, 0xfc, 0x82, 0xab, 0x3f, 0xd8, 0x0f, 0x4c, 0x2f, 0xa5, 0xee, 0xaa, 0xec, 0xad, 0x0f, 0x6b, 0x1f, 0xa5,
+    0x0f, 0x3c, 0x36, 0x29, 0x47, 0x4c, 0x57, 0x0f, 0xf2, 0x62, 0x1f, 0xa5, 0x1f, 0x3a, 0x38, 0x28, 0x39, 0x3a, 0x3c, 0x2e,
+    0x1f, 0xf8, 0x50, 0xfa, 0xa1, 0xa2, 0x91, 0xa2, 0x92, 0xe3, 0xd3, 0xf2, 0x81, 0x0f, 0xa5, 0x65, 0x96, 0xf2, 0x25, 0x2b,
+    0x37, 0x1f, 0xd2, 0xf2, 0x81, 0x0f, 0xa5, 0x75, 0x95, 0xf2, 0x25, 0x2b, 0x27, 0x2f, 0xc3, 0xf2, 0x40, 0x42, 0x5e, 0x5a,
+    0x57, 0x39, 0x4f, 0xb2, 0x62, 0xf2, 0x34, 0x2b, 0x0f, 0x24, 0xe4, 0xa5, 0x75, 0xa5, 0xf3, 0x23, 0x2b, 0x26, 0x5f, 0xb2,
+    0xf2, 0x30, 0x34, 0x5e, 0x5a, 0x57, 0x4b, 0x1f, 0xb2, 0x62, 0xf2, 0x25, 0x2b, 0x4e, 0x44, 0x5d, 0x5a, 0x66, 0x4c, 0x0f,
+    0xa2, 0x62, 0xf3, 0x25, 0x2b, 0x4e, 0x44, 0x5d, 0xfa, 0xd2, 0xd5, 0x92, 0x63, 0xf2, 0x26, 0x2b, 0x4e, 0x44, 0x5d, 0xfa,
+    0xf1, 0x51, 0x2b, 0x38, 0x27, 0x6f, 0xb2, 0xd2, 0x64, 0xc4, 0xa5, 0x0f, 0x4f, 0x95, 0x8c, 0xf2, 0x26, 0x2b, 0x4d, 0x46,
+    0x5c, 0xea, 0x7f, 0x84, 0xaa, 0xf3, 0x25, 0x2b, 0xfc, 0xb1, 0xa5, 0xfd, 0x2a, 0x28, 0x4f, 0xf2, 0x34, 0x2b, 0xfc, 0xb1,
+    0xa5, 0x35, 0xf4, 0x2b, 0x28, 0x4f, 0xf2, 0x24, 0x2c, 0xfc, 0xb1, 0xa5, 0x45, 0xf4, 0x2a, 0x28, 0x4f, 0xf3, 0x32, 0x2c,
+    0xfb, 0xa3, 0xa5, 0x45, 0xf5, 0x29, 0x28, 0x5f, 0xf2, 0x22, 0x2d, 0x5b, 0x58, 0x5a, 0x5a, 0x45, 0x2b, 0x2b, 0x28, 0x5f,
+    0xf3, 0x20, 0x2e, 0x5a, 0x5a, 0x59, 0x5a, 0x55, 0x2a, 0x2a, 0x29, 0x6f, 0xd3, 0xe3, 0xa2, 0xa5, 0x95, 0xa5, 0x65, 0xa4,
+    0x84, 0x92, 0xf2, 0x37, 0x3b, 0x0f, 0xa2, 0xa5, 0x95, 0xa5, 0x65, 0xa5, 0x54, 0x94, 0xf2, 0x48, 0x47, 0x1f, 0x92, 0xc5,
+    0x85, 0xa5, 0x75, 0xb5, 0xaa, 0xf2, 0xd9, 0x2f, 0x92, 0xc5, 0x85, 0xa5, 0x85, 0xb5, 0xc7, 0xf2, 0x8b, 0x5f, 0x92,
+};
+
+const uint8_t font[2076] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0x22, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0xff, 0x20, 0x2e, 0x2e, 0xff, 0xff, 0xff, 0x04, 0x1f, 0x22, 0xa2, 0x22, 0xa2, 0x22, 0xf2, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0b, 0xff, 0x25, 0x22, 0x2a, 0x22, 0x2a, 0x22, 0xa7, 0xa6, 0x28, 0x22, 0x2a, 0x22, 0xa8, 0xa6,
+    0x27, 0x22, 0x2a, 0x22, 0x2a, 0x22, 0x2a, 0x22, 0xff, 0xff, 0xef, 0x4f, 0xd2, 0xa4, 0x88, 0x12, 0x12, 0x82, 0x12, 0xb2,
+    0x12, 0xc2, 0xc5, 0xc5, 0x12, 0xb2, 0x12, 0x82, 0x12, 0x12, 0x82, 0x12, 0x12, 0x92, 0xb6, 0xd4, 0xf2, 0xff, 0xff, 0xff,
+    0x33, 0x14, 0x57, 0x12, 0x28, 0x21, 0x11, 0x29, 0x21, 0x11, 0x69, 0x3b, 0x11, 0x1e, 0x31, 0x6b, 0x19, 0x21, 0x21, 0x19,
+    0x21, 0x21, 0x18, 0x22, 0x21, 0x18, 0x52, 0x17, 0x34, 0xff, 0xff, 0xcf, 0xff, 0x25, 0x6c, 0x2a, 0x22, 0x2a, 0x22, 0x4b,
+    0x3c, 0x2c, 0x21, 0x2a, 0x22, 0x21, 0x27, 0x43, 0x27, 0x43, 0x27, 0x24, 0x89, 0x49, 0x22, 0xff, 0xff, 0xbf, 0x1f, 0xe2,
+    0xe2, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x4f, 0xd2, 0xc2, 0xd3, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2,
+    0xe2, 0xe2, 0xe2, 0xf2, 0x20, 0x0f, 0xf2, 0x20, 0xff, 0xff, 0x0f, 0x1f, 0xf2, 0x20, 0x0f, 0xe3, 0xe2, 0xe2, 0xe2, 0xe2,
+    0xe2, 0xe2, 0xe2, 0xe2, 0xd2, 0xd2, 0xd2, 0xf2, 0xff, 0xff, 0x03, 0xff, 0x16, 0x2c, 0x11, 0x21, 0x3b, 0x9a, 0x3a, 0x1c,
+    0x11, 0x11, 0x1a, 0x12, 0x12, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0xff, 0xff, 0x8f, 0xe2, 0xe2, 0xb2, 0x88, 0xb8,
+    0xe2, 0xe2, 0xf2, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xe2, 0xe2, 0xd2, 0xf2, 0xff, 0x2f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x8a, 0x88, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xe2,
+    0xe2, 0xf2, 0xff, 0xff, 0x03, 0xff, 0x29, 0x2d, 0x2d, 0x2e, 0x2d, 0x2e, 0x2d, 0x2e, 0x2d, 0x2e, 0x2d, 0x2e, 0x2d, 0xff,
+    0xff, 0xff, 0x04, 0xff, 0x44, 0x6b, 0x29, 0x24, 0x28, 0x24, 0x28, 0x24, 0x28, 0x21, 0x21, 0x28, 0x21, 0x21, 0x28, 0x24,
+    0x28, 0x24, 0x28, 0x24, 0x29, 0x22, 0x6a, 0x4b, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xc2, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2,
+    0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xf2, 0xff, 0xff, 0x01, 0xff, 0x44, 0x8a, 0x28, 0x24, 0x2e, 0x2e, 0x2d, 0x2d, 0x2d, 0x2d,
+    0x2d, 0x2d, 0x8e, 0x88, 0xff, 0xff, 0xdf, 0xff, 0x5f, 0xa4, 0x88, 0x42, 0xe2, 0xe2, 0xb2, 0xc4, 0xf4, 0x20, 0x2e, 0x28,
+    0x24, 0x28, 0x24, 0x69, 0x4b, 0xff, 0xff, 0x0e, 0xff, 0x18, 0x3d, 0x4c, 0x2b, 0x21, 0x2a, 0x22, 0x29, 0x23, 0x29, 0x23,
+    0x29, 0x23, 0x89, 0x88, 0x2d, 0x2e, 0x2e, 0xff, 0xff, 0xef, 0xff, 0x3f, 0x88, 0x88, 0xe2, 0xe2, 0xa6, 0x97, 0x42, 0xe2,
+    0xe2, 0x82, 0x42, 0x82, 0x42, 0x92, 0xb6, 0xf4, 0xff, 0xef, 0xff, 0x44, 0x8a, 0x28, 0x2e, 0x2e, 0x31, 0x7a, 0x29, 0x24,
+    0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x69, 0x4b, 0xff, 0xff, 0xff, 0xff, 0x82, 0x88, 0x2d, 0x2e, 0x2d, 0x2e,
+    0x2d, 0x2e, 0x2d, 0x2e, 0x2d, 0x2e, 0x2e, 0xff, 0xff, 0xff, 0x03, 0xff, 0x44, 0x8a, 0x28, 0x24, 0x28, 0x24, 0x29, 0x22,
+    0x4b, 0x2b, 0x22, 0x29, 0x24, 0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x69, 0x4b, 0xff, 0xff, 0xff, 0xff, 0x44, 0x8a, 0x28,
+    0x24, 0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x79, 0x3a, 0x21, 0x2e, 0x2e, 0x28, 0x24, 0x69, 0x4b, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x26, 0x2e, 0x2e, 0xff, 0xff, 0x3f, 0xe2, 0xe2, 0xf2, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x27, 0x2e, 0x2e,
+    0xff, 0xff, 0x3f, 0xe2, 0xe2, 0xd2, 0xf2, 0xff, 0x2f, 0xff, 0x8f, 0xc3, 0xd2, 0xd2, 0xd2, 0xd2, 0xf2, 0x20, 0x0f, 0xf2,
+    0x20, 0x0f, 0xf2, 0x20, 0x0f, 0xf2, 0xff, 0xff, 0x0d, 0xff, 0xff, 0xff, 0x86, 0x88, 0xff, 0x8a, 0x88, 0xff, 0xff, 0xff,
+    0xff, 0x1f, 0xff, 0x3f, 0xf3, 0x20, 0x0f, 0xf2, 0x20, 0x0f, 0xf2, 0x20, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0xff, 0xff,
+    0xff, 0x04, 0xff, 0x44, 0x8a, 0x28, 0x24, 0x28, 0x24, 0x2e, 0x2d, 0x2d, 0x2d, 0x2e, 0xff, 0x20, 0x2e, 0x2e, 0xff, 0xff,
+    0xff, 0x01, 0xff, 0x64, 0x28, 0x26, 0x16, 0x22, 0x21, 0x11, 0x16, 0x61, 0x11, 0x16, 0x21, 0x22, 0x11, 0x16, 0x21, 0x22,
+    0x11, 0x16, 0x21, 0x22, 0x11, 0x16, 0x21, 0x22, 0x11, 0x16, 0x61, 0x11, 0x16, 0x22, 0x21, 0x11, 0x16, 0x26, 0x18, 0x1f,
+    0xf6, 0xff, 0xff, 0x0d, 0xff, 0x16, 0x3e, 0x3d, 0x2c, 0x21, 0x2b, 0x21, 0x2b, 0x21, 0x2a, 0x23, 0x29, 0x23, 0x79, 0x98,
+    0x27, 0x25, 0x27, 0x25, 0x27, 0x25, 0xff, 0xff, 0xcf, 0xff, 0x62, 0x8a, 0x28, 0x24, 0x28, 0x24, 0x78, 0x79, 0x29, 0x24,
+    0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x78, 0x69, 0xff, 0xff, 0xff, 0xff, 0x54, 0x8a, 0x27, 0x25, 0x27, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x25, 0x27, 0x25, 0x78, 0x5a, 0xff, 0xff, 0xef, 0xff, 0x62, 0x8a, 0x28, 0x25, 0x27, 0x25,
+    0x27, 0x25, 0x27, 0x25, 0x27, 0x25, 0x27, 0x25, 0x27, 0x25, 0x27, 0x25, 0x27, 0x24, 0x78, 0x69, 0xff, 0xff, 0xff, 0xff,
+    0x92, 0x97, 0x27, 0x2e, 0x2e, 0x8e, 0x88, 0x28, 0x2e, 0x2e, 0x2e, 0x9e, 0x97, 0xff, 0xff, 0xcf, 0xff, 0x92, 0x97, 0x27,
+    0x2e, 0x2e, 0x8e, 0x88, 0x28, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0xff, 0xff, 0xff, 0x04, 0xff, 0x54, 0x99, 0x27, 0x25, 0x27,
+    0x2e, 0x2e, 0x2e, 0x43, 0x27, 0x43, 0x27, 0x25, 0x27, 0x25, 0x27, 0x25, 0x88, 0x49, 0x21, 0xff, 0xff, 0xcf, 0xff, 0x3f,
+    0x52, 0x72, 0x52, 0x72, 0x52, 0x72, 0x52, 0x72, 0x52, 0x72, 0x79, 0x79, 0x52, 0x72, 0x52, 0x72, 0x52, 0x72, 0x52, 0x72,
+    0x52, 0x72, 0x52, 0xf2, 0xff, 0xbf, 0xff, 0x62, 0x6a, 0x2c, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x6c, 0x6a,
+    0xff, 0xff, 0xff, 0xff, 0x28, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x28, 0x24, 0x28, 0x24, 0x69, 0x4b, 0xff,
+    0xff, 0xff, 0xff, 0x22, 0x25, 0x27, 0x33, 0x28, 0x22, 0x2a, 0x21, 0x4b, 0x3c, 0x4d, 0x2c, 0x21, 0x2b, 0x22, 0x2a, 0x23,
+    0x29, 0x24, 0x28, 0x25, 0x27, 0x25, 0xff, 0xff, 0xcf, 0xff, 0x22, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x9e, 0x97, 0xff, 0xff, 0xcf, 0xff, 0x3f, 0x62, 0x62, 0x43, 0x63, 0x43, 0x63, 0x24, 0x64, 0x24, 0x64, 0x24, 0x64,
+    0x6a, 0x12, 0x14, 0x62, 0x12, 0x14, 0x62, 0x22, 0x22, 0x62, 0x22, 0x22, 0x62, 0x62, 0x62, 0x62, 0xf2, 0xff, 0xaf, 0xff,
+    0x22, 0x25, 0x37, 0x24, 0x47, 0x23, 0x47, 0x23, 0x27, 0x21, 0x22, 0x27, 0x21, 0x22, 0x27, 0x22, 0x21, 0x27, 0x22, 0x21,
+    0x27, 0x43, 0x27, 0x43, 0x27, 0x34, 0x27, 0x34, 0x27, 0x25, 0xff, 0xff, 0xcf, 0xff, 0x54, 0x99, 0x27, 0x25, 0x27, 0x25,
+    0x27, 0x25, 0x27, 0x25, 0x27, 0x25, 0x27, 0x25, 0x27, 0x25, 0x27, 0x25, 0x27, 0x25, 0x78, 0x5a, 0xff, 0xff, 0xef, 0xff,
+    0x62, 0x8a, 0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x78, 0x69, 0x2a, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0xff, 0xff, 0xff, 0x04,
+    0xff, 0x54, 0x99, 0x27, 0x25, 0x27, 0x25, 0x27, 0x25, 0x27, 0x25, 0x27, 0x25, 0x27, 0x25, 0x27, 0x25, 0x27, 0x21, 0x22,
+    0x27, 0x22, 0x21, 0x78, 0x6a, 0x0f, 0xf2, 0xff, 0xbf, 0xff, 0x62, 0x8a, 0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x78, 0x69,
+    0x2a, 0x23, 0x29, 0x23, 0x29, 0x24, 0x28, 0x24, 0x28, 0x24, 0x28, 0x25, 0xff, 0xff, 0xcf, 0xff, 0x54, 0x99, 0x27, 0x25,
+    0x27, 0x2e, 0x0f, 0xb6, 0xf6, 0x20, 0x2e, 0x27, 0x25, 0x27, 0x25, 0x78, 0x5a, 0xff, 0xff, 0xef, 0xff, 0xa2, 0xa6, 0x2a,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0xff, 0xff, 0xff, 0xff, 0x22, 0x25, 0x27, 0x25, 0x27, 0x25,
+    0x27, 0x25, 0x27, 0x25, 0x27, 0x25, 0x27, 0x25, 0x27, 0x25, 0x27, 0x25, 0x27, 0x25, 0x27, 0x25, 0x78, 0x5a, 0xff, 0xff,
+    0xef, 0xff, 0x22, 0x24, 0x28, 0x24, 0x28, 0x24, 0x29, 0x22, 0x2a, 0x22, 0x2a, 0x22, 0x2a, 0x22, 0x4b, 0x4c, 0x4c, 0x2d,
+    0x2e, 0x2e, 0xff, 0xff, 0xff, 0x01, 0xff, 0x22, 0x26, 0x26, 0x26, 0x26, 0x22, 0x22, 0x26, 0x22, 0x22, 0x27, 0x21, 0x21,
+    0x28, 0x21, 0x21, 0x28, 0x21, 0x21, 0x28, 0x21, 0x21, 0x28, 0x21, 0x21, 0x69, 0x2a, 0x22, 0x2a, 0x22, 0x2a, 0x22, 0xff,
+    0xff, 0xdf, 0xff, 0x22, 0x25, 0x37, 0x33, 0x28, 0x23, 0x29, 0x23, 0x2a, 0x21, 0x3c, 0x3d, 0x2c, 0x21, 0x2a, 0x23, 0x29,
+    0x23, 0x29, 0x23, 0x28, 0x25, 0x27, 0x25, 0xff, 0xff, 0xcf, 0xff, 0x22, 0x24, 0x28, 0x24, 0x29, 0x22, 0x2a, 0x22, 0x2a,
+    0x22, 0x4b, 0x2d, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0xff, 0xff, 0xff, 0x01, 0xff, 0x92, 0x97, 0x2c, 0x2e, 0x2d, 0x2e,
+    0x2d, 0x2e, 0x2d, 0x2e, 0x2d, 0x9d, 0x97, 0xff, 0xff, 0xcf, 0x1f, 0xc4, 0xc4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2,
+    0xe2, 0xe2, 0xe2, 0xe2, 0xc4, 0xf4, 0xff, 0xff, 0x01, 0xff, 0x22, 0x0f, 0xf2, 0x20, 0x2e, 0x0f, 0xe2, 0xf2, 0x20, 0x2e,
+    0x0f, 0xe2, 0xf2, 0x20, 0x2e, 0x0f, 0xf2, 0xff, 0xff, 0x0c, 0x1f, 0xc4, 0xe4, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2,
+    0xe2, 0xe2, 0xe2, 0xc2, 0xc4, 0xf4, 0xff, 0xff, 0x01, 0x22, 0x4d, 0x2b, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x06, 0xff, 0xff, 0xff, 0xff, 0x59,
+    0x7a, 0x29, 0x23, 0x2d, 0x2d, 0x3d, 0x3c, 0x3c, 0x7d, 0x79, 0xff, 0x0b, 0xff, 0xff, 0xff, 0x48, 0x6b, 0x1a, 0x24, 0x3d,
+    0x6a, 0x49, 0x21, 0x28, 0x24, 0x28, 0x24, 0x79, 0x3a, 0x21, 0xff, 0xff, 0x0c, 0xff, 0x3f, 0xe2, 0xe2, 0xe2, 0x12, 0xa3,
+    0x97, 0x42, 0x82, 0x42, 0x82, 0x42, 0x82, 0x42, 0x82, 0x42, 0x82, 0x42, 0x82, 0x97, 0x12, 0xf3, 0xff, 0xef, 0xff, 0xff,
+    0xff, 0x48, 0x6b, 0x29, 0x24, 0x28, 0x2e, 0x2e, 0x2e, 0x2e, 0x24, 0x69, 0x4b, 0xff, 0xff, 0x0e, 0xff, 0x9f, 0xe2, 0xe2,
+    0xa2, 0x13, 0x92, 0x87, 0x42, 0x82, 0x42, 0x82, 0x42, 0x82, 0x42, 0x82, 0x42, 0x82, 0x42, 0x92, 0xa7, 0x13, 0xf2, 0xff,
+    0xcf, 0xff, 0xff, 0xff, 0x48, 0x6b, 0x29, 0x24, 0x28, 0x24, 0x88, 0x88, 0x28, 0x2e, 0x24, 0x69, 0x4b, 0xff, 0xff, 0x0e,
+    0xff, 0x35, 0x4c, 0x2c, 0x6c, 0x6a, 0x2c, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff,
+    0xff, 0x38, 0x21, 0x79, 0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x79, 0x3a, 0x21, 0x2e,
+    0x2e, 0x69, 0x5a, 0x0a, 0xff, 0x22, 0x2e, 0x2e, 0x2e, 0x31, 0x7a, 0x29, 0x24, 0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x28,
+    0x24, 0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0xff, 0xff, 0xdf, 0xff, 0x3f, 0xe2, 0xf2, 0x0f, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2,
+    0xe2, 0xe2, 0xe2, 0xe3, 0xf2, 0xff, 0xff, 0x02, 0xff, 0x24, 0x2e, 0xff, 0x20, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x3c, 0x2d, 0xff, 0xff, 0x22, 0x2e, 0x2e, 0x2e, 0x24, 0x28, 0x23, 0x29, 0x22, 0x2a, 0x21, 0x4b,
+    0x4c, 0x2c, 0x21, 0x2b, 0x22, 0x2a, 0x23, 0x29, 0x24, 0xff, 0xff, 0xdf, 0xff, 0x3f, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe2,
+    0xe2, 0xe2, 0xe2, 0xe2, 0xe2, 0xe3, 0xf2, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0x26, 0x21, 0x21, 0x98, 0x27, 0x22, 0x22,
+    0x26, 0x22, 0x22, 0x26, 0x22, 0x22, 0x26, 0x22, 0x22, 0x26, 0x22, 0x22, 0x26, 0x22, 0x22, 0x26, 0x22, 0x22, 0x26, 0x22,
+    0x22, 0xff, 0xff, 0x0a, 0xff, 0xff, 0xff, 0x26, 0x31, 0x7a, 0x29, 0x24, 0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x28, 0x24,
+    0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0x48, 0x6b, 0x29, 0x24, 0x28, 0x24, 0x28, 0x24,
+    0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x69, 0x4b, 0xff, 0xff, 0x0e, 0xff, 0xff, 0xff, 0x26, 0x31, 0x7a, 0x29, 0x24, 0x28,
+    0x24, 0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x78, 0x29, 0x31, 0x2a, 0x2e, 0x2e, 0x2e, 0x0e, 0xff, 0xff, 0xff,
+    0x38, 0x21, 0x79, 0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x79, 0x3a, 0x21, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x08, 0xff, 0xff, 0xff, 0x26, 0x31, 0x6a, 0x2a, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0xff, 0xff, 0x3f,
+    0xff, 0xff, 0xff, 0x48, 0x6b, 0x29, 0x24, 0x28, 0x0f, 0xc5, 0xf5, 0x20, 0x28, 0x24, 0x69, 0x4b, 0xff, 0xff, 0x0e, 0xff,
+    0xff, 0x26, 0x2e, 0x6c, 0x6a, 0x2c, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x4e, 0x3d, 0xff, 0xff, 0x0e, 0xff, 0xff, 0xff, 0x26,
+    0x24, 0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x79, 0x3a, 0x21, 0xff, 0xff,
+    0x0c, 0xff, 0xff, 0xff, 0x26, 0x24, 0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x29, 0x22, 0x2a, 0x22, 0x2a, 0x22, 0x4b, 0x2d,
+    0x2e, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x22, 0x22, 0x27, 0x21, 0x21, 0x28,
+    0x21, 0x21, 0x88, 0x29, 0x22, 0x2a, 0x22, 0x2a, 0x22, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0x26, 0x24, 0x28, 0x24, 0x29,
+    0x22, 0x4b, 0x2d, 0x4d, 0x2b, 0x22, 0x29, 0x24, 0x28, 0x24, 0x28, 0x24, 0xff, 0xff, 0x0c, 0xff, 0xff, 0xff, 0x26, 0x24,
+    0x28, 0x24, 0x28, 0x24, 0x28, 0x24, 0x29, 0x22, 0x2a, 0x22, 0x2a, 0x22, 0x2a, 0x22, 0x4b, 0x2d, 0x2d, 0x2e, 0x3c, 0x2d,
+    0x0e, 0xff, 0xff, 0xff, 0x86, 0x88, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x8e, 0x88, 0xff, 0xff, 0x0c, 0x4f, 0xc3, 0xc4,
+    0xe2, 0xe2, 0xe2, 0xc2, 0xd3, 0xf3, 0x20, 0x2e, 0x2e, 0x2e, 0x2e, 0x4e, 0x3d, 0xff, 0xff, 0x0e, 0x20, 0x2e, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x2e, 0x0e, 0x1f, 0xd3, 0xe4,
+    0xe2, 0xe2, 0xe2, 0xf2, 0x30, 0x3d, 0x2c, 0x2e, 0x2e, 0x2e, 0x2e, 0x4c, 0x3c, 0xff, 0xff, 0x2f, 0x21, 0x21, 0x6a, 0x2a,
+    0x21, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0d, 0xff, 0xff, 0x9f, 0xe1, 0x11, 0xc1, 0x31, 0xa1, 0x51,
+    0x81, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0xf9, 0xff, 0xbf,
+};
+const uint16_t font_idx[96] = {
+    0, 11, 29, 45, 71, 99, 132, 158, 171, 191, 211, 232, 247, 260, 272, 285,
+    303, 331, 349, 367, 388, 410, 430, 453, 471, 496, 519, 534, 549, 569, 582, 602,
+    622, 664, 689, 713, 733, 759, 776, 794, 818, 846, 863, 882, 909, 926, 959, 993,
+    1019, 1040, 1069, 1095, 1116, 1133, 1161, 1186, 1222, 1250, 1273, 1290, 1309, 1330, 1349, 1363,
+    1375, 1392, 1413, 1438, 1456, 1481, 1500, 1518, 1544, 1570, 1588, 1607, 1632, 1650, 1684, 1709,
+    1731, 1757, 1783, 1800, 1819, 1836, 1861, 1884, 1912, 1935, 1961, 1977, 1996, 2017, 2036, 2051,
+};
+
+const uint8_t pix_power_on_text[607] = {
+    0x30, 0x3a, 0x6f, 0xf3, 0x30, 0x3a, 0xff, 0x32, 0x39, 0xff, 0x3c, 0x3a, 0x6f, 0xf3, 0x30, 0x3a, 0xff, 0x32, 0x39, 0xff,
+    0x3c, 0x3a, 0x6f, 0xf3, 0x30, 0x3a, 0xff, 0x32, 0x39, 0xff, 0x3c, 0x3a, 0x6f, 0xf3, 0x30, 0x3a, 0xff, 0x32, 0x39, 0xff,
+    0x3c, 0x3a, 0x6f, 0xf3, 0x30, 0x3a, 0xff, 0x32, 0x39, 0xff, 0x3c, 0x3a, 0x6f, 0xf3, 0x30, 0x3a, 0xff, 0x32, 0x39, 0xff,
+    0x3c, 0x3a, 0x77, 0x37, 0x67, 0x32, 0x3a, 0x62, 0x37, 0x37, 0xa2, 0xa2, 0x75, 0xaf, 0xa3, 0x63, 0x69, 0x63, 0xac, 0x13,
+    0x59, 0x73, 0x23, 0x2a, 0x4a, 0x59, 0x23, 0x86, 0xa3, 0x53, 0x34, 0x54, 0x53, 0x34, 0xa6, 0x27, 0x45, 0x73, 0x23, 0x2a,
+    0x3a, 0x34, 0x44, 0x13, 0x78, 0x1f, 0x34, 0x37, 0x34, 0x34, 0x47, 0x5a, 0x46, 0x33, 0x37, 0x34, 0x39, 0x37, 0x37, 0x73,
+    0x51, 0xf6, 0x41, 0x83, 0x33, 0x33, 0x93, 0xa3, 0x84, 0x33, 0x73, 0x43, 0x93, 0x73, 0x83, 0x23, 0x55, 0x63, 0x1f, 0x33,
+    0x39, 0x33, 0x33, 0x39, 0x3a, 0x2a, 0x33, 0x37, 0x34, 0x39, 0x36, 0x39, 0x42, 0x37, 0x35, 0x3a, 0x23, 0x2b, 0x33, 0x33,
+    0x39, 0x3a, 0x2a, 0x33, 0x37, 0x34, 0x39, 0x26, 0x2b, 0x32, 0x38, 0x35, 0x3a, 0x23, 0x2b, 0x33, 0x33, 0x39, 0x3a, 0x2a,
+    0x33, 0x37, 0x34, 0x39, 0x26, 0x2b, 0x32, 0x38, 0x35, 0x3a, 0x23, 0x2b, 0x33, 0x33, 0x39, 0x3a, 0x2a, 0x33, 0x37, 0x34,
+    0x39, 0x26, 0x2b, 0x32, 0x38, 0x35, 0x3a, 0x33, 0x39, 0x33, 0x33, 0x39, 0x3a, 0x39, 0x33, 0x37, 0x34, 0x39, 0x36, 0x39,
+    0x32, 0x38, 0x35, 0x3a, 0x34, 0x38, 0x33, 0x34, 0x38, 0x4a, 0x38, 0x33, 0x37, 0x34, 0x39, 0x37, 0x38, 0x32, 0x38, 0x35,
+    0x3a, 0x34, 0x37, 0x34, 0x34, 0x47, 0x5a, 0x36, 0x35, 0x35, 0x36, 0x39, 0x36, 0x37, 0x33, 0x38, 0x35, 0x3a, 0x45, 0x43,
+    0x35, 0x45, 0x63, 0x7a, 0x52, 0x55, 0x51, 0x46, 0x22, 0x44, 0x22, 0x42, 0x43, 0x34, 0x38, 0x35, 0x3a, 0x96, 0x36, 0xc6,
+    0x3a, 0x91, 0x88, 0x78, 0x75, 0x93, 0x35, 0x38, 0x35, 0x3a, 0x77, 0x37, 0x67, 0x32, 0x3a, 0x62, 0x4c, 0x5b, 0x57, 0x75,
+    0x36, 0x38, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x3b, 0xff, 0x31, 0xff, 0xff, 0xff, 0xff, 0x33, 0xff, 0x31, 0xff, 0xff, 0xff, 0xff, 0x33, 0xff, 0x31, 0xff, 0xff,
+    0xff, 0xff, 0x33, 0xff, 0x31, 0xff, 0xff, 0xff, 0xff, 0x33, 0xff, 0x31, 0xff, 0xff, 0xff, 0xff, 0x33, 0xff, 0x31, 0xff,
+    0xff, 0xff, 0xff, 0xa1, 0x76, 0xab, 0x33, 0x37, 0x33, 0x41, 0x32, 0x62, 0x0f, 0x67, 0x23, 0xf6, 0x7f, 0x5a, 0xa9, 0x3a,
+    0x73, 0x33, 0x28, 0x13, 0xd8, 0x59, 0x13, 0xf8, 0x6f, 0x4a, 0x34, 0x94, 0x3a, 0x73, 0x33, 0x28, 0x17, 0xb5, 0x34, 0x44,
+    0x17, 0xf5, 0x7f, 0x83, 0x73, 0xa3, 0x83, 0x73, 0x33, 0x64, 0x55, 0xa3, 0x73, 0x33, 0x55, 0xf3, 0x7f, 0x83, 0x83, 0x93,
+    0x83, 0x73, 0x33, 0x73, 0x74, 0x93, 0x83, 0x23, 0x74, 0xf3, 0x6f, 0x73, 0x93, 0x93, 0x83, 0x73, 0x33, 0x73, 0x83, 0x83,
+    0x93, 0x23, 0x83, 0xf3, 0x6f, 0x73, 0xb2, 0x92, 0x83, 0x73, 0x33, 0x73, 0x83, 0x83, 0xb2, 0x22, 0x83, 0xf3, 0x6f, 0x73,
+    0xb2, 0x92, 0x83, 0x73, 0x33, 0x73, 0x83, 0x83, 0xb2, 0x22, 0x83, 0xf3, 0x6f, 0x73, 0xb2, 0x92, 0x83, 0x73, 0x33, 0x73,
+    0x83, 0x83, 0xb2, 0x22, 0x83, 0xf3, 0x6f, 0x73, 0x93, 0x93, 0x83, 0x73, 0x33, 0x73, 0x83, 0x83, 0x93, 0x23, 0x83, 0xf3,
+    0x6f, 0x83, 0x83, 0x93, 0x83, 0x73, 0x33, 0x73, 0x83, 0x93, 0x83, 0x23, 0x83, 0xf3, 0x7f, 0x73, 0x73, 0xb3, 0x83, 0x53,
+    0x43, 0x73, 0x83, 0x93, 0x73, 0x33, 0x83, 0xf3, 0x7f, 0x24, 0x32, 0x34, 0xc4, 0x24, 0x23, 0x15, 0x45, 0x73, 0x83, 0xa3,
+    0x34, 0x44, 0x83, 0xf3, 0x8f, 0x47, 0xe9, 0x48, 0x58, 0x73, 0x83, 0xb3, 0x59, 0x83, 0xf3, 0x9f, 0x65, 0xf7, 0x43, 0x47,
+    0x37, 0x37, 0x38, 0x7c, 0x36, 0xff, 0x01,
+};
@@ -21,6 +21,12 @@ extern uint8_t ttask_slow_mode;
 static ui_blink_t ui_blink_slc = UI_BLINK_NONE;
 // 闪烁项目的显示状态
 static ui_bool_t ui_blink_state = UI_BOOL_TRUE;
+// 画布上已按哪个闪烁项目绘制了主页, 不一致时需要整页重绘
+static ui_blink_t ui_blink_drawn = UI_BLINK_NONE;
+// 本次更新只有闪烁翻转
+static bool ui_blink_only = false;
+// 闪烁元素所在的行, LCD_REFRESH会让出, 不能用局部变量
+static ui_rect_t blink_rows;
 // 闪烁图标定时器, 重复模式@500ms
 APP_TIMER_DEF(ui_blink_timer);
 // 闪烁图标超时计时,5秒
@@ -87,6 +93,7 @@ void ui_draw_main_page(void)
     // 内存画布绘制主页
     ui_set_disp_page(UI_PAGE_MAIN);
     ui_draw_bkg();
+    ui_blink_drawn = UI_BLINK_NONE;
 
     if (EventGroupCheckBits(event_group_system, EVT_CO2_SENSOR_ERROR))
     {
@@ -211,6 +218,94 @@ void ui_draw_main_page(void)
     {
         EventGroupClearBits(event_group_system, EVT_FLIGHT_MODE_UPDATE);
     }
+
+    ui_blink_drawn = ui_blink_slc;
+}
+
+/**
+ * @brief 闪烁翻转时只重绘闪烁的元素, 画法与ui_draw_main_page一致
+ *
+ * 各闪烁元素在主页上不与其它元素重叠, 只重绘它不会影响画布其它内容.
+ * 与其它元素重叠(免打扰图标盖住震动图标)或画布不是按当前闪烁项目
+ * 绘制的, 返回0, 由调用者整页重绘.
+ *
+ * @param rows 返回需要刷新的行
+ * @return uint8_t 1已重绘, 0需要整页重绘
+ */
+static uint8_t ui_draw_blink_layer(ui_rect_t *rows)
+{
+    ui_rect_t *rect;
+    uint16_t   co2_value_now;
+
+    if (ui_blink_slc == UI_BLINK_NONE || ui_blink_slc != ui_blink_drawn || ui_get_disp_page() != UI_PAGE_MAIN)
+    {
+        return 0;
+    }
+
+    if ((ui_blink_slc == UI_BLINK_ALARM || ui_blink_slc == UI_BLINK_VIBRATOR) && is_dnd_time())
+    {
+        return 0;
+    }
+
+    if (ui_blink_slc == UI_BLINK_ALARM)
+    {
+        ui_draw_buzzer((ui_bool_t)get_buzzer_state(), ui_blink_state);
+        rect = &elem_alarm.rect;
+    }
+    else if (ui_blink_slc == UI_BLINK_VIBRATOR)
+    {
+        if (cfg_fstorage_get_dnd_mode())
+        {
+            return 0;
+        }
+        ui_draw_vibrator((ui_bool_t)get_vibrator_state(), ui_blink_state);
+        rect = &elem_vibrator.rect;
+    }
+    else if (ui_blink_slc == UI_BLINK_HOUR)
+    {
+        ui_draw_hour(get_time_now_hour24(), ui_blink_state);
+        rect = &elem_time_h10.rect;
+    }
+    else if (ui_blink_slc == UI_BLINK_MINUTE)
+    {
+        ui_draw_minute(get_time_now_minute(), ui_blink_state);
+        rect = &elem_time_m10.rect;
+    }
+    else if (ui_blink_slc == UI_BLINK_CO2_VALUE)
+    {
+        co2_value_now = get_co2_value();
+        if (co2_value_now < 400 && co2_value_now > 0)
+        {
+            co2_value_now = 400;
+        }
+        ui_draw_co2_ppm(co2_value_now, ui_blink_state);
+        rect = &elem_ppm_1000x.rect;
+    }
+    else if (ui_blink_slc == UI_BLINK_CO2_FREQUENCY)
+    {
+        ui_draw_co2_frequency(get_power_mode(), ui_blink_state);
+        rect = &elem_power_mode.rect;
+    }
+    else if (ui_blink_slc == UI_BLINK_CO2_PPM_LABEL)
+    {
+        ui_draw_co2_ppm_label(ui_blink_state);
+        rect = &elem_co2_ppm_label.rect;
+    }
+    else if (ui_blink_slc == UI_BLINK_BLE)
+    {
+        ui_draw_ble((ui_bool_t)get_ble_state(), ui_blink_state);
+        rect = &elem_ble.rect;
+    }
+    else
+    {
+        return 0;
+    }
+
+    rows->x = 0;
+    rows->y = rect->y;
+    rows->w = LCD_WIDTH;
+    rows->h = rect->h;
+    return 1;
 }
 
 /**设置passkey */
@@ -416,7 +511,7 @@ TaskDefine(task_ui)
                     LCD_RELEASE();
 
                     TaskDelay(1000 / TICK_RATE_MS);
-                    if (cali_time_sec == 0) break;
+                    if (cali_time_sec == 0 || is_co2_calib_converged()) break; // the countdown is the longest calibration
                 }
                 EventGroupClearBits(event_group_system, EVT_CO2_CALIB_TIMING);
 
@@ -442,7 +537,8 @@ TaskDefine(task_ui)
 
                 proto_send_recali_done(correction_value);
 
-                // wait 3 seconds
+                // wait 3 seconds, the calibration may have ended before the countdown did
+                cali_time_sec = 0;
                 while (1)
                 {
                     cali_time_sec += 1;
@@ -454,6 +550,7 @@ TaskDefine(task_ui)
 
                 // convert int16_t to uint16_t for history record
                 add_history_record(cc_new, RECORD_TYPE_CALIBRATION_CORRECTION);
+                add_history_record(get_co2_calib_confidence(), RECORD_TYPE_CALIB_CONFIDENCE);
 
                 // wait for the co2 update to be done if it is not done
                 EventGroupWaitBits(event_group_system, EVT_UI_UP_CO2, TICK_MAX);
@@ -572,8 +669,8 @@ TaskDefine(task_ui)
                     {
                     default:
                     case UI_BLINK_NONE:
-                        // Note: EVT_CO2_SENSOR_ERROR handling removed - 3rd error auto-reboots device
-                        // No user interaction possible during 2s delay before reboot
+                        // Note: in degraded mode EVT_CO2_SENSOR_ERROR keeps the error page shown,
+                        // the press only redraws it until the sensor recovers
                         app_timer_stop(ui_blink_timer);
                         app_timer_start(ui_blink_timer, APP_TIMER_TICKS(300), NULL);
                         ui_blink_slc   = UI_BLINK_CO2_VALUE;
@@ -625,6 +722,8 @@ TaskDefine(task_ui)
 
                 if (EventGroupCheckBits(event_group_system, EVT_UI_UPDATE))
                 {
+                    ui_blink_only = EventGroupGetBits(event_group_system, EVT_UI_UPDATE) == EVT_UI_BLINK;
+
                     if (EventGroupCheckBits(event_group_system, EVT_UI_UP_CO2))
                     {
                         EventGroupClearBits(event_group_system, EVT_UI_UP_CO2);
@@ -635,8 +734,15 @@ TaskDefine(task_ui)
                         }
                     }
 
-                    ui_draw_main_page();
-                    LCD_REFRESH(&rect_full_screen);
+                    if (ui_blink_only && ui_draw_blink_layer(&blink_rows))
+                    {
+                        LCD_REFRESH(&blink_rows); // 只刷新闪烁元素所在的行
+                    }
+                    else
+                    {
+                        ui_draw_main_page();
+                        LCD_REFRESH(&rect_full_screen);
+                    }
                     LCD_RELEASE();
 
                     EventGroupClearBits(event_group_system, EVT_UI_UPDATE & ~(EVT_UI_UP_CO2 | EVT_UI_OFF_SCREEN | EVT_BAT_LOW | EVT_BAT_LOW_WARNING));
@@ -681,6 +787,11 @@ void ui_blink_timer_handler(void *pcontext)
     // print("ui blink timer %d\n", ui_blink_state);
 }
 
+bool ui_is_blinking(void)
+{
+    return ui_blink_slc != UI_BLINK_NONE;
+}
+
 void off_screen_timer_handler(void *pcontext)
 {
 
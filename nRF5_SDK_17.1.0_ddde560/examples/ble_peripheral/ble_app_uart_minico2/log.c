@@ -0,0 +1,71 @@
+#include "log.h"
+
+#ifdef USE_SEGGER_RTT
+
+#include "app_util_platform.h"
+#include "ttask.h"
+#include <string.h>
+
+uint8_t dlog_levels[DLOG_MODULE_COUNT] = {
+    [DLOG_MODULE_MAIN]     = DLOG_LEVEL_MAIN,
+    [DLOG_MODULE_CO2]      = DLOG_LEVEL_CO2,
+    [DLOG_MODULE_HISTORY]  = DLOG_LEVEL_HISTORY,
+    [DLOG_MODULE_PROTOCOL] = DLOG_LEVEL_PROTOCOL,
+    [DLOG_MODULE_UI]       = DLOG_LEVEL_UI,
+};
+
+/** Backing store of the RTT up buffer, the host drains it while the CPU runs */
+static uint8_t dlog_buffer[DLOG_BUFFER_SIZE];
+
+void dlog_init(void)
+{
+    SEGGER_RTT_ConfigUpBuffer(DLOG_RTT_CHANNEL, "dlog", dlog_buffer, sizeof(dlog_buffer), SEGGER_RTT_MODE_NO_BLOCK_SKIP);
+}
+
+void dlog_set_level(dlog_module_t module, uint8_t level)
+{
+    if (module < DLOG_MODULE_COUNT)
+    {
+        dlog_levels[module] = level;
+    }
+}
+
+/**
+ * The record is assembled on the stack and written with a single
+ * SEGGER_RTT_Write so records from interrupts never interleave; in skip mode a
+ * record that does not fit is dropped as a whole.
+ */
+void dlog_write(uint32_t header, const char *fmt, const uint32_t *args, uint8_t count)
+{
+    uint32_t record[2 + 8];
+
+    if (count > 8) count = 8;
+
+    record[0] = (uint32_t)fmt;
+    record[1] = header | (GetSystemTickCount() << 16) | count;
+    memcpy(&record[2], args, count * 4);
+
+    SEGGER_RTT_Write(DLOG_RTT_CHANNEL, record, (2 + count) * 4);
+}
+
+void dlog_write_hex(uint32_t header, const char *info, const uint8_t *data, uint16_t len)
+{
+    uint32_t record[2 + DLOG_MAX_HEX / 4];
+    uint16_t n;
+
+    while (len > 0)
+    {
+        n = len > DLOG_MAX_HEX ? DLOG_MAX_HEX : len;
+
+        record[0] = (uint32_t)info;
+        record[1] = header | (GetSystemTickCount() << 16) | (n & 0xFF);
+        memcpy(&record[2], data, n);
+
+        SEGGER_RTT_Write(DLOG_RTT_CHANNEL, record, 8 + ((n + 3) & ~3));
+
+        data += n;
+        len -= n;
+    }
+}
+
+#endif
@@ -1,11 +1,75 @@
 #ifndef __LOG_H__
 #define __LOG_H__
 
+#include <stdint.h>
+
 #define USE_SEGGER_RTT 1
 
+/**
+ * Deferred logging.
+ * dlog_x() does not format on the device: it writes a binary record with the
+ * address of the format string and the raw 32-bit arguments to RTT up buffer
+ * DLOG_RTT_CHANNEL, the host resolves the format string from the .axf and
+ * formats the message (tools/dlog_decode.py).
+ *
+ * Record layout, little endian 32-bit words:
+ *   word 0: address of the format string
+ *   word 1: bits 31-16 tick (10 ms, wraps), bits 15-12 module, bits 11-9 level,
+ *           bit 8 hex dump flag, bits 7-0 number of arguments or dump bytes
+ *   then the arguments (one word each) or the dump bytes padded to a word
+ *
+ * Arguments are stored as uint32_t, so only integers are supported (cast
+ * pointers to constant strings in flash), %f and %s of RAM buffers are not.
+ */
+
+#define DLOG_RTT_CHANNEL 1
+#define DLOG_BUFFER_SIZE 512
+#define DLOG_MAX_HEX     128 // bytes per hex dump record, longer dumps are split
+
+#define DLOG_LEVEL_NONE  0
+#define DLOG_LEVEL_ERROR 1
+#define DLOG_LEVEL_WARN  2
+#define DLOG_LEVEL_INFO  3
+#define DLOG_LEVEL_DEBUG 4
+
+/** Modules, at most 16 */
+typedef enum
+{
+    DLOG_MODULE_MAIN = 0,
+    DLOG_MODULE_CO2,
+    DLOG_MODULE_HISTORY,
+    DLOG_MODULE_PROTOCOL,
+    DLOG_MODULE_UI,
+    DLOG_MODULE_COUNT,
+} dlog_module_t;
+
+/** Compile time level per module, records above it are removed by the compiler */
+#ifndef DLOG_LEVEL_MAIN
+#define DLOG_LEVEL_MAIN DLOG_LEVEL_INFO
+#endif
+#ifndef DLOG_LEVEL_CO2
+#define DLOG_LEVEL_CO2 DLOG_LEVEL_DEBUG
+#endif
+#ifndef DLOG_LEVEL_HISTORY
+#define DLOG_LEVEL_HISTORY DLOG_LEVEL_DEBUG
+#endif
+#ifndef DLOG_LEVEL_PROTOCOL
+#define DLOG_LEVEL_PROTOCOL DLOG_LEVEL_DEBUG
+#endif
+#ifndef DLOG_LEVEL_UI
+#define DLOG_LEVEL_UI DLOG_LEVEL_INFO
+#endif
+
 #ifndef USE_SEGGER_RTT
 #define print(...)
 #define log_hex_dump(...)
+#define dlog_e(...)
+#define dlog_w(...)
+#define dlog_i(...)
+#define dlog_d(...)
+#define dlog_hex(...)
+#define dlog_init()
+#define dlog_set_level(...)
 #else
 
 #include "SEGGER_RTT.h"
@@ -15,16 +79,47 @@
 
 extern int SEGGER_RTT_vprintf(unsigned BufferIndex, const char *sFormat, va_list *pParamList);
 
-#define log_hex_dump(info, data, len)      \
-    do                                     \
-    {                                      \
-        print("[%s] ", (info));            \
-        for (uint16_t i = 0; i < len; i++) \
-        {                                  \
-            print("%02X ", (data)[i]);     \
-        }                                  \
-        print("\n");                       \
-    } while (0);
+#define log_hex_dump(info, data, len) dlog_hex(MAIN, DLOG_LEVEL_DEBUG, info, data, len)
+
+/** Runtime level per module, initialized to the compile time level */
+extern uint8_t dlog_levels[DLOG_MODULE_COUNT];
+
+/** Configure the RTT up buffer used by the deferred log */
+void dlog_init(void);
+
+/** Set the runtime level of a module */
+void dlog_set_level(dlog_module_t module, uint8_t level);
+
+void dlog_write(uint32_t header, const char *fmt, const uint32_t *args, uint8_t count);
+void dlog_write_hex(uint32_t header, const char *info, const uint8_t *data, uint16_t len);
+
+#define DLOG_HEADER(module, level, hex) (((uint32_t)(module) << 12) | ((uint32_t)(level) << 9) | ((uint32_t)(hex) << 8))
+
+#define DLOG_ENABLED(m, level) ((level) <= DLOG_LEVEL_##m && (level) <= dlog_levels[DLOG_MODULE_##m])
+
+#define dlog(m, level, fmt, ...)                                                                             \
+    do                                                                                                       \
+    {                                                                                                        \
+        if (DLOG_ENABLED(m, level))                                                                          \
+        {                                                                                                    \
+            const uint32_t dlog_args[] = {0, ##__VA_ARGS__};                                                 \
+            dlog_write(DLOG_HEADER(DLOG_MODULE_##m, level, 0), fmt, &dlog_args[1], sizeof(dlog_args) / 4 - 1); \
+        }                                                                                                    \
+    } while (0)
+
+#define dlog_e(m, fmt, ...) dlog(m, DLOG_LEVEL_ERROR, fmt, ##__VA_ARGS__)
+#define dlog_w(m, fmt, ...) dlog(m, DLOG_LEVEL_WARN, fmt, ##__VA_ARGS__)
+#define dlog_i(m, fmt, ...) dlog(m, DLOG_LEVEL_INFO, fmt, ##__VA_ARGS__)
+#define dlog_d(m, fmt, ...) dlog(m, DLOG_LEVEL_DEBUG, fmt, ##__VA_ARGS__)
+
+#define dlog_hex(m, level, info, data, len)                                                           \
+    do                                                                                                \
+    {                                                                                                 \
+        if (DLOG_ENABLED(m, level))                                                                   \
+        {                                                                                             \
+            dlog_write_hex(DLOG_HEADER(DLOG_MODULE_##m, level, 1), info, (const uint8_t *)(data), len); \
+        }                                                                                             \
+    } while (0)
 
 #endif
 
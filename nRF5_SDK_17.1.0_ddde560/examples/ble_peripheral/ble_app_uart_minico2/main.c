@@ -80,6 +80,8 @@
 
 #include "button.h"
 #include "cfg_fstorage.h"
+#include "energy.h"
+#include "trace.h"
 #include "log.h"
 #include "protocol.h"
 #include "st7301.h"
@@ -129,9 +131,6 @@
 #define UART_TX_BUF_SIZE 256 /**< UART TX buffer size. */
 #define UART_RX_BUF_SIZE 256 /**< UART RX buffer size. */
 
-#define RESET_REASON_CODE_POWER_ON     5
-#define RESET_REASON_CODE_FACTORY_TEST 9
-
 BLE_NUS_DEF(m_nus, NRF_SDH_BLE_TOTAL_LINK_COUNT); /**< BLE NUS service instance. */
 NRF_BLE_GATT_DEF(m_gatt);                         /**< GATT module instance. */
 NRF_BLE_QWR_DEF(m_qwr);                           /**< Context for the Queued Write module.*/
@@ -148,13 +147,6 @@ static ble_uuid_t m_adv_uuids[]          =                               /**< Un
 };
 
 // BLE state
-typedef enum
-{
-    IDLE,
-    CONNECTED,
-    ADVERTISING
-} BleState;
-
 BleState ble_state = IDLE;
 
 uint8_t get_ble_state(void)
@@ -166,7 +158,7 @@ uint8_t get_ble_state(void)
 uint16_t reset_reason_code = 0;
 
 // Global CO2 history array
-uint16_t co2_history[BAR_COUNT] = {0};
+uint16_t co2_history[CO2_HISTORY_LEN] = {0};
 
 /// whether to stop advertising
 bool stop_advertising = false;
@@ -182,7 +174,7 @@ uint16_t fast_interval_timer_ticks = 0;
 void update_co2_history(uint16_t new_value)
 {
     // Shift existing values left
-    for (int i = BAR_COUNT - 1; i > 0; i--)
+    for (int i = CO2_HISTORY_LEN - 1; i > 0; i--)
     {
         co2_history[i] = co2_history[i - 1];
     }
@@ -645,6 +637,7 @@ void advertising_start(void)
     APP_ERROR_CHECK(err_code);
 
     ble_state = ADVERTISING;
+    trace_add(TRACE_EVT_BLE_ADV_START, 0, 0);
     EventGroupSetBits(event_group_system, EVT_UI_UP_BLE);
 }
 
@@ -655,6 +648,7 @@ void advertising_stop(void)
 
     if (ble_state == IDLE) return;
     print("stop advertising\n");
+    trace_add(TRACE_EVT_BLE_ADV_STOP, 0, 0);
 
     if (ble_state == CONNECTED && m_conn_handle != BLE_CONN_HANDLE_INVALID)
     {
@@ -698,6 +692,7 @@ static void ble_evt_handler(ble_evt_t const *p_ble_evt, void *p_context)
         err_code      = nrf_ble_qwr_conn_handle_assign(&m_qwr, m_conn_handle);
         APP_ERROR_CHECK(err_code);
         ble_state = CONNECTED;
+        trace_add(TRACE_EVT_BLE_CONNECTED, 0, 0);
         EventGroupSetBits(event_group_system, EVT_UI_UP_BLE);
 
         // // Added for bonding - only initiate security in normal mode, not in factory test
@@ -715,6 +710,7 @@ static void ble_evt_handler(ble_evt_t const *p_ble_evt, void *p_context)
         NRF_LOG_INFO("Disconnected");
         // LED indication will be changed when advertising starts.
         m_conn_handle = BLE_CONN_HANDLE_INVALID;
+        trace_add(TRACE_EVT_BLE_DISCONNECTED, p_ble_evt->evt.gap_evt.params.disconnected.reason, 0);
         print("stop_advertising: %d\n", stop_advertising);
 
         if (stop_advertising)
@@ -970,7 +966,9 @@ static void idle_state_handle(void)
 
     if (NRF_LOG_PROCESS() == false)
     {
+        energy_end(ENERGY_CPU);
         nrf_pwr_mgmt_run();
+        energy_begin(ENERGY_CPU);
     }
 }
 
@@ -1063,142 +1061,6 @@ static void scheduler_init(void)
     APP_SCHED_INIT(APP_TIMER_SCHED_EVENT_DATA_SIZE, 32);
 }
 
-uint8_t ttask_slow_mode = 0; // ttask 200ms
-
-static void tick_tasks()
-{
-    TaskTick(task_protocol);
-    TaskTick(task_ui);
-    TaskTick(task_co2_read);
-    TaskTick(task_co2_alarm);
-    TaskTick(task_batery);
-    TaskTick(task_history_recover);
-    TaskTick(task_history_storage);
-    TaskTick(task_history_upload);
-    TaskTick(task_populate_fake_records);
-    TaskTick(task_factory_test);
-}
-
-static void tick_factory_test_tasks()
-{
-    TaskTick(task_protocol);
-    TaskTick(task_factory_test);
-}
-
-// Add this flag at module level
-static volatile bool timer_mode_change_pending = false;
-static volatile bool new_timer_mode_slow       = false;
-
-// main loop timer
-APP_TIMER_DEF(ttask_timer);
-void ttask_timer_timerout_handler(void *pcontext)
-{
-    static uint32_t drift_correction = 0; // drift correction
-    static uint32_t ms               = 0;
-
-    uint32_t increment = (ttask_slow_mode == 0) ? 10 : 200;
-    ms += increment;
-
-    if (ms >= 1000)
-    {
-        ms = 0;
-        inc_second(); // Increase the second counter
-
-        // Adjust drift correction based on actual ms increment
-        drift_correction += 960; //  Adjust for slow mode timing
-
-        if (drift_correction >= 1000000) // Every ~10 minutes
-        {
-            print("drift correction applied\n");
-            inc_second(); // Increment second counter to account for drift
-            drift_correction = 0;
-        }
-
-        if (fast_interval_timer_ticks > 0)
-        {
-            fast_interval_timer_ticks--;
-            if (fast_interval_timer_ticks == 0)
-            {
-                print("fast interval timer timeout, toggle connection interval\n");
-                toggle_connection_interval();
-            }
-        }
-    }
-
-    IncSystemTickCount();
-    tick_tasks();
-
-    // Apply any pending timer mode change at top of handler
-    if (timer_mode_change_pending)
-    {
-        timer_mode_change_pending = false;
-        app_timer_stop(ttask_timer);
-
-        if (new_timer_mode_slow)
-        {
-            app_timer_start(ttask_timer, APP_TIMER_TICKS(200), NULL);
-            ttask_slow_mode = 1;
-        }
-        else
-        {
-            app_timer_start(ttask_timer, APP_TIMER_TICKS(10), NULL);
-            ttask_slow_mode = 0;
-        }
-    }
-}
-
-void power_on_timer_timeout_handler(void *pcontext)
-{
-    IncSystemTickCount();
-    TaskTick(task_power_on);
-}
-
-void factory_test_timer_timeout_handler(void *pcontext)
-{
-    IncSystemTickCount();
-    tick_factory_test_tasks();
-}
-
-void run_task(void)
-{
-    if (reset_reason_code == RESET_REASON_CODE_POWER_ON)
-    {
-        // print("task_power_on\n");
-        TaskRun(task_power_on);
-        return;
-    }
-
-    if (reset_reason_code == RESET_REASON_CODE_FACTORY_TEST)
-    {
-        TaskRun(task_protocol);
-        TaskRun(task_factory_test);
-        return;
-    }
-
-    // print("task_protocol\n");
-    TaskRun(task_protocol);
-
-    // print("task_ui\n");
-    TaskRun(task_ui);
-
-    // print("task_co2_read\n");
-    TaskRun(task_co2_read);
-
-    // print("task_co2_alarm\n");
-    TaskRun(task_co2_alarm);
-
-    // print("task_batery\n");
-    TaskRun(task_batery);
-
-    // print("task_history_storage\n");
-    TaskRun(task_history_storage);
-
-    // print("task_history_upload\n");
-    TaskRun(task_history_upload);
-
-    TaskRun(task_populate_fake_records);
-}
-
 void check_button_and_erase(void)
 {
     // set the button as input
@@ -1280,6 +1142,8 @@ void check_reset_reason(void)
         }
     }
 
+    trace_add(TRACE_EVT_BOOT, (uint8_t)reset_reason_code, (reset_reason & 0x0F) | ((reset_reason >> 12) & 0xF0));
+
     // print the current timestamp to see if it is preserved after reset
     print("current timestamp: %u\n", get_time_now());
     if (reset_reason_code == 3)
@@ -1299,66 +1163,10 @@ void check_reset_reason(void)
 
 nrf_drv_wdt_channel_id m_channel_id;
 
-/**@brief Function for putting the chip into sleep mode.
- *
- * @note This function will not return.
- */
-void sleep_mode_enter(uint16_t bat_vol_mv)
-{
-    print("sleep_mode_enter\n");
-    if (EventGroupCheckBits(event_group_system, EVT_BAT_LOW | EVT_BAT_LOW_WARNING)) return;
-
-    EventGroupClearBits(event_group_system, EVT_SCREEN_FORCE_ON | EVT_CHARGING);
-    EventGroupSetBits(event_group_system, EVT_BAT_LOW_WARNING | EVT_SCREEN_ON_ONETIME);
-    add_record(bat_vol_mv, RECORD_TYPE_BATTERY_LOW);
-
-    if (cfg_fstorage_get_flight_mode())
-    {
-        // Disable flight mode and add history record
-        cfg_fstorage_set_flight_mode(0);
-        update_flight_mode_activation_time();
-        add_record(0, RECORD_TYPE_FLIGHT_MODE);
-    }
-
-    EventGroupSetBits(event_group_system, EVT_CO2_UP_HIS);
-
-    advertising_stop();
-
-    app_timer_stop(ttask_timer);
-    ttask_slow_mode = 1;
-
-    fast_interval_timer_ticks = 0;
-    is_fast_interval          = false;
-
-    app_timer_start(ttask_timer, APP_TIMER_TICKS(200), NULL);
-}
-
-void sleep_mode_exit(void)
-{
-    print("sleep_mode_exit called, ttask_slow_mode: %d\n", ttask_slow_mode);
-    if (!EventGroupCheckBits(event_group_system, EVT_BAT_LOW | EVT_BAT_LOW_WARNING)) return;
-
-    ttask_slow_mode = 0;
-    advertising_start();
-    user_init();
-    EventGroupClearBits(event_group_system, EVT_BAT_LOW | EVT_BAT_LOW_WARNING);
-    TaskStart(task_co2_read);
-    TaskStart(task_history_storage);
-    TaskStart(task_co2_alarm);
-    // Power up peripherals
-    app_timer_stop(ttask_timer);
-    app_timer_start(ttask_timer, APP_TIMER_TICKS(10), NULL);
-}
-
-void change_timer_power_mode(bool is_sleep)
-{
-    timer_mode_change_pending = true;
-    new_timer_mode_slow       = is_sleep;
-}
-
 void system_off()
 {
     print("Enter System OFF mode\n");
+    trace_add(TRACE_EVT_SLEEP, 0, 0);
 
     // Configure the wake-up pin
     nrf_gpio_cfg_sense_input(BUTTON_0, NRF_GPIO_PIN_PULLUP, NRF_GPIO_PIN_SENSE_LOW);
@@ -1405,6 +1213,7 @@ void start_factory_test(void)
     app_timer_stop_all();
 
     sd_power_gpregret_set(0, RESET_REASON_FACTORY_TEST);
+    trace_add(TRACE_EVT_RESET, TRACE_RESET_FACTORY_TEST, 0);
 
     nrf_drv_wdt_channel_feed(m_channel_id); // Last feed before reset
 
@@ -1419,7 +1228,10 @@ void init(void)
 {
     // Initialize all required subsystems for factory test mode
 
+    // validate the retained trace ring before anything can add an event
+    trace_init();
     timers_init();
+    energy_init();
     power_management_init();
     ble_stack_init();
     gap_params_init();
@@ -1461,8 +1273,7 @@ void exec_main_loop(void)
 
 void start_timer_and_main_loop()
 {
-    app_timer_stop(ttask_timer);
-    app_timer_start(ttask_timer, APP_TIMER_TICKS(10), NULL);
+    ttask_timer_start();
 
     button_init();
 
@@ -1472,14 +1283,14 @@ void start_timer_and_main_loop()
 void init_startup(void)
 {
 
-    app_timer_create(&ttask_timer, APP_TIMER_MODE_REPEATED, power_on_timer_timeout_handler);
+    ttask_timer_create(power_on_timer_timeout_handler);
     start_timer_and_main_loop();
 }
 
 void init_system_on(void)
 {
 
-    app_timer_create(&ttask_timer, APP_TIMER_MODE_REPEATED, ttask_timer_timerout_handler);
+    ttask_timer_create(ttask_timer_timerout_handler);
 
     if (cfg_fstorage_get_bluetooth_enabled() == 1)
     {
@@ -1492,7 +1303,7 @@ void init_system_on(void)
 
 void init_factory_test(void)
 {
-    app_timer_create(&ttask_timer, APP_TIMER_MODE_REPEATED, factory_test_timer_timeout_handler);
+    ttask_timer_create(factory_test_timer_timeout_handler);
 
     advertising_start();
 
@@ -1502,6 +1313,7 @@ void init_factory_test(void)
 int main(void)
 {
     log_init();
+    dlog_init();
 
     init();
 
@@ -428,6 +428,7 @@ static void frame_received_handler(uint8_t *frame, uint16_t len)
     {
         print("reset the device\n");
         print("TIMESTAMP BEFORE RESET: %u\n", get_time_now());
+        trace_add(TRACE_EVT_RESET, TRACE_RESET_PROTOCOL, 0);
         NVIC_SystemReset();
         break;
     }
@@ -618,11 +619,148 @@ static void frame_received_handler(uint8_t *frame, uint16_t len)
         EventGroupSetBits(event_group_system, EVT_CO2_UP_HIS);
         break;
     }
+    case CMD_GET_ENERGY_LEDGER:
+    {
+        print("Get energy ledger\n");
+        proto_send_energy_ledger();
+        break;
+    }
+    case CMD_SET_ENERGY_MODEL:
+    {
+        // Expected payload: frame[4]=consumer index (0xFE base current, 0xFF capacity), frame[5-8]=value
+        if (frame[3] == 5)
+        {
+            uint32_t value = ((uint32_t)frame[5] << 24) | ((uint32_t)frame[6] << 16) | ((uint32_t)frame[7] << 8) | frame[8];
+
+            tx_frame[0] = CMD_FIRST_BYTE;
+            tx_frame[1] = CMD_SECOND_BYTE;
+            tx_frame[2] = CMD_SET_ENERGY_MODEL;
+            tx_frame[3] = 0x01;
+            tx_frame[4] = energy_set_model(frame[4], value) == 0 ? frame[4] : 0xFD; // 0xFD = invalid index
+            set_frame_checksum(tx_frame, 6);
+            proto_send_frame(tx_frame, 6);
+        }
+        else
+        {
+            print("CMD_SET_ENERGY_MODEL: Invalid payload length %d, expected 5\n", frame[3]);
+        }
+        break;
+    }
+    case CMD_GET_TRACE:
+    {
+        // frame[4]: index of the first entry to send, 0xFF clears the trace
+        if (frame[4] == 0xFF)
+        {
+            print("Clear trace\n");
+            trace_clear();
+        }
+        proto_send_trace(frame[4] == 0xFF ? 0 : frame[4]);
+        break;
+    }
+    case CMD_SET_CO2_PROFILE:
+    {
+        // frame[4]: HI mode profile, 0 periodic, 1 low power periodic, 0xFF only reads it
+        if (frame[4] != 0xFF)
+        {
+            print("Set co2 profile %d\n", frame[4]);
+            if (set_co2_hi_profile((co2_profile_t)frame[4]) != 0)
+            {
+                print("CMD_SET_CO2_PROFILE: Invalid profile %d\n", frame[4]);
+            }
+        }
+
+        tx_frame[0] = CMD_FIRST_BYTE;
+        tx_frame[1] = CMD_SECOND_BYTE;
+        tx_frame[2] = CMD_SET_CO2_PROFILE;
+        tx_frame[3] = 0x01;
+        tx_frame[4] = (uint8_t)get_co2_hi_profile();
+        set_frame_checksum(tx_frame, 6);
+        proto_send_frame(tx_frame, 6);
+        break;
+    }
+    case CMD_SET_SAMPLE_INTERVAL:
+    {
+        // Expected payload: frame[4]=power mode (MID or LOW), frame[5-6]=min interval s, frame[7-8]=max interval s
+        if (frame[3] == 5)
+        {
+            uint16_t min_s = ((uint16_t)frame[5] << 8) | frame[6];
+            uint16_t max_s = ((uint16_t)frame[7] << 8) | frame[8];
+
+            tx_frame[0] = CMD_FIRST_BYTE;
+            tx_frame[1] = CMD_SECOND_BYTE;
+            tx_frame[2] = CMD_SET_SAMPLE_INTERVAL;
+            tx_frame[3] = 0x01;
+            tx_frame[4] = set_co2_interval_bounds((power_mode_t)frame[4], min_s, max_s) == 0 ? frame[4] : 0xFD; // 0xFD = invalid
+            set_frame_checksum(tx_frame, 6);
+            proto_send_frame(tx_frame, 6);
+        }
+        else
+        {
+            print("CMD_SET_SAMPLE_INTERVAL: Invalid payload length %d, expected 5\n", frame[3]);
+        }
+        break;
+    }
+    case CMD_SET_CO2_FILTER:
+    {
+        // Expected payload: frame[4]=median window (1, 3, 5, 0xFF only reads it), frame[5]=EMA shift, frame[6-7]=slew limit ppm
+        co2_filter_cfg_t filter_cfg;
+
+        if (frame[3] == 4 && frame[4] != 0xFF)
+        {
+            filter_cfg.median_n  = frame[4];
+            filter_cfg.ema_shift = frame[5];
+            filter_cfg.slew_ppm  = ((uint16_t)frame[6] << 8) | frame[7];
+            if (set_co2_filter(&filter_cfg) != 0)
+            {
+                print("CMD_SET_CO2_FILTER: Invalid filter %d %d %d\n", filter_cfg.median_n, filter_cfg.ema_shift, filter_cfg.slew_ppm);
+            }
+        }
+
+        get_co2_filter(&filter_cfg);
+        tx_frame[0] = CMD_FIRST_BYTE;
+        tx_frame[1] = CMD_SECOND_BYTE;
+        tx_frame[2] = CMD_SET_CO2_FILTER;
+        tx_frame[3] = 0x04;
+        tx_frame[4] = filter_cfg.median_n;
+        tx_frame[5] = filter_cfg.ema_shift;
+        tx_frame[6] = (uint8_t)(filter_cfg.slew_ppm >> 8);
+        tx_frame[7] = (uint8_t)(filter_cfg.slew_ppm & 0xFF);
+        set_frame_checksum(tx_frame, 9);
+        proto_send_frame(tx_frame, 9);
+        break;
+    }
+    case CMD_SET_PREDICTIVE_ALARM:
+    {
+        // Expected payload: frame[4]=lead time in minutes (0 disables, 0xFF only reads it), frame[5]=confidence in percent
+        co2_predict_cfg_t predict_cfg;
+
+        if (frame[3] == 2 && frame[4] != 0xFF)
+        {
+            predict_cfg.lead_min       = frame[4];
+            predict_cfg.confidence_pct = frame[5];
+            if (co2_predict_configure(&predict_cfg) != 0)
+            {
+                print("CMD_SET_PREDICTIVE_ALARM: Invalid confidence %d\n", frame[5]);
+            }
+        }
+
+        co2_predict_get_config(&predict_cfg);
+        tx_frame[0] = CMD_FIRST_BYTE;
+        tx_frame[1] = CMD_SECOND_BYTE;
+        tx_frame[2] = CMD_SET_PREDICTIVE_ALARM;
+        tx_frame[3] = 0x02;
+        tx_frame[4] = predict_cfg.lead_min;
+        tx_frame[5] = predict_cfg.confidence_pct;
+        set_frame_checksum(tx_frame, 7);
+        proto_send_frame(tx_frame, 7);
+        break;
+    }
     case CMD_FACTORY_RESET:
     {
         print("Factory reset\n");
         cfg_fstorage_erase_all(1); // 1 means erase all
-        NVIC_SystemReset();        // Reset the device
+        trace_add(TRACE_EVT_RESET, TRACE_RESET_FACTORY, 0);
+        NVIC_SystemReset(); // Reset the device
         break;
     }
     case CMD_ENTER_FACTORY_TEST_MODE:
@@ -656,6 +794,7 @@ static void frame_received_handler(uint8_t *frame, uint16_t len)
         {
             print("Don't put device to sleep and reset the device\n");
             sd_power_gpregret_set(0, 0);
+            trace_add(TRACE_EVT_RESET, TRACE_RESET_PROTOCOL, 0);
             NVIC_SystemReset();
             break;
         }
@@ -737,6 +876,102 @@ void proto_set_co2_scale_factor(uint8_t *frame)
     }
 }
 
+/**
+ * @brief Send the energy ledger
+ *
+ * Payload: uptime (s, 4 bytes), average current (uA, 4 bytes), remaining runtime (h, 2 bytes),
+ * then per consumer in energy_consumer_t order: active time (10 ms units, 4 bytes) and charge (uAh, 4 bytes).
+ * All values are big-endian.
+ */
+void proto_send_energy_ledger(void)
+{
+    static uint8_t tx_frame[4 + 10 + ENERGY_CONSUMER_COUNT * 8 + 1];
+    uint32_t       uptime_s        = energy_get_uptime_s();
+    uint32_t       average_ua      = energy_get_average_ua();
+    uint16_t       remaining_hours = energy_get_remaining_hours();
+    uint8_t        offset          = 4;
+
+    tx_frame[0] = CMD_FIRST_BYTE;
+    tx_frame[1] = CMD_SECOND_BYTE;
+    tx_frame[2] = CMD_GET_ENERGY_LEDGER;
+
+    tx_frame[offset++] = (uint8_t)(uptime_s >> 24);
+    tx_frame[offset++] = (uint8_t)(uptime_s >> 16);
+    tx_frame[offset++] = (uint8_t)(uptime_s >> 8);
+    tx_frame[offset++] = (uint8_t)(uptime_s);
+    tx_frame[offset++] = (uint8_t)(average_ua >> 24);
+    tx_frame[offset++] = (uint8_t)(average_ua >> 16);
+    tx_frame[offset++] = (uint8_t)(average_ua >> 8);
+    tx_frame[offset++] = (uint8_t)(average_ua);
+    tx_frame[offset++] = (uint8_t)(remaining_hours >> 8);
+    tx_frame[offset++] = (uint8_t)(remaining_hours);
+
+    for (uint8_t i = 0; i < ENERGY_CONSUMER_COUNT; i++)
+    {
+        energy_entry_t entry = energy_get_entry((energy_consumer_t)i);
+
+        tx_frame[offset++] = (uint8_t)(entry.active_10ms >> 24);
+        tx_frame[offset++] = (uint8_t)(entry.active_10ms >> 16);
+        tx_frame[offset++] = (uint8_t)(entry.active_10ms >> 8);
+        tx_frame[offset++] = (uint8_t)(entry.active_10ms);
+        tx_frame[offset++] = (uint8_t)(entry.charge_uah >> 24);
+        tx_frame[offset++] = (uint8_t)(entry.charge_uah >> 16);
+        tx_frame[offset++] = (uint8_t)(entry.charge_uah >> 8);
+        tx_frame[offset++] = (uint8_t)(entry.charge_uah);
+    }
+
+    tx_frame[3] = offset - 4;
+
+    print("energy ledger: uptime %d s, avg %d uA, remaining %d h\n", uptime_s, average_ua, remaining_hours);
+
+    set_frame_checksum(tx_frame, offset + 1);
+    proto_send_frame(tx_frame, offset + 1);
+}
+
+#define TRACE_ENTRIES_PER_FRAME 24
+
+/**
+ * @brief Send a chunk of the retained event trace
+ *
+ * Payload: boot count (2 bytes), total entries (1 byte), start index (1 byte), then up to
+ * TRACE_ENTRIES_PER_FRAME entries of tick (4 bytes), event (1 byte), arg8 (1 byte), arg16 (2 bytes).
+ * All values are big-endian. A chunk with no entries marks the end of the trace.
+ */
+void proto_send_trace(uint8_t start)
+{
+    static uint8_t       tx_frame[4 + 4 + TRACE_ENTRIES_PER_FRAME * 8 + 1];
+    static trace_entry_t entries[TRACE_ENTRIES_PER_FRAME];
+    uint16_t             boot_count = trace_get_boot_count();
+    uint8_t              count      = trace_read(start, entries, TRACE_ENTRIES_PER_FRAME);
+    uint8_t              offset     = 4;
+
+    tx_frame[0] = CMD_FIRST_BYTE;
+    tx_frame[1] = CMD_SECOND_BYTE;
+    tx_frame[2] = CMD_GET_TRACE;
+
+    tx_frame[offset++] = (uint8_t)(boot_count >> 8);
+    tx_frame[offset++] = (uint8_t)(boot_count);
+    tx_frame[offset++] = trace_get_count();
+    tx_frame[offset++] = start;
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        tx_frame[offset++] = (uint8_t)(entries[i].tick >> 24);
+        tx_frame[offset++] = (uint8_t)(entries[i].tick >> 16);
+        tx_frame[offset++] = (uint8_t)(entries[i].tick >> 8);
+        tx_frame[offset++] = (uint8_t)(entries[i].tick);
+        tx_frame[offset++] = entries[i].event;
+        tx_frame[offset++] = entries[i].arg8;
+        tx_frame[offset++] = (uint8_t)(entries[i].arg16 >> 8);
+        tx_frame[offset++] = (uint8_t)(entries[i].arg16);
+    }
+
+    tx_frame[3] = offset - 4;
+
+    set_frame_checksum(tx_frame, offset + 1);
+    proto_send_frame(tx_frame, offset + 1);
+}
+
 /**
  * @brief Dump the device state
  *
@@ -872,7 +1107,7 @@ void proto_send_recali_done(int16_t cc)
         tx_frame[6] = 0x01;
 
     set_frame_checksum(tx_frame, 8);
-    log_hex_dump("Calibration Frame", tx_frame, 8);
+    dlog_hex(PROTOCOL, DLOG_LEVEL_DEBUG, "Calibration Frame", tx_frame, 8);
     proto_send_frame(tx_frame, 8);
 }
 
@@ -1229,7 +1464,7 @@ TaskDefine(task_protocol)
             {
                 NUS_TAKE();
                 frame_received_handler(rx_frame, rx_frame_idx);
-                log_hex_dump("rx", rx_frame, rx_frame_idx);
+                dlog_hex(PROTOCOL, DLOG_LEVEL_DEBUG, "rx", rx_frame, rx_frame_idx);
                 NUS_GIVE();
                 rx_frame_idx = 0;
                 break;
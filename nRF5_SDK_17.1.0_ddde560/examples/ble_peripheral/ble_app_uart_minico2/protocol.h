@@ -2,9 +2,11 @@
 #define __PROTOCOL_H__
 
 #include "co2.h"
+#include "energy.h"
 #include "history.h"
 #include "log.h"
 #include "queue.h"
+#include "trace.h"
 #include "string.h"
 #include "ttask.h"
 #include "ui.h"
@@ -75,6 +77,13 @@
 #define CMD_GET_SENSOR_DETAILS             0x30
 #define CMD_SET_CO2_SCALE_FACTOR           0x31
 #define CMD_SET_FLIGHT_MODE                0x32
+#define CMD_GET_ENERGY_LEDGER              0x33
+#define CMD_SET_ENERGY_MODEL               0x34
+#define CMD_GET_TRACE                      0x35
+#define CMD_SET_CO2_PROFILE                0x36
+#define CMD_SET_SAMPLE_INTERVAL            0x37
+#define CMD_SET_CO2_FILTER                 0x38
+#define CMD_SET_PREDICTIVE_ALARM           0x39
 
 // Factory Test Commands
 #define CMD_ENTER_FACTORY_TEST_MODE  0xD0
@@ -198,6 +207,18 @@ void proto_send_battery_level(void);
  */
 void proto_set_co2_scale_factor(uint8_t *frame);
 
+/**
+ * @brief Send the energy ledger and the estimated remaining runtime
+ */
+void proto_send_energy_ledger(void);
+
+/**
+ * @brief Send a chunk of the retained event trace
+ *
+ * @param start Index of the first entry (0 = oldest)
+ */
+void proto_send_trace(uint8_t start);
+
 // Single dynamic factory test result structure
 typedef struct
 {
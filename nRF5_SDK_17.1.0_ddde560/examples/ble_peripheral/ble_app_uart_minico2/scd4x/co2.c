@@ -1,10 +1,13 @@
 #include "co2.h"
+#include "crc16.h"
+#include <math.h>
+#include <stddef.h>
 
 #define ASC_PER_DAY_RECORD_COUNT 400
 
 // CO2 power control macros (moved here to avoid "use before definition" errors)
-#define CO2_PWR_ON()  nrf_gpio_pin_set(PIN_CO2_PWR)
-#define CO2_PWR_OFF() nrf_gpio_pin_clear(PIN_CO2_PWR)
+#define CO2_PWR_ON()  do { nrf_gpio_pin_set(PIN_CO2_PWR); energy_begin(ENERGY_SCD4X_IDLE); } while (0)
+#define CO2_PWR_OFF() do { nrf_gpio_pin_clear(PIN_CO2_PWR); energy_end(ENERGY_SCD4X_IDLE); energy_end(ENERGY_SCD4X_MEAS); energy_end(ENERGY_SCD4X_LP_MEAS); } while (0)
 
 /* TWI instance ID. */
 #define TWI_INSTANCE_ID 1
@@ -12,32 +15,113 @@
 /* TWI instance. */
 static const nrf_drv_twi_t m_twi = NRF_DRV_TWI_INSTANCE(TWI_INSTANCE_ID);
 
-// Add these static variables
-static asc_state_t asc_state = {
-    .lowest3          = 10000, // Initialize to a high value
-    .reading1         = 0,
-    .reading2         = 0,
-    .day_count        = 0,
-    .reading0         = 0,
-    .target           = CO2_CALIB_TARGET,
-    .day_record_count = 0,
-};
+/* SCD4x I2C address */
+#define CO2_TWI_ADDR 0x62
+
+/** TWI transfer state, advanced by the TWI event handler and the execution timer */
+typedef enum
+{
+    CO2_TWI_IDLE = 0,
+    CO2_TWI_BLOCKING, // co2_write / co2_read transfer for the sensor driver
+    CO2_TWI_TX,       // command write
+    CO2_TWI_EXEC,     // waiting for the command execution time
+    CO2_TWI_RX,       // response read
+    CO2_TWI_DONE,
+    CO2_TWI_ERROR,
+} co2_twi_state_t;
+
+static volatile co2_twi_state_t twi_state = CO2_TWI_IDLE;
+
+static uint8_t twi_cmd[2];
+static uint8_t twi_rx_buf[CO2_TWI_RX_MAX];
+static uint8_t twi_rx_len  = 0;
+static uint8_t twi_exec_ms = 0;
+
+APP_TIMER_DEF(co2_twi_exec_timer);
 
+// ASC state, not cleared at startup so asc_resume() can continue the period after a reset
+static __attribute__((section(".bss.noinit"), zero_init)) asc_state_t asc_state;
+
+/** Update the CRC of the retained ASC state after a change */
+static void asc_checkpoint(void)
+{
+    asc_state.crc = crc16_compute((const uint8_t *)&asc_state, offsetof(asc_state_t, crc), NULL);
+}
+
+/** Start a new ASC period */
 void asc_init(void)
 {
-    // Load CC from flash
-    asc_state.lowest3          = 10000; // This will now store the lowest average, not the sum
-    asc_state.day_count        = 0;
-    asc_state.reading1         = 0;
-    asc_state.reading2         = 0;
-    asc_state.reading0         = 0;
-    asc_state.day_record_count = 0;
+    memset(&asc_state, 0, sizeof(asc_state));
+    asc_state.target = cfg_fstorage_get_calib_target();
+    asc_checkpoint();
+}
+
+/** Continue the ASC period from the retained state, start a new one when it is not valid (power-on) */
+void asc_resume(void)
+{
+    if (asc_state.crc != crc16_compute((const uint8_t *)&asc_state, offsetof(asc_state_t, crc), NULL) ||
+        asc_state.day_low_count > ASC_DAY_LOWS || asc_state.daily_count > ASC_WINDOW_DAYS || asc_state.daily_head >= ASC_WINDOW_DAYS)
+    {
+        print("ASC state invalid, new period\n");
+        asc_init();
+        return;
+    }
+
+    asc_state.target = cfg_fstorage_get_calib_target();
+    asc_checkpoint();
+    print("ASC resumed: day %d, %d daily lows, %d records today\n", asc_state.day_count, asc_state.daily_count, asc_state.day_record_count);
+}
+
+/**
+ * Move the stored averages with a CC change, they were taken with the old CC
+ * and the baseline must compare against readings with the new one.
+ */
+static void asc_shift(int16_t delta)
+{
+    uint8_t i;
+
+    for (i = 0; i < asc_state.day_low_count; i++)
+    {
+        asc_state.day_lows[i] += delta;
+    }
+    for (i = 0; i < asc_state.daily_count; i++)
+    {
+        asc_state.daily_low[i] += delta;
+    }
+    asc_state.reading0 = 0; // the 3-reading average restarts with the new CC
+    asc_state.reading1 = 0;
+    asc_state.reading2 = 0;
+}
+
+/** Low percentile of the current day from the smallest averages, UINT16_MAX without readings */
+static uint16_t asc_day_low(void)
+{
+    uint16_t index = asc_state.day_record_count * ASC_LOW_PERCENTILE / 100;
+
+    if (asc_state.day_low_count == 0) return UINT16_MAX;
+    if (index >= asc_state.day_low_count) index = asc_state.day_low_count - 1;
+    return asc_state.day_lows[index];
+}
+
+/** Baseline of the window, the lowest daily low */
+static uint16_t asc_baseline(void)
+{
+    uint16_t baseline = UINT16_MAX;
+
+    for (uint8_t i = 0; i < asc_state.daily_count; i++)
+    {
+        if (asc_state.daily_low[i] < baseline) baseline = asc_state.daily_low[i];
+    }
+    return baseline;
 }
 
 static calib_ctx_t calib_ctx = {
     .power_mode_before_calib     = PWR_MODE_LOW,
     .calib_duration_record_count = 0,
-    .calib_duration_sum          = 0,
+    .calib_count                 = 0,
+    .calib_mean                  = 0,
+    .calib_m2                    = 0,
+    .calib_converged             = false,
     .co2_calib_target            = CO2_CALIB_TARGET,
 };
 
@@ -59,17 +143,56 @@ static co2_ctx_t co2_ctx = {
     .error_code         = 0,
     .sensor_variant     = 2, // 2 means unknown and not measured
     .sensor_error_count = 0,
+    .profile            = CO2_PROFILE_PERIODIC,
+    .hi_profile         = CO2_PROFILE_PERIODIC,
+    .interval_ms        = 0,
+    .last_sample_ppm    = 0,
+    .last_sample_tick   = 0,
 };
 
-// Recovery mechanism state
+/** Processing pipeline of the readings */
+static co2_filter_t co2_filter;
+
+/** Scale factor the filter was last set to, refreshed when the config or flight mode changes it */
+static float co2_filter_scale_factor = 0;
+
+/** Number of data ready polls of the current sample */
+static uint8_t drdy_polls = 0;
+
+// Recovery mechanism state, the co2_recovery_t stage taken on the next error
 static uint8_t consecutive_sensor_errors = 0;
 
+/** Serial number read at startup, checked after a recovery power cycle */
+static uint16_t co2_serial[3] = {0, 0, 0};
+
 /** Get CO2 concentration value */
 uint16_t get_co2_value(void)
 {
     return co2_ctx.co2_value;
 }
 
+/** Get CO2 reading before filtering */
+uint16_t get_co2_raw_value(void)
+{
+    return co2_filter.raw;
+}
+
+uint8_t set_co2_filter(const co2_filter_cfg_t *cfg)
+{
+    if (co2_filter_configure(&co2_filter, cfg) != 0)
+    {
+        return 1;
+    }
+
+    print("co2 filter: median %d, ema shift %d, slew %d ppm\n", cfg->median_n, cfg->ema_shift, cfg->slew_ppm);
+    return 0;
+}
+
+void get_co2_filter(co2_filter_cfg_t *cfg)
+{
+    *cfg = co2_filter.cfg;
+}
+
 /** Get Sensor Variant */
 uint8_t get_sensor_variant(void)
 {
@@ -100,17 +223,75 @@ uint8_t get_asc_day_count(void)
     return asc_state.day_count;
 }
 
+/** Restart the running mean and variance of the calibration readings */
+static void calib_reset(void)
+{
+    calib_ctx.calib_duration_record_count = 0;
+    calib_ctx.calib_count                 = 0;
+    calib_ctx.calib_mean                  = 0;
+    calib_ctx.calib_m2                    = 0;
+    calib_ctx.calib_converged             = false;
+}
+
+/**
+ * Add a calibration reading with Welford's update, which stays accurate in
+ * single precision. The calibration has converged once the standard error of
+ * the mean, sqrt(m2 / (n - 1) / n), is within CO2_CALIB_TOLERANCE_PPM.
+ */
+static void calib_add_reading(uint16_t ppm)
+{
+    float delta;
+
+    calib_ctx.calib_duration_record_count += 1;
+    if (calib_ctx.calib_duration_record_count <= CO2_CALIB_SKIP_SAMPLES || calib_ctx.calib_count == UINT8_MAX)
+    {
+        return;
+    }
+
+    calib_ctx.calib_count += 1;
+    delta = (float)ppm - calib_ctx.calib_mean;
+    calib_ctx.calib_mean += delta / calib_ctx.calib_count;
+    calib_ctx.calib_m2 += delta * ((float)ppm - calib_ctx.calib_mean);
+
+    if (calib_ctx.calib_count >= CO2_CALIB_MIN_SAMPLES &&
+        calib_ctx.calib_m2 <= (float)(CO2_CALIB_TOLERANCE_PPM * CO2_CALIB_TOLERANCE_PPM) * (calib_ctx.calib_count - 1) * calib_ctx.calib_count)
+    {
+        calib_ctx.calib_converged = true;
+    }
+
+    print("calib reading %d: mean %d, confidence %d.%d ppm, converged %d\n", calib_ctx.calib_count, (int)calib_ctx.calib_mean,
+          get_co2_calib_confidence() / 10, get_co2_calib_confidence() % 10, calib_ctx.calib_converged);
+}
+
+bool is_co2_calib_converged(void)
+{
+    return calib_ctx.calib_converged;
+}
+
+uint16_t get_co2_calib_confidence(void)
+{
+    float sem;
+
+    if (calib_ctx.calib_count < 2)
+    {
+        return UINT16_MAX;
+    }
+
+    sem = sqrtf(calib_ctx.calib_m2 / (calib_ctx.calib_count - 1) / calib_ctx.calib_count) * 10;
+    return sem >= UINT16_MAX ? UINT16_MAX : (uint16_t)(sem + 0.5f);
+}
+
 /** Get CC value */
 int16_t get_calibration_correction(void)
 {
-    if (calib_ctx.calib_duration_record_count == 0)
+    if (calib_ctx.calib_count == 0)
     {
         return co2_ctx.cc_value;
     }
 
-    // calculate average value of calibration readings
-    int16_t average_value = (int16_t)(calib_ctx.calib_duration_sum / calib_ctx.calib_duration_record_count);
-    print("average_value=%d, calib_duration_record_count=%d, calib_duration_sum=%d\n", average_value, calib_ctx.calib_duration_record_count, calib_ctx.calib_duration_sum);
+    // average value of calibration readings
+    int16_t average_value = (int16_t)(calib_ctx.calib_mean + 0.5f);
+    print("average_value=%d, calib_count=%d, confidence=%d\n", average_value, calib_ctx.calib_count, get_co2_calib_confidence());
 
     // calculate new CC value
     int16_t old_cc = cfg_fstorage_get_cc();
@@ -122,9 +303,8 @@ int16_t get_calibration_correction(void)
 
     print("old_cc=%d, cc_value=%d\n", old_cc, co2_ctx.cc_value);
 
-    asc_state.reading1 = 0; // instead of asc_state.skip_3r we reset the reading1, reading2, reading0 to 0 which is the same effect
-    asc_state.reading2 = 0;
-    asc_state.reading0 = 0;
+    asc_shift(co2_ctx.cc_value - old_cc);
+    asc_checkpoint();
 
     return co2_ctx.cc_value - old_cc;
 }
@@ -132,8 +312,12 @@ int16_t get_calibration_correction(void)
 /** Set power mode, i.e., sampling mode */
 void set_power_mode(power_mode_t mode)
 {
-    co2_ctx.power_mode = mode;
+    co2_ctx.power_mode      = mode;
+    co2_ctx.interval_ms     = 0;
+    co2_ctx.last_sample_ppm = 0;
+    co2_filter_reset(&co2_filter);
     cfg_fstorage_set_power_mode((uint8_t)mode);
+    trace_add(TRACE_EVT_POWER_MODE, (uint8_t)mode, 0);
 }
 
 /** Reset Power mode to what it was before calibration */
@@ -148,6 +332,23 @@ power_mode_t get_power_mode(void)
     return co2_ctx.power_mode;
 }
 
+uint8_t set_co2_hi_profile(co2_profile_t profile)
+{
+    if (profile != CO2_PROFILE_PERIODIC && profile != CO2_PROFILE_LOW_POWER_PERIODIC)
+    {
+        return 1;
+    }
+
+    co2_ctx.hi_profile = profile;
+    print("HI mode profile: %d\n", profile);
+    return 0;
+}
+
+co2_profile_t get_co2_hi_profile(void)
+{
+    return co2_ctx.hi_profile;
+}
+
 /** Increment power mode */
 void inc_power_mode(void)
 {
@@ -156,6 +357,8 @@ void inc_power_mode(void)
     {
         co2_ctx.power_mode = PWR_MODE_ON_DEMAND;
     }
+    co2_ctx.interval_ms     = 0;
+    co2_ctx.last_sample_ppm = 0;
     cfg_fstorage_set_power_mode((uint8_t)co2_ctx.power_mode);
 }
 
@@ -167,6 +370,7 @@ void update_calibration_target(uint16_t target)
 {
     calib_ctx.co2_calib_target = target;
     asc_state.target           = target;
+    asc_checkpoint();
     cfg_fstorage_set_calib_target(target);
     add_history_record(target, RECORD_TYPE_CALIBRATION_TARGET_UPDATE);
 }
@@ -178,6 +382,158 @@ void co2_start_calibration()
     EventGroupSetBits(event_group_system, EVT_CO2_CALIB_START);
 }
 
+static void co2_twi_evt_handler(nrf_drv_twi_evt_t const *p_event, void *p_context)
+{
+    // late event of an abandoned transfer
+    if (twi_state != CO2_TWI_BLOCKING && twi_state != CO2_TWI_TX && twi_state != CO2_TWI_RX) return;
+
+    if (p_event->type != NRF_DRV_TWI_EVT_DONE)
+    {
+        twi_state = CO2_TWI_ERROR;
+        return;
+    }
+
+    if (twi_state == CO2_TWI_TX && twi_rx_len > 0)
+    {
+        twi_state = CO2_TWI_EXEC;
+        if (app_timer_start(co2_twi_exec_timer, APP_TIMER_TICKS(twi_exec_ms), NULL) != NRF_SUCCESS)
+        {
+            twi_state = CO2_TWI_ERROR;
+        }
+    }
+    else
+    {
+        twi_state = CO2_TWI_DONE;
+    }
+}
+
+static void co2_twi_exec_timeout_handler(void *p_context)
+{
+    if (twi_state != CO2_TWI_EXEC) return;
+
+    twi_state = CO2_TWI_RX;
+    if (nrf_drv_twi_rx(&m_twi, CO2_TWI_ADDR, twi_rx_buf, twi_rx_len) != NRF_SUCCESS)
+    {
+        twi_state = CO2_TWI_ERROR;
+    }
+}
+
+/**
+ * @brief Abandon a transfer that did not complete
+ *
+ * The driver stays busy until its DONE event, so the TWIM is disabled and
+ * initialized again, which also forces the state back to idle.
+ */
+static void co2_twi_abandon(void)
+{
+    dlog_w(CO2, "twi transfer abandoned in state %d\n", twi_state);
+    co2_twi_uninit();
+    co2_twi_init();
+}
+
+/**
+ * @brief Run a driver transfer to completion, the CPU sleeps until the TWI event
+ *
+ * @return uint8_t 0 on success, otherwise 1
+ */
+static uint8_t co2_twi_blocking(ret_code_t err_code)
+{
+    uint32_t tick_from = app_timer_cnt_get();
+
+    if (err_code != NRF_SUCCESS)
+    {
+        twi_state = CO2_TWI_IDLE;
+        return 1;
+    }
+
+    while (twi_state == CO2_TWI_BLOCKING && app_timer_cnt_diff_compute(app_timer_cnt_get(), tick_from) < APP_TIMER_TICKS(CO2_TWI_TIMEOUT_MS))
+    {
+        __WFE();
+    }
+
+    if (twi_state == CO2_TWI_BLOCKING)
+    {
+        co2_twi_abandon();
+        return 1;
+    }
+
+    err_code  = (twi_state == CO2_TWI_DONE) ? 0 : 1;
+    twi_state = CO2_TWI_IDLE;
+    return (uint8_t)err_code;
+}
+
+static uint8_t co2_crc8(const uint8_t *data)
+{
+    uint8_t crc = 0xFF;
+
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        crc ^= data[i];
+        for (uint8_t bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x31) : (uint8_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+uint8_t co2_twi_transfer_start(uint16_t cmd, uint8_t exec_ms, uint8_t rx_len)
+{
+    if (twi_state != CO2_TWI_IDLE || rx_len > CO2_TWI_RX_MAX) return 1;
+
+    twi_cmd[0]  = (uint8_t)(cmd >> 8);
+    twi_cmd[1]  = (uint8_t)(cmd & 0xFF);
+    twi_rx_len  = rx_len;
+    twi_exec_ms = exec_ms;
+    twi_state   = CO2_TWI_TX;
+
+    energy_begin(ENERGY_TWI);
+    if (nrf_drv_twi_tx(&m_twi, CO2_TWI_ADDR, twi_cmd, sizeof(twi_cmd), false) != NRF_SUCCESS)
+    {
+        twi_state = CO2_TWI_ERROR;
+    }
+    return 0;
+}
+
+bool co2_twi_transfer_busy(void)
+{
+    return twi_state == CO2_TWI_TX || twi_state == CO2_TWI_EXEC || twi_state == CO2_TWI_RX;
+}
+
+uint8_t co2_twi_transfer_result(void)
+{
+    uint8_t ret = 0;
+
+    energy_end(ENERGY_TWI);
+
+    if (twi_state != CO2_TWI_DONE)
+    {
+        // timed out or failed, a transfer still in flight is abandoned
+        app_timer_stop(co2_twi_exec_timer);
+        if (twi_state != CO2_TWI_ERROR) co2_twi_abandon();
+        ret = 1;
+    }
+    else
+    {
+        for (uint8_t i = 0; i + 2 < twi_rx_len; i += 3)
+        {
+            if (twi_rx_buf[i + 2] != co2_crc8(&twi_rx_buf[i]))
+            {
+                ret = 4;
+                break;
+            }
+        }
+    }
+
+    twi_state = CO2_TWI_IDLE;
+    return ret;
+}
+
+uint16_t co2_twi_get_word(uint8_t index)
+{
+    return (uint16_t)(((uint16_t)twi_rx_buf[index * 3] << 8) | twi_rx_buf[index * 3 + 1]);
+}
+
 /**
  * @brief Initialize TWI
  *
@@ -185,9 +541,18 @@ void co2_start_calibration()
  */
 uint8_t co2_twi_init(void)
 {
+    static bool timer_created = false;
+
     if (co2_ctx.is_twi_inited) return 0;
     ret_code_t err_code;
 
+    if (!timer_created)
+    {
+        err_code = app_timer_create(&co2_twi_exec_timer, APP_TIMER_MODE_SINGLE_SHOT, co2_twi_exec_timeout_handler);
+        if (err_code != NRF_SUCCESS) return 1;
+        timer_created = true;
+    }
+
     const nrf_drv_twi_config_t twi_config = {
         .scl                = PIN_CO2_SCL,
         .sda                = PIN_CO2_SDA,
@@ -195,7 +560,7 @@ uint8_t co2_twi_init(void)
         .interrupt_priority = APP_IRQ_PRIORITY_LOW,
         .clear_bus_init     = false};
 
-    err_code = nrf_drv_twi_init(&m_twi, &twi_config, NULL, NULL);
+    err_code = nrf_drv_twi_init(&m_twi, &twi_config, co2_twi_evt_handler, NULL);
     print("twi init with [%d]\n", err_code);
     if (err_code != NRF_SUCCESS) return 1;
 
@@ -213,7 +578,9 @@ uint8_t co2_twi_uninit(void)
 {
     if (!co2_ctx.is_twi_inited) return 0;
     print("twi uninit\n");
+    app_timer_stop(co2_twi_exec_timer);
     nrf_drv_twi_uninit(&m_twi);
+    twi_state = CO2_TWI_IDLE;
     co2_ctx.is_twi_inited = 0;
     return 0;
 }
@@ -230,8 +597,13 @@ uint8_t co2_write(uint8_t addr, uint8_t *buf, uint16_t len)
 {
     ret_code_t err_code;
 
-    err_code = nrf_drv_twi_tx(&m_twi, addr, buf, len, false);
-    return err_code != NRF_SUCCESS;
+    if (twi_state != CO2_TWI_IDLE) return 1;
+
+    energy_begin(ENERGY_TWI);
+    twi_state = CO2_TWI_BLOCKING;
+    err_code  = co2_twi_blocking(nrf_drv_twi_tx(&m_twi, addr, buf, len, false));
+    energy_end(ENERGY_TWI);
+    return (uint8_t)err_code;
 }
 
 /**
@@ -244,7 +616,7 @@ uint8_t co2_write(uint8_t addr, uint8_t *buf, uint16_t len)
  */
 void co2_write_void(uint8_t addr, uint8_t *buf, uint16_t len)
 {
-    nrf_drv_twi_tx(&m_twi, addr, buf, len, false);
+    co2_write(addr, buf, len);
 }
 
 /**
@@ -259,8 +631,13 @@ uint8_t co2_read(uint8_t addr, uint8_t *buf, uint16_t len)
 {
     ret_code_t err_code;
 
-    err_code = nrf_drv_twi_rx(&m_twi, addr, buf, len);
-    return err_code != NRF_SUCCESS;
+    if (twi_state != CO2_TWI_IDLE) return 1;
+
+    energy_begin(ENERGY_TWI);
+    twi_state = CO2_TWI_BLOCKING;
+    err_code  = co2_twi_blocking(nrf_drv_twi_rx(&m_twi, addr, buf, len));
+    energy_end(ENERGY_TWI);
+    return (uint8_t)err_code;
 }
 
 // Adapt sensor driver, delay over 50ms returns immediately, non-blocking delay must be explicitly handled by the scheduler
@@ -359,6 +736,12 @@ int co2_sensor_configure(void)
         return -1;
     }
 
+    // Keep the serial number to recognize the sensor after a recovery power cycle
+    if (scd4x_get_serial_number(&gs_handle, co2_serial) != 0)
+    {
+        print("Failed to get serial number\n");
+    }
+
     // Load CC value from storage
     co2_ctx.cc_value = cfg_fstorage_get_cc();
     print("CC value loaded: %d\n", co2_ctx.cc_value);
@@ -376,6 +759,53 @@ void co2_sensor_cleanup(void)
     CO2_PWR_OFF();
 }
 
+/**
+ * @brief Release a stuck bus and reinitialize TWI.
+ * A sensor holding SDA low after an aborted transfer is clocked out with up
+ * to 9 SCL pulses followed by a stop condition.
+ *
+ * @return uint8_t 0 on success, 1 when SDA stays low or TWI fails to initialize
+ */
+static uint8_t co2_twi_bus_clear(void)
+{
+    uint8_t ret = 0;
+
+    co2_twi_uninit();
+    if (nrfx_twim_bus_recover(PIN_CO2_SCL, PIN_CO2_SDA) != NRFX_SUCCESS)
+    {
+        print("twi bus clear failed, SDA held low\n");
+        ret = 1;
+    }
+    return co2_twi_init() | ret;
+}
+
+/**
+ * @brief Read the serial number and compare it with the one read at startup.
+ *
+ * @return uint8_t 0 when it matches, 1 on a read error or a different sensor
+ */
+static uint8_t co2_verify_serial(void)
+{
+    uint16_t serial[3];
+
+    if (scd4x_get_serial_number(&gs_handle, serial) != 0)
+    {
+        print("serial number readback failed\n");
+        return 1;
+    }
+    if (co2_serial[0] == 0 && co2_serial[1] == 0 && co2_serial[2] == 0)
+    {
+        // not read at startup, take the first answer
+        memcpy(co2_serial, serial, sizeof(serial));
+    }
+    if (memcmp(serial, co2_serial, sizeof(serial)) != 0)
+    {
+        print("serial number mismatch %04X%04X%04X\n", serial[0], serial[1], serial[2]);
+        return 1;
+    }
+    return 0;
+}
+
 scd4x_handle_t      gs_handle; /**< scd4x handle - exposed for factory test */
 static scd4x_bool_t asc_enabled            = SCD4X_BOOL_FALSE;
 static uint8_t      data_ready_check_count = 0; /**< Loop counter for data ready checks */
@@ -402,8 +832,19 @@ uint8_t co2_set_self_calibration(uint8_t enable)
     return 0;
 }
 
+/**
+ * Streaming ASC baseline.
+ * Each reading updates a 3-reading average; the ASC_DAY_LOWS smallest
+ * averages of the day are kept sorted, which gives the ASC_LOW_PERCENTILE
+ * percentile of the day in bounded memory. At the end of a day that low goes
+ * into a ring of ASC_WINDOW_DAYS days and the baseline is the lowest of them.
+ * Every ASC_WINDOW_DAYS days the CC moves the baseline to the target; the
+ * window is kept (shifted by the adjustment) so it rolls over the periods.
+ */
 void asc_process_reading(uint16_t new_reading)
 {
+    uint8_t i;
+
     if (!asc_enabled) return;
 
     asc_state.day_record_count++;
@@ -413,31 +854,34 @@ void asc_process_reading(uint16_t new_reading)
     asc_state.reading0 = new_reading;
 
     // Only process if we have 3 readings
-    if (asc_state.reading2 == 0) return;
+    if (asc_state.reading2 == 0)
+    {
+        asc_checkpoint();
+        return;
+    }
 
     // Calculate the average of 3 readings
     uint16_t avg_3r = (asc_state.reading0 + asc_state.reading1 + asc_state.reading2) / 3;
 
-    print("asc_state.reading0=%d, asc_state.reading1=%d, asc_state.reading2=%d, avg3R=%d, asc_state.lowest3=%d\n",
-          asc_state.reading0, asc_state.reading1, asc_state.reading2, avg_3r, asc_state.lowest3);
-
-    // Track lowest 3-reading average (even if below 420, we'll enforce minimum when using it)
-    if (avg_3r < asc_state.lowest3)
+    // Insert into the smallest averages of the day (even if below 420, we'll enforce minimum when using it)
+    if (asc_state.day_low_count < ASC_DAY_LOWS || avg_3r < asc_state.day_lows[ASC_DAY_LOWS - 1])
     {
-        asc_state.lowest3 = avg_3r;
-        print("asc_state.lowest3=%d\n", asc_state.lowest3);
+        i = asc_state.day_low_count < ASC_DAY_LOWS ? asc_state.day_low_count++ : ASC_DAY_LOWS - 1;
+        for (; i > 0 && asc_state.day_lows[i - 1] > avg_3r; i--)
+        {
+            asc_state.day_lows[i] = asc_state.day_lows[i - 1];
+        }
+        asc_state.day_lows[i] = avg_3r;
     }
 
+    print("asc_state.reading0=%d, asc_state.reading1=%d, asc_state.reading2=%d, avg3R=%d, day low=%d\n",
+          asc_state.reading0, asc_state.reading1, asc_state.reading2, avg_3r, asc_day_low());
+
     // Special case: reading average < 420 (below acceptable minimum)
     // SKIP THIS FOR FLIGHT MODE
-    if (asc_state.lowest3 < 420 && cfg_fstorage_get_flight_mode() == 0)
+    if (avg_3r < 420 && cfg_fstorage_get_flight_mode() == 0)
     {
-        int16_t adjustment = 420 - asc_state.lowest3;
-
-        if (adjustment == 0)
-        {
-            return;
-        }
+        int16_t adjustment = 420 - avg_3r;
 
         co2_ctx.cc_value += adjustment;
         print("new cc value: %d\n", co2_ctx.cc_value);
@@ -447,55 +891,66 @@ void asc_process_reading(uint16_t new_reading)
         add_history_record(adjustment, RECORD_TYPE_ASC_ADJUSTMENT);
 
         print("Low CO2 adjust: %d\n", adjustment);
-        asc_state.lowest3 = 420;
+        asc_shift(adjustment);
     }
+
+    asc_checkpoint();
 }
 
 void asc_check_daily_update(bool check_record_count)
 {
+    uint16_t day_low;
+    uint16_t baseline;
+
     if (!asc_enabled) return;
 
     if (check_record_count && asc_state.day_record_count < ASC_PER_DAY_RECORD_COUNT) return;
 
     // This should be called at 00:01 each day
+    day_low = asc_day_low();
+    if (day_low != UINT16_MAX)
+    {
+        asc_state.daily_low[asc_state.daily_head] = day_low;
+        asc_state.daily_head                      = (asc_state.daily_head + 1) % ASC_WINDOW_DAYS;
+        if (asc_state.daily_count < ASC_WINDOW_DAYS) asc_state.daily_count++;
+    }
+
     asc_state.day_count++;
     asc_state.day_record_count = 0;
+    asc_state.day_low_count    = 0;
 
-    print("Lowest CO2 this ASC period: %d\n", asc_state.lowest3);
+    baseline = asc_baseline();
+    print("Daily low: %d, baseline: %d\n", day_low, baseline);
     print("ASC day: %d\n", asc_state.day_count);
 
-    if (asc_state.day_count >= 7)
+    if (asc_state.day_count >= ASC_WINDOW_DAYS && baseline != UINT16_MAX)
     {
         int16_t old_cc = co2_ctx.cc_value;
 
         // Calculate new CC
-        int16_t adjustment = asc_state.target - asc_state.lowest3;
+        int16_t adjustment = asc_state.target - baseline;
 
         co2_ctx.cc_value += adjustment;
 
         print("Weekly ASC adjustment: %d, New CC: %d\n", adjustment, co2_ctx.cc_value);
 
         add_history_record(asc_state.target, RECORD_TYPE_CALIB_TARGET);
-        add_history_record(asc_state.lowest3, RECORD_TYPE_ASC_LOWEST);
+        add_history_record(baseline, RECORD_TYPE_ASC_LOWEST);
         add_history_record(old_cc, RECORD_TYPE_CALIBRATION_CORRECTION_OLD);
         add_history_record(co2_ctx.cc_value, RECORD_TYPE_CALIBRATION_CORRECTION);
 
         // Save CC to flash
         cfg_fstorage_set_cc(co2_ctx.cc_value);
 
-        // Reset for next period
-        asc_state.day_count        = 0;
-        asc_state.lowest3          = 10000;
-        asc_state.reading1         = 0;
-        asc_state.reading2         = 0;
-        asc_state.reading0         = 0;
-        asc_state.target           = calib_ctx.co2_calib_target;
-        asc_state.day_record_count = 0;
+        // Reset for next period, the window rolls on with the new CC
+        asc_state.day_count = 0;
+        asc_state.target    = calib_ctx.co2_calib_target;
+        asc_shift(adjustment);
 
         EventGroupSetBits(event_group_system, EVT_CO2_UP_HIS);
-
-        print("Weekly ASC adjustment: %d, New CC: %d\n", adjustment, co2_ctx.cc_value);
     }
+
+    asc_checkpoint();
 }
 
 float get_co2_scale_factor(void)
@@ -509,13 +964,179 @@ float get_co2_scale_factor(void)
     {
         scale_factor = cfg_fstorage_get_co2_scale_factor();
     }
-
-    print("CO2 Scaling: Factor=%d.%03d\n",
-          (int)scale_factor,
-          (int)((scale_factor - (int)scale_factor) * 1000));
     return scale_factor;
 }
 
+/** Convert the scale factor for the filter when it changed, readings are scaled in Q14 */
+static void co2_filter_update_scale(void)
+{
+    float scale_factor = get_co2_scale_factor();
+
+    if (scale_factor != co2_filter_scale_factor)
+    {
+        co2_filter_scale_factor = scale_factor;
+        co2_filter_set_scale(&co2_filter, scale_factor);
+        print("CO2 Scaling: Factor=%d.%03d, Q14 %d\n",
+              (int)scale_factor,
+              (int)((scale_factor - (int)scale_factor) * 1000),
+              co2_filter.scale_q14);
+    }
+}
+
+/**
+ * @brief Get the sample interval of a power mode
+ *
+ * @param mode Power mode
+ * @return uint32_t Interval in ms, UINT32_MAX for on demand
+ */
+static uint32_t co2_get_sample_interval_ms(power_mode_t mode)
+{
+    switch (mode)
+    {
+    case PWR_MODE_HI:
+        return 5 * 1000;
+    case PWR_MODE_MID:
+        return 1 * 60 * 1000;
+    case PWR_MODE_LOW:
+        return 3 * 60 * 1000;
+    default:
+        return UINT32_MAX;
+    }
+}
+
+/** Adaptive interval bounds in ms, only MID and LOW adapt */
+static uint32_t interval_min_ms[PWR_MODE_HI + 1] = {
+    [PWR_MODE_LOW] = CO2_ADAPT_LOW_MIN_MS,
+    [PWR_MODE_MID] = CO2_ADAPT_MID_MIN_MS,
+};
+static uint32_t interval_max_ms[PWR_MODE_HI + 1] = {
+    [PWR_MODE_LOW] = CO2_ADAPT_LOW_MAX_MS,
+    [PWR_MODE_MID] = CO2_ADAPT_MID_MAX_MS,
+};
+
+/** Interval until the next sample of the current power mode */
+static uint32_t co2_get_interval_ms(void)
+{
+    return co2_ctx.interval_ms != 0 ? co2_ctx.interval_ms : co2_get_sample_interval_ms(co2_ctx.power_mode);
+}
+
+/**
+ * Adapt the sample interval to the rate of change of the last two readings.
+ * A fast change drops to the minimum interval, a moderate change halves it and
+ * a flat reading doubles it. With ASC enabled the interval is capped so a day
+ * still has ASC_PER_DAY_RECORD_COUNT readings.
+ */
+static void co2_adapt_interval(uint16_t ppm)
+{
+    uint32_t now      = GetSystemTickCount();
+    uint32_t interval = co2_get_interval_ms();
+    uint32_t max_ms;
+    uint32_t elapsed_ms;
+    uint32_t slope; // ppm per minute
+
+    if (co2_ctx.power_mode != PWR_MODE_MID && co2_ctx.power_mode != PWR_MODE_LOW)
+    {
+        co2_ctx.interval_ms = 0;
+    }
+    else
+    {
+        if (co2_ctx.last_sample_ppm != 0)
+        {
+            elapsed_ms = GetSystemTickSpan(co2_ctx.last_sample_tick, now) * TICK_RATE_MS;
+            if (elapsed_ms < 1000) elapsed_ms = 1000;
+
+            slope = (uint32_t)abs((int32_t)ppm - (int32_t)co2_ctx.last_sample_ppm) * 60000 / elapsed_ms;
+
+            if (slope >= CO2_ADAPT_FAST_PPM_MIN)
+            {
+                interval = 0;
+            }
+            else if (slope >= CO2_ADAPT_MODERATE_PPM_MIN)
+            {
+                interval /= 2;
+            }
+            else if (slope < CO2_ADAPT_FLAT_PPM_MIN)
+            {
+                interval *= 2;
+            }
+        }
+
+        max_ms = interval_max_ms[co2_ctx.power_mode];
+        if (asc_enabled && max_ms > 24 * 60 * 60 * 1000 / ASC_PER_DAY_RECORD_COUNT)
+        {
+            max_ms = 24 * 60 * 60 * 1000 / ASC_PER_DAY_RECORD_COUNT;
+        }
+
+        if (interval < interval_min_ms[co2_ctx.power_mode]) interval = interval_min_ms[co2_ctx.power_mode];
+        if (interval > max_ms) interval = max_ms;
+
+        if (interval != co2_ctx.interval_ms)
+        {
+            dlog_d(CO2, "sample interval %d ms\n", interval);
+        }
+        co2_ctx.interval_ms = interval;
+    }
+
+    co2_ctx.last_sample_ppm  = ppm;
+    co2_ctx.last_sample_tick = now;
+}
+
+uint8_t set_co2_interval_bounds(power_mode_t mode, uint16_t min_s, uint16_t max_s)
+{
+    if ((mode != PWR_MODE_MID && mode != PWR_MODE_LOW) || min_s < CO2_ADAPT_MIN_S || min_s > max_s)
+    {
+        return 1;
+    }
+
+    interval_min_ms[mode] = (uint32_t)min_s * 1000;
+    interval_max_ms[mode] = (uint32_t)max_s * 1000;
+    if (mode == co2_ctx.power_mode)
+    {
+        co2_ctx.interval_ms = 0;
+    }
+    print("sample interval bounds of mode %d: %d - %d s\n", mode, min_s, max_s);
+    return 0;
+}
+
+/**
+ * Select the acquisition profile of the next sample.
+ * Single shot measurements (SCD41 only) leave the sensor idle between samples
+ * and skip the stop command and its 500ms wait. Calibration keeps standard
+ * periodic measurement running, as forced recalibration requires it.
+ * Low power periodic is only used in HI mode when selected; the firmware ASC
+ * then sees a reading every 30 s instead of 5 s, which still gives far more
+ * than ASC_PER_DAY_RECORD_COUNT readings per day. The sensor's own ASC stays
+ * disabled.
+ */
+static co2_profile_t co2_select_profile(void)
+{
+    if (EventGroupCheckBits(event_group_system, EVT_CO2_CALIB_TIMING))
+    {
+        return CO2_PROFILE_PERIODIC;
+    }
+    if (co2_ctx.sensor_variant == 1 && co2_get_interval_ms() >= CO2_SINGLE_SHOT_MIN_INTERVAL_MS)
+    {
+        return CO2_PROFILE_SINGLE_SHOT;
+    }
+    if (co2_ctx.power_mode == PWR_MODE_HI)
+    {
+        return co2_ctx.hi_profile;
+    }
+    return CO2_PROFILE_PERIODIC;
+}
+
+/** Time from the start of a measurement until its data is ready */
+static uint32_t co2_get_measurement_ms(co2_profile_t profile)
+{
+    return profile == CO2_PROFILE_LOW_POWER_PERIODIC ? 30 * 1000 : 5 * 1000;
+}
+
+/** Energy consumer of a profile */
+static energy_consumer_t co2_get_energy_consumer(co2_profile_t profile)
+{
+    return profile == CO2_PROFILE_LOW_POWER_PERIODIC ? ENERGY_SCD4X_LP_MEAS : ENERGY_SCD4X_MEAS;
+}
+
 #define APP_CHECK(label, func_call, default_app_err_code)                                                      \
     do                                                                                                         \
     {                                                                                                          \
@@ -541,6 +1162,17 @@ float get_co2_scale_factor(void)
         }                                                                                                      \
     } while (0)
 
+// run an SCD4x command with the non-blocking transfer, the task yields until it completes
+#define CO2_TWI_TRANSFER(label, cmd, exec_ms, rx_len, default_app_err_code)                 \
+    do                                                                                      \
+    {                                                                                       \
+        if (co2_twi_transfer_start((cmd), (exec_ms), (rx_len)) == 0)                        \
+        {                                                                                   \
+            TaskWait(!co2_twi_transfer_busy(), CO2_TWI_TIMEOUT_MS / TICK_RATE_MS);          \
+        }                                                                                   \
+        APP_CHECK(label, co2_twi_transfer_result(), default_app_err_code);                  \
+    } while (0)
+
 // macro for waiting the co2 up his timer to be cleared
 #define WAIT_CO2_UP_HIS() TaskWait(EventGroupCheckBits(event_group_system, EVT_CO2_UP_HIS) == 0, TICK_MAX);
 
@@ -619,6 +1251,8 @@ TaskDefine(task_co2_read)
     {
         asc_enabled        = cfg_fstorage_get_auto_calibrate();
         co2_ctx.power_mode = cfg_fstorage_get_power_mode();
+        co2_filter_init(&co2_filter);
+        co2_filter_scale_factor = 0;
         print("task_co2_init run\n");
 
         print("task_co2_read run\n");
@@ -659,11 +1293,11 @@ TaskDefine(task_co2_read)
             goto sensor_error;
         }
 
-        // Initialize ASC if enabled
+        // Continue ASC if enabled, the period survives soft and WDT resets
         calib_ctx.co2_calib_target = cfg_fstorage_get_calib_target();
         if (asc_enabled)
         {
-            asc_init();
+            asc_resume();
         }
 
         while (1)
@@ -674,7 +1308,9 @@ TaskDefine(task_co2_read)
                 break; // Exit the loop and the task, it will be restarted when the battery is charged
             }
 
-            if (EventGroupCheckBits(event_group_system, EVT_GET_SENSOR_DETAILS))
+            // while degraded the TWI is off, the re-initialization below runs first and the
+            // request is answered when the measurement wait breaks on it
+            if (EventGroupCheckBits(event_group_system, EVT_GET_SENSOR_DETAILS) && co2_ctx.is_twi_inited)
             {
                 EventGroupClearBits(event_group_system, EVT_GET_SENSOR_DETAILS);
                 handle_get_sensor_details(&gs_handle);
@@ -708,8 +1344,7 @@ TaskDefine(task_co2_read)
             {
                 EventGroupClearBits(event_group_system, EVT_CO2_CALIB_START);
 
-                calib_ctx.calib_duration_record_count = 0;
-                calib_ctx.calib_duration_sum          = 0;
+                calib_reset();
                 EventGroupSetBits(event_group_system, EVT_CO2_CALIB_TIMING);
                 calib_ctx.power_mode_before_calib = co2_ctx.power_mode;
 
@@ -764,16 +1399,29 @@ TaskDefine(task_co2_read)
 
             co2_ctx.start_tick = GetSystemTickCount();
 
-            APP_CHECK(sensor_error, scd4x_start_periodic_measurement(&gs_handle), ERROR_CODE_SENSOR_MEASURMENT_START);
+            co2_ctx.profile = co2_select_profile();
+            if (co2_ctx.profile == CO2_PROFILE_PERIODIC)
+            {
+                CO2_TWI_TRANSFER(sensor_error, CO2_CMD_START_PERIODIC, 0, 0, ERROR_CODE_SENSOR_MEASURMENT_START);
+            }
+            else if (co2_ctx.profile == CO2_PROFILE_LOW_POWER_PERIODIC)
+            {
+                CO2_TWI_TRANSFER(sensor_error, CO2_CMD_START_LOW_POWER_PERIODIC, 0, 0, ERROR_CODE_SENSOR_MEASURMENT_START);
+            }
+            energy_begin(co2_get_energy_consumer(co2_ctx.profile));
 
             do
             {
-                print("scd4x_start_single_shot\n");
+                if (co2_ctx.profile == CO2_PROFILE_SINGLE_SHOT)
+                {
+                    print("scd4x_start_single_shot\n");
+                    CO2_TWI_TRANSFER(sensor_error, CO2_CMD_MEASURE_SINGLE_SHOT, 0, 0, ERROR_CODE_SENSOR_MEASURMENT_START);
+                }
 
                 EventGroupSetBits(event_group_system, EVT_BATTER_ADC_EN);     // Enable battery sampling
                 EventGroupClearBits(event_group_system, EVT_CO2_UPDATE_ONCE); // clear update once flag
 
-                TaskWait(EventGroupCheckBits(event_group_system, EVT_BAT_LOW | EVT_BAT_LOW_WARNING), 5000 / TICK_RATE_MS); // wait for 5 seconds or battery low
+                TaskWait(EventGroupCheckBits(event_group_system, EVT_BAT_LOW | EVT_BAT_LOW_WARNING), co2_get_measurement_ms(co2_ctx.profile) / TICK_RATE_MS); // wait for the measurement or battery low
 
                 if (EventGroupCheckBits(event_group_system, EVT_BAT_LOW | EVT_BAT_LOW_WARNING))
                 {
@@ -781,8 +1429,15 @@ TaskDefine(task_co2_read)
                     break;
                 }
 
-                // check if data is ready
-                APP_CHECK(sensor_error, scd4x_get_data_ready_status(&gs_handle, &co2_ctx.drdy), ERROR_CODE_SENSOR_DATA_STATUS);
+                // check if data is ready, poll a few more times if the sensor is slightly late
+                drdy_polls = 0;
+                while (1)
+                {
+                    CO2_TWI_TRANSFER(sensor_error, CO2_CMD_GET_DATA_READY_STATUS, 1, 3, ERROR_CODE_SENSOR_DATA_STATUS);
+                    co2_ctx.drdy = (co2_twi_get_word(0) & 0x0FFF) ? SCD4X_BOOL_TRUE : SCD4X_BOOL_FALSE;
+                    if (co2_ctx.drdy || ++drdy_polls > CO2_DRDY_POLLS) break;
+                    TaskDelay(CO2_DRDY_POLL_MS / TICK_RATE_MS);
+                }
 
                 if (!co2_ctx.drdy)
                 {
@@ -791,8 +1446,12 @@ TaskDefine(task_co2_read)
                     goto sensor_error;
                 }
 
-                APP_CHECK(sensor_error, scd4x_read(&gs_handle, &co2_ctx.co2_ppm, &co2_ctx.sensor_status, &co2_ctx.asc_count, &co2_ctx.asc_correction), ERROR_CODE_SENSOR_READ);
-                print("read co2 %d ppm, sensor status %d\n", co2_ctx.co2_ppm, co2_ctx.sensor_status);
+                CO2_TWI_TRANSFER(sensor_error, CO2_CMD_READ_MEASUREMENT, 1, 18, ERROR_CODE_SENSOR_READ);
+                co2_ctx.co2_ppm        = co2_twi_get_word(0);
+                co2_ctx.sensor_status  = co2_twi_get_word(3);
+                co2_ctx.asc_count      = co2_twi_get_word(4);
+                co2_ctx.asc_correction = (int16_t)(co2_twi_get_word(5) - 0x8000);
+                dlog_d(CO2, "read co2 %d ppm, sensor status %d\n", co2_ctx.co2_ppm, co2_ctx.sensor_status);
 
                 // if the sensor status is not zero, it means the sensor is not ready
                 if (co2_ctx.sensor_status != 0)
@@ -803,8 +1462,9 @@ TaskDefine(task_co2_read)
                 }
 
                 // use scaling to get the real co2 ppm
-                co2_ctx.co2_ppm = (uint16_t)(co2_ctx.co2_ppm * get_co2_scale_factor());
-                print("co2_ppm after scaling: %d\n", co2_ctx.co2_ppm);
+                co2_filter_update_scale();
+                co2_ctx.co2_ppm = co2_filter_scale(&co2_filter, co2_ctx.co2_ppm);
+                dlog_d(CO2, "co2_ppm after scaling: %d\n", co2_ctx.co2_ppm);
 
                 // Check for invalid CO2 readings (only extremely high values)
                 // Note: Low values (< 400 ppm) are normal for clean air and are clamped to 400 in display
@@ -818,8 +1478,7 @@ TaskDefine(task_co2_read)
 
                 if (EventGroupCheckBits(event_group_system, EVT_CO2_CALIB_TIMING))
                 {
-                    calib_ctx.calib_duration_record_count += 1;
-                    calib_ctx.calib_duration_sum += co2_ctx.co2_ppm;
+                    calib_add_reading(co2_ctx.co2_ppm);
 
                     // wait for the co2 up his timer to be cleared
                     WAIT_CO2_UP_HIS();
@@ -830,7 +1489,8 @@ TaskDefine(task_co2_read)
                 else
                 {
 
-                    if (co2_ctx.old_co2_ppm != 0)
+                    // The jump check is only needed while the median filter does not reject spikes
+                    if (co2_ctx.old_co2_ppm != 0 && co2_filter.cfg.median_n == 1)
                     {
                         // if the co2 ppm is changed > 2x or < 0.5x, it means the sensor is not stable
                         // skip this reading and continue
@@ -863,13 +1523,14 @@ TaskDefine(task_co2_read)
                         }
                     }
 
-                    print("CO2 PPM: %d, CC: %d, is_stable: %d\n", co2_ctx.co2_ppm, co2_ctx.cc_value, co2_ctx.is_stable);
+                    dlog_i(CO2, "CO2 PPM: %d, CC: %d, is_stable: %d\n", co2_ctx.co2_ppm, co2_ctx.cc_value, co2_ctx.is_stable);
 
                     co2_ctx.old_co2_ppm = co2_ctx.co2_ppm;
                     co2_ctx.is_stable   = true;
 
-                    // Now that we have the stable reading, add cc value to co2 ppm
-                    co2_ctx.co2_ppm = (uint16_t)(co2_ctx.co2_ppm + co2_ctx.cc_value);
+                    // Now that we have the stable reading, add cc value and filter it
+                    co2_ctx.co2_ppm = co2_filter_process(&co2_filter, co2_ctx.co2_ppm, co2_ctx.cc_value);
+                    dlog_d(CO2, "co2 raw %d, filtered %d\n", co2_filter.raw, co2_ctx.co2_ppm);
 
                     // wait for the co2 up his timer to be cleared
                     WAIT_CO2_UP_HIS();
@@ -881,6 +1542,7 @@ TaskDefine(task_co2_read)
                     }
 
                     co2_ctx.co2_value = co2_ctx.co2_ppm;
+                    co2_adapt_interval(co2_ctx.co2_ppm);
 
                     // if the co2 up history flag is set, wait for co2 up history flag to be cleared
                     // before sending the co2 value to the NUS
@@ -892,17 +1554,28 @@ TaskDefine(task_co2_read)
                 }
 
                 co2_ctx.sensor_error_count = 0; // reset sensor error count after a successful reading
-                consecutive_sensor_errors  = 0; // reset consecutive error count after successful reading
+                if (consecutive_sensor_errors != 0)
+                {
+                    print("sensor recovered at stage %d\n", consecutive_sensor_errors - 1);
+                    consecutive_sensor_errors = 0; // reset consecutive error count after successful reading
+                    EventGroupClearBits(event_group_system, EVT_CO2_SENSOR_ERROR);
+                    EventGroupSetBits(event_group_system, EVT_UI_UP_CO2);
+                }
 
                 if (EventGroupCheckBits(event_group_system, EVT_CO2_MEASUREMENT_BREAK)) break; // Exit on break condition
 
-            } while (co2_ctx.power_mode == PWR_MODE_HI || !co2_ctx.is_stable);
+            } while ((co2_ctx.power_mode == PWR_MODE_HI && co2_ctx.profile == co2_select_profile()) || !co2_ctx.is_stable ||
+                     (EventGroupCheckBits(event_group_system, EVT_CO2_CALIB_TIMING) && !calib_ctx.calib_converged)); // calibration samples continuously until it converges
 
             goto sensor_wait;
 
         sensor_wait:
-            APP_CHECK(sensor_error, scd4x_stop_periodic_measurement(&gs_handle), ERROR_CODE_SENSOR_MEASURMENT_STOP);
-            TaskDelay(500 / TICK_RATE_MS); // Wait 500ms to make sure the sensor stops the measurement
+            if (co2_ctx.profile != CO2_PROFILE_SINGLE_SHOT)
+            {
+                CO2_TWI_TRANSFER(sensor_error, CO2_CMD_STOP_PERIODIC, 0, 0, ERROR_CODE_SENSOR_MEASURMENT_STOP);
+                TaskDelay(500 / TICK_RATE_MS); // Wait 500ms to make sure the sensor stops the measurement
+            }
+            energy_end(co2_get_energy_consumer(co2_ctx.profile));
 
             if (co2_ctx.power_mode == PWR_MODE_MID)
             {
@@ -910,7 +1583,7 @@ TaskDefine(task_co2_read)
                 TaskWait(
                     co2_ctx.power_mode != PWR_MODE_MID ||
                         EventGroupCheckBits(event_group_system, EVT_CO2_UPDATE) ||
-                        GetSystemTickSpan(co2_ctx.start_tick, GetSystemTickCount()) >= (1 * 60 * 1000) / TICK_RATE_MS,
+                        GetSystemTickSpan(co2_ctx.start_tick, GetSystemTickCount()) >= co2_get_interval_ms() / TICK_RATE_MS,
                     TICK_MAX);
             }
             //
@@ -921,7 +1594,7 @@ TaskDefine(task_co2_read)
                 TaskWait(
                     co2_ctx.power_mode != PWR_MODE_LOW ||
                         EventGroupCheckBits(event_group_system, EVT_CO2_UPDATE) ||
-                        GetSystemTickSpan(co2_ctx.start_tick, GetSystemTickCount()) >= (3 * 60 * 1000) / TICK_RATE_MS,
+                        GetSystemTickSpan(co2_ctx.start_tick, GetSystemTickCount()) >= co2_get_interval_ms() / TICK_RATE_MS,
                     TICK_MAX);
             }
             else // PWR_MODE_ON_DEMAND
@@ -949,6 +1622,7 @@ TaskDefine(task_co2_read)
             // if the error code is not start measurement, stop the measurement first
             if (co2_ctx.error_code != ERROR_CODE_SENSOR_MEASURMENT_START)
             {
+                energy_end(co2_get_energy_consumer(co2_ctx.profile));
                 scd4x_stop_periodic_measurement(&gs_handle);
                 TaskDelay(500 / TICK_RATE_MS); // Wait 500ms to make sure the sensor stops the measurement
             }
@@ -957,55 +1631,81 @@ TaskDefine(task_co2_read)
             WAIT_CO2_UP_HIS();
 
             add_history_record(co2_ctx.error_code, RECORD_TYPE_SENSOR_ERROR);
+            trace_add(TRACE_EVT_CO2_ERROR, co2_ctx.error_code, consecutive_sensor_errors + 1);
 
-            // First error: just log and retry immediately
-            if (co2_ctx.sensor_error_count == 0)
+            EventGroupSetBits(event_group_system, EVT_CO2_UP_HIS);
+            co2_ctx.sensor_error_count += 1;
+            co2_filter_reset(&co2_filter);
+
+            // Graduated recovery, each consecutive error takes the next stage
+            // (an if chain, the task's own switch does not allow waits inside a switch)
+            if (consecutive_sensor_errors == CO2_RECOVERY_RETRY)
             {
-                print("First error - logging and retrying immediately\n");
-                EventGroupSetBits(event_group_system, EVT_CO2_UP_HIS);
-                co2_ctx.sensor_error_count += 1;
-                consecutive_sensor_errors++;
-                continue;
+                print("Recovery: retry\n");
             }
-            // Second error: power cycle sensor and retry (silent - no display to user)
-            else if (consecutive_sensor_errors == 1)
+            else if (consecutive_sensor_errors == CO2_RECOVERY_BUS_CLEAR)
             {
-                print("Second error - power cycling sensor (silent recovery)\n");
-                consecutive_sensor_errors++;
-                EventGroupSetBits(event_group_system, EVT_CO2_UP_HIS); // Log to history only
+                print("Recovery: bus clear\n");
+                trace_add(TRACE_EVT_CO2_RECOVERY, CO2_RECOVERY_BUS_CLEAR, co2_twi_bus_clear());
+            }
+            else if (consecutive_sensor_errors == CO2_RECOVERY_REINIT)
+            {
+                print("Recovery: reinit\n");
+                trace_add(TRACE_EVT_CO2_RECOVERY, CO2_RECOVERY_REINIT, scd4x_reinit(&gs_handle));
+                TaskDelay(30 / TICK_RATE_MS); // reinit execution time
+                scd4x_set_automatic_self_calibration(&gs_handle, false);
+            }
+            else if (consecutive_sensor_errors == CO2_RECOVERY_POWER_CYCLE)
+            {
+                print("Recovery: power cycle\n");
+                co2_twi_uninit();
+                CO2_PWR_OFF();
+                TaskDelay(2000 / TICK_RATE_MS); // 2 second power-off
+
+                co2_sensor_power_on();
+                TaskDelay(1500 / TICK_RATE_MS); // wait for sensor power on complete
 
-                // Power cycle sensor
-                if (co2_ctx.is_twi_inited)
+                if (co2_twi_init() == 0 && co2_verify_serial() == 0)
                 {
-                    co2_twi_uninit();
+                    trace_add(TRACE_EVT_CO2_POWER_CYCLE, 1, 0);
+                    scd4x_set_automatic_self_calibration(&gs_handle, false);
                 }
-                CO2_PWR_OFF();
-
-                TaskDelay(2000 / TICK_RATE_MS); // 2 second power-off
+                else
+                {
+                    // The sensor does not answer as itself, go degraded right away
+                    trace_add(TRACE_EVT_CO2_POWER_CYCLE, 0, 0);
+                    consecutive_sensor_errors = CO2_RECOVERY_DEGRADED;
+                }
+            }
 
+            if (consecutive_sensor_errors >= CO2_RECOVERY_DEGRADED)
+            {
+                // Keep the rest of the device running with the sensor off and the error shown,
+                // the next attempt powers the sensor up again through the re-initialization
+                // at the top of the loop and stays degraded when it fails
+                print("Recovery: degraded, retry in %d s\n", CO2_RECOVERY_DEGRADED_RETRY_MS / 1000);
+                consecutive_sensor_errors = CO2_RECOVERY_DEGRADED;
+                trace_add(TRACE_EVT_CO2_RECOVERY, CO2_RECOVERY_DEGRADED, 1);
+                co2_sensor_cleanup();
+                co2_ctx.co2_value = 0;
+                EventGroupSetBits(event_group_system, EVT_CO2_SENSOR_ERROR | EVT_UI_UP_CO2);
+                EventGroupClearBits(event_group_system, EVT_GET_SENSOR_DETAILS); // not answered, a new request retries
+
+                // a button press or a protocol request retries early
+                co2_ctx.start_tick = GetSystemTickCount();
+                TaskWait(
+                    EventGroupCheckBits(event_group_system, EVT_BAT_LOW | EVT_BAT_LOW_WARNING | EVT_CO2_UPDATE) ||
+                        GetSystemTickSpan(co2_ctx.start_tick, GetSystemTickCount()) >= CO2_RECOVERY_DEGRADED_RETRY_MS / TICK_RATE_MS,
+                    TICK_MAX);
+                EventGroupClearBits(event_group_system, EVT_CO2_UPDATE_ONCE);
                 continue;
             }
-            // Third error: restart entire device
-            else
-            {
-                print("Third consecutive error - RESTARTING DEVICE\n");
-                EventGroupSetBits(event_group_system, EVT_CO2_SENSOR_ERROR | EVT_CO2_UP_HIS);
-                EventGroupSetBits(event_group_system, EVT_SCREEN_ON_ONETIME);
-
-                // Show error briefly before restart
-                TaskDelay(2000 / TICK_RATE_MS);
-
-                // Log device restart to history
-                
-                WAIT_CO2_UP_HIS();
-                add_history_record(0xFF, RECORD_TYPE_SENSOR_ERROR); // 0xFF = device restart marker
-                EventGroupSetBits(event_group_system, EVT_CO2_UP_HIS);
-                TaskDelay(100 / TICK_RATE_MS); // Brief delay to ensure history write completes
 
-                // System reset
-                print("TIMESTAMP BEFORE SENSOR-ERROR RESET: %u\n", get_time_now());
-                NVIC_SystemReset();
+            if (consecutive_sensor_errors < CO2_RECOVERY_DEGRADED)
+            {
+                consecutive_sensor_errors++;
             }
+            continue;
         }
 
         // Cleanup sensor using generic function
@@ -1174,6 +1874,62 @@ static uint8_t evaluate_advanced_alarms(
     return active_alarm_repeats;
 }
 
+// Helper function to evaluate predictive alarms, an early alert when the trend reaches a level within the lead time.
+// Each level alerts once and re-arms when the reading is below it and the trend has not reached it for a lead
+// time, a fit that drops out for a few noisy readings does not alert again.
+static uint8_t evaluate_predicted_alarms(
+    const advanced_alarm_setting_t *p_alarms, // NULL for the basic yellow/red levels
+    uint16_t                        current_co2,
+    bool                            trend_rising,
+    uint16_t                       *p_predicted_mask, // Bit per level index
+    uint32_t                       *p_reach_time      // Time the trend last reached each level
+)
+{
+    uint8_t           active_alarm_repeats = 0;
+    uint8_t           level_count          = p_alarms ? 10 : 2;
+    uint32_t          now                  = get_time_now();
+    co2_predict_cfg_t cfg;
+    uint16_t          level;
+    uint16_t          bit;
+
+    co2_predict_get_config(&cfg);
+
+    for (uint8_t i = 0; i < level_count; ++i)
+    {
+        if (p_alarms)
+        {
+            if (!p_alarms[i].notification_enabled || p_alarms[i].alarm_repeats == 0 || p_alarms[i].co2_level == 0) continue;
+            level = p_alarms[i].co2_level;
+        }
+        else
+        {
+            level = i == 0 ? cfg_fstorage_get_graph_yellow_start() : cfg_fstorage_get_graph_red_start();
+        }
+
+        bit = 1 << i;
+        if (current_co2 >= level)
+        {
+            continue; // the threshold alarm has taken over
+        }
+
+        if (trend_rising && co2_predict_within_lead(level))
+        {
+            p_reach_time[i] = now;
+            if (!(*p_predicted_mask & bit))
+            {
+                print("ALARM TYPE: PREDICTED - CO2 %u reaches Level %u in %u s\n", current_co2, level, co2_predict_eta_s(level));
+                active_alarm_repeats = 1; // a single pre-alert, the threshold alarm uses the level's repeats
+                *p_predicted_mask |= bit;
+            }
+        }
+        else if (now - p_reach_time[i] >= (uint32_t)cfg.lead_min * 60)
+        {
+            *p_predicted_mask &= ~bit;
+        }
+    }
+    return active_alarm_repeats;
+}
+
 TaskDefine(task_co2_alarm)
 {
     static uint8_t                  vibrator_state, buzzer_enabled_state;
@@ -1184,6 +1940,8 @@ TaskDefine(task_co2_alarm)
     static uint16_t                 has_falling_alarm_triggered_for_level[10] = {0};
     static bool                     co2_is_falling                            = false; // Moved and made static
     static bool                     falling_alarms_enabled                    = false; // Moved and made static
+    static uint16_t                 predicted_alarm_mask                      = 0;
+    static uint32_t                 predicted_reach_time[10]                  = {0};
 
     TTS
     {
@@ -1207,6 +1965,11 @@ TaskDefine(task_co2_alarm)
             {
                 EventGroupClearBits(event_group_system, EVT_CO2_UP_ALARM);
 
+                if (co2_ctx.co2_value != 0)
+                {
+                    co2_predict_add(co2_ctx.co2_value, get_time_now());
+                }
+
                 if (is_dnd_time())
                 {
                     print("DND time, skip alarm\n");
@@ -1243,6 +2006,14 @@ TaskDefine(task_co2_alarm)
                     active_alarm_repeats = evaluate_advanced_alarms(alarms, co2_ctx.co2_value, last_co2_value, co2_is_falling, falling_alarms_enabled, last_alarm_triggered_level, has_falling_alarm_triggered_for_level);
                 }
 
+                // No threshold crossed, check if the trend reaches one soon. A falling reading leaves the
+                // pre-alerts as they are, a noisy dip must not re-arm them.
+                if (active_alarm_repeats == 0 && !co2_is_falling)
+                {
+                    active_alarm_repeats = evaluate_predicted_alarms(advanced_alarms_enabled ? alarms : NULL, co2_ctx.co2_value,
+                                                                     co2_predict_update(), &predicted_alarm_mask, predicted_reach_time);
+                }
+
                 last_co2_value = co2_ctx.co2_value;
 
                 print("Final active_alarm_repeats for this cycle: %u\n", active_alarm_repeats);
@@ -1,8 +1,11 @@
 #ifndef __CO2_H__
 #define __CO2_H__
 
+#include "app_timer.h"
 #include "battery.h"
 #include "cfg_fstorage.h" // For advanced_alarm_setting_t and its accessors
+#include "co2_filter.h"
+#include "co2_predict.h"
 #include "custom_board.h"
 #include "driver_scd4x_basic.h"
 #include "log.h"
@@ -11,6 +14,7 @@
 #include "nrf_gpio.h"
 #include "nrf_strerror.h"
 #include "protocol.h"
+#include "trace.h"
 #include "ttask.h"
 #include "user.h"
 #include <stdint.h>
@@ -23,6 +27,24 @@ typedef enum
     PWR_MODE_HI,
 } power_mode_t;
 
+/** SCD4x acquisition profiles */
+typedef enum
+{
+    CO2_PROFILE_PERIODIC = 0,       // periodic measurement (0x21b1), a sample every 5 s
+    CO2_PROFILE_LOW_POWER_PERIODIC, // low power periodic measurement (0x21ac), a sample every 30 s
+    CO2_PROFILE_SINGLE_SHOT,        // single shot (0x219d) per sample, sensor idle in between, SCD41 only
+} co2_profile_t;
+
+/** Sensor recovery stages, one step is taken per consecutive error */
+typedef enum
+{
+    CO2_RECOVERY_RETRY = 0,    // retry the measurement
+    CO2_RECOVERY_BUS_CLEAR,    // release a stuck bus with SCL pulses and reinitialize TWI
+    CO2_RECOVERY_REINIT,       // reinit command, the sensor reloads its settings from EEPROM
+    CO2_RECOVERY_POWER_CYCLE,  // power cycle, the serial number must read back unchanged
+    CO2_RECOVERY_DEGRADED,     // sensor off, error shown, power cycle retried every CO2_RECOVERY_DEGRADED_RETRY_MS
+} co2_recovery_t;
+
 typedef enum
 {
     CO2_WARN_G = 0,
@@ -39,60 +61,127 @@ typedef enum
     CO2_ALARM_1500_MAX,
 } co2_alarm_t;
 
-// ASC state
-// Add these declarations
+/** ASC: days in the rolling baseline window, also the adjustment period */
+#define ASC_WINDOW_DAYS 7
+
+/** ASC: smallest 3-reading averages kept per day, bounds the daily low percentile */
+#define ASC_DAY_LOWS 8
+
+/** ASC: percentile of the 3-reading averages taken as the daily low */
+#define ASC_LOW_PERCENTILE 2
+
+// ASC state, kept in retained RAM with a CRC so it resumes after a soft or WDT reset
 typedef struct
 {
-    uint32_t lowest3;          // Lowest sum of 3 consecutive readings
-    uint16_t reading0;         // Last reading
-    uint16_t reading1;         // Second last reading
-    uint16_t reading2;         // Third last reading
-    uint8_t  day_count;        // Days elapsed in current ASC period
-    uint16_t target;           // Target CO2 value (default 426)
-    uint16_t day_record_count; // Number of records in current day
+    uint16_t reading0;                   // Last reading
+    uint16_t reading1;                   // Second last reading
+    uint16_t reading2;                   // Third last reading
+    uint16_t day_record_count;           // Number of records in current day
+    uint16_t day_lows[ASC_DAY_LOWS];     // Smallest 3-reading averages of the current day, ascending
+    uint16_t daily_low[ASC_WINDOW_DAYS]; // Low percentile of the past days, ring
+    uint8_t  day_low_count;              // Valid entries in day_lows
+    uint8_t  daily_head;                 // Next daily_low entry to write
+    uint8_t  daily_count;                // Valid entries in daily_low
+    uint8_t  day_count;                  // Days elapsed in current ASC period
+    uint16_t target;                     // Target CO2 value (default 426)
+    uint16_t crc;                        // CRC16 of the fields above
 } asc_state_t;
 
 // Calibration context structure
 typedef struct
 {
     power_mode_t power_mode_before_calib;
-    uint8_t      calib_duration_record_count;
-    uint32_t     calib_duration_sum;
+    uint8_t      calib_duration_record_count; // readings since the start, including the skipped ones
+    uint8_t      calib_count;                 // readings in the running mean
+    float        calib_mean;                  // running mean (Welford)
+    float        calib_m2;                    // sum of squared deviations from the mean (Welford)
+    bool         calib_converged;             // standard error of the mean within CO2_CALIB_TOLERANCE_PPM
     uint16_t     co2_calib_target;
 } calib_ctx_t;
 
 // CO2 context structure
 typedef struct
 {
-    float        tmp;
-    float        humi;
-    scd4x_bool_t drdy;
-    uint32_t     start_tick;
-    uint16_t     sensor_status;
-    uint16_t     co2_ppm;
-    uint16_t     old_co2_ppm;
-    uint16_t     co2_value;
-    bool         is_stable;
-    uint8_t      is_twi_inited;
-    power_mode_t power_mode;
-    int16_t      cc_value;
-    uint16_t     asc_count;
-    int16_t      asc_correction;
-    uint8_t      error_code;
-    uint8_t      sensor_variant;
-    uint8_t      sensor_error_count;
+    float         tmp;
+    float         humi;
+    scd4x_bool_t  drdy;
+    uint32_t      start_tick;
+    uint16_t      sensor_status;
+    uint16_t      co2_ppm;
+    uint16_t      old_co2_ppm;
+    uint16_t      co2_value;
+    bool          is_stable;
+    uint8_t       is_twi_inited;
+    power_mode_t  power_mode;
+    int16_t       cc_value;
+    uint16_t      asc_count;
+    int16_t       asc_correction;
+    uint8_t       error_code;
+    uint8_t       sensor_variant;
+    uint8_t       sensor_error_count;
+    co2_profile_t profile;          // acquisition profile of the current sample
+    co2_profile_t hi_profile;       // periodic profile used in HI mode
+    uint32_t      interval_ms;      // adaptive sample interval of MID and LOW, 0 uses the mode default
+    uint16_t      last_sample_ppm;  // previous reading for the rate of change, 0 when there is none
+    uint32_t      last_sample_tick; // tick of the previous reading
 } co2_ctx_t;
 
 // Function declarations
 void asc_process_reading(uint16_t new_reading);
 void asc_check_daily_update(bool check_record_count);
 void asc_init(void);
+void asc_resume(void);
 
 #define CO2_PPM_WARN_GY_DEF        800
 #define CO2_PPM_WARN_YR_DEF        1000
 #define CO2_ILLUMINATION_THRESHOLD 800
 #define CO2_CALIB_TARGET           426
 
+/** Calibration: readings skipped after the start while the sensor settles */
+#define CO2_CALIB_SKIP_SAMPLES 2
+
+/** Calibration: fewest readings in the mean before it can converge */
+#define CO2_CALIB_MIN_SAMPLES 8
+
+/** Calibration: the mean has converged when its standard error is within this */
+#define CO2_CALIB_TOLERANCE_PPM 3
+
+/** Shortest sample interval that uses single shot measurements, below it periodic measurement is kept running */
+#define CO2_SINGLE_SHOT_MIN_INTERVAL_MS (30 * 1000)
+
+/** Adaptive sampling: default interval bounds of MID and LOW, 210 s keeps ASC_PER_DAY_RECORD_COUNT readings a day */
+#define CO2_ADAPT_MID_MIN_MS (20 * 1000)
+#define CO2_ADAPT_MID_MAX_MS (210 * 1000)
+#define CO2_ADAPT_LOW_MIN_MS (60 * 1000)
+#define CO2_ADAPT_LOW_MAX_MS (210 * 1000)
+#define CO2_ADAPT_MIN_S      10
+
+/** Adaptive sampling: rate of change thresholds in ppm per minute */
+#define CO2_ADAPT_FAST_PPM_MIN     50 // drop to the minimum interval
+#define CO2_ADAPT_MODERATE_PPM_MIN 15 // halve the interval
+#define CO2_ADAPT_FLAT_PPM_MIN     5  // double the interval
+
+/** SCD4x commands issued by task_co2_read through the non-blocking transfer */
+#define CO2_CMD_START_PERIODIC           0x21B1
+#define CO2_CMD_START_LOW_POWER_PERIODIC 0x21AC
+#define CO2_CMD_MEASURE_SINGLE_SHOT      0x219D
+#define CO2_CMD_STOP_PERIODIC            0x3F86
+#define CO2_CMD_GET_DATA_READY_STATUS    0xE4B8
+#define CO2_CMD_READ_MEASUREMENT         0xEC05
+
+/** Longest response of a non-blocking transfer (read measurement with the ASC words) */
+#define CO2_TWI_RX_MAX 18
+
+/** Timeout of a non-blocking transfer, also bounds the blocking driver transfers */
+#define CO2_TWI_TIMEOUT_MS 100
+
+/** Retry period of the sensor in degraded mode */
+#define CO2_RECOVERY_DEGRADED_RETRY_MS (10 * 60 * 1000)
+
+/** Data ready polling after the measurement time, the sensor clock may run behind ours */
+#define CO2_DRDY_POLL_MS (500)
+#define CO2_DRDY_POLLS   (4)
+
 extern void advertising_start(void);
 extern void advertising_stop(void);
 
@@ -130,6 +219,41 @@ uint8_t co2_write(uint8_t addr, uint8_t *buf, uint16_t len);
  */
 uint8_t co2_read(uint8_t addr, uint8_t *buf, uint16_t len);
 
+/**
+ * @brief Start a non-blocking command transfer on TWIM (EasyDMA).
+ * The command is written, after exec_ms the response is read, all from the
+ * TWI and timer interrupts; poll co2_twi_transfer_busy() from the task.
+ *
+ * @param cmd SCD4x command.
+ * @param exec_ms Command execution time before the response can be read.
+ * @param rx_len Response length, 0 for write only commands.
+ * @return uint8_t 0 when started, 1 when a transfer is in progress.
+ */
+uint8_t co2_twi_transfer_start(uint16_t cmd, uint8_t exec_ms, uint8_t rx_len);
+
+/** Check if the non-blocking transfer is still running. */
+bool co2_twi_transfer_busy(void);
+
+/**
+ * @brief Finish the non-blocking transfer and check the response CRC.
+ *
+ * @return uint8_t 0 on success, 1 on a bus error or timeout, 4 on a CRC error.
+ */
+uint8_t co2_twi_transfer_result(void);
+
+/** Get a 16-bit word of the response, index counts words (3 bytes with CRC). */
+uint16_t co2_twi_get_word(uint8_t index);
+
+/** Check if the calibration readings have converged, the calibration can end early */
+bool is_co2_calib_converged(void);
+
+/**
+ * @brief Get the confidence of the last calibration
+ *
+ * @return uint16_t Standard error of the mean in 0.1 ppm, UINT16_MAX without readings
+ */
+uint16_t get_co2_calib_confidence(void);
+
 /**
  * @brief Get the CO2 concentration value.
  *
@@ -137,6 +261,20 @@ uint8_t co2_read(uint8_t addr, uint8_t *buf, uint16_t len);
  */
 uint16_t get_co2_value(void);
 
+/** Get the last CO2 reading after scale and CC offset, before filtering */
+uint16_t get_co2_raw_value(void);
+
+/**
+ * @brief Set the CO2 filter configuration, not persisted
+ *
+ * @param cfg Median window, EMA shift and slew limit
+ * @return uint8_t 0 on success, 1 for an invalid configuration
+ */
+uint8_t set_co2_filter(const co2_filter_cfg_t *cfg);
+
+/** Get the CO2 filter configuration */
+void get_co2_filter(co2_filter_cfg_t *cfg);
+
 /**
  * @brief Set the power mode (sampling mode).
  *
@@ -151,6 +289,27 @@ void set_power_mode(power_mode_t mode);
  */
 power_mode_t get_power_mode(void);
 
+/**
+ * @brief Select the periodic profile used in HI mode, not persisted
+ *
+ * @param profile CO2_PROFILE_PERIODIC or CO2_PROFILE_LOW_POWER_PERIODIC
+ * @return uint8_t 0 on success, 1 for an invalid profile
+ */
+uint8_t set_co2_hi_profile(co2_profile_t profile);
+
+/** Get the periodic profile used in HI mode */
+co2_profile_t get_co2_hi_profile(void);
+
+/**
+ * @brief Set the adaptive sample interval bounds of MID or LOW, not persisted
+ *
+ * @param mode PWR_MODE_MID or PWR_MODE_LOW
+ * @param min_s Shortest interval in seconds, at least CO2_ADAPT_MIN_S
+ * @param max_s Longest interval in seconds
+ * @return uint8_t 0 on success, 1 for invalid arguments
+ */
+uint8_t set_co2_interval_bounds(power_mode_t mode, uint16_t min_s, uint16_t max_s);
+
 /**
  * @brief Increment the power mode to the next mode.
  */
@@ -203,7 +362,7 @@ uint8_t get_error_code(void);
 /**
  * Get Sensor Recovery Attempt Count
  *
- * @return uint8_t Current recovery attempt number (0-5).
+ * @return uint8_t Current recovery stage, co2_recovery_t.
  */
 uint8_t get_sensor_recovery_attempt(void);
 
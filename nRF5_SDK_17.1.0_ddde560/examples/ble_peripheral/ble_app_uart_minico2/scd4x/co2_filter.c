@@ -0,0 +1,112 @@
+#include "co2_filter.h"
+#include <string.h>
+
+void co2_filter_init(co2_filter_t *filter)
+{
+    memset(filter, 0, sizeof(co2_filter_t));
+    filter->cfg.median_n = 1;
+    filter->scale_q14    = 1 << CO2_FILTER_SCALE_SHIFT;
+}
+
+void co2_filter_reset(co2_filter_t *filter)
+{
+    filter->window_count = 0;
+    filter->window_idx   = 0;
+    filter->primed       = false;
+}
+
+uint8_t co2_filter_configure(co2_filter_t *filter, const co2_filter_cfg_t *cfg)
+{
+    if ((cfg->median_n != 1 && cfg->median_n != 3 && cfg->median_n != CO2_FILTER_MEDIAN_MAX) ||
+        cfg->ema_shift > CO2_FILTER_EMA_SHIFT_MAX)
+    {
+        return 1;
+    }
+
+    filter->cfg = *cfg;
+    co2_filter_reset(filter);
+    return 0;
+}
+
+void co2_filter_set_scale(co2_filter_t *filter, float scale)
+{
+    // 2.0 in Q14 is 32768, times a 16-bit reading still fits 32 bits
+    if (scale < 0.5f) scale = 0.5f;
+    if (scale > 2.0f) scale = 2.0f;
+    filter->scale_q14 = (uint16_t)(scale * (1 << CO2_FILTER_SCALE_SHIFT) + 0.5f);
+}
+
+uint16_t co2_filter_scale(const co2_filter_t *filter, uint16_t ppm)
+{
+    uint32_t scaled = ((uint32_t)ppm * filter->scale_q14 + (1 << (CO2_FILTER_SCALE_SHIFT - 1))) >> CO2_FILTER_SCALE_SHIFT;
+
+    return scaled > UINT16_MAX ? UINT16_MAX : (uint16_t)scaled;
+}
+
+/**
+ * Median of the valid window entries, insertion sort of a copy.
+ * With an even count (window still filling) the upper middle is returned.
+ */
+static uint16_t co2_filter_median(const co2_filter_t *filter)
+{
+    uint16_t sorted[CO2_FILTER_MEDIAN_MAX];
+    uint16_t value;
+    uint8_t  i, j;
+
+    for (i = 0; i < filter->window_count; i++)
+    {
+        value = filter->window[i];
+        for (j = i; j > 0 && sorted[j - 1] > value; j--)
+        {
+            sorted[j] = sorted[j - 1];
+        }
+        sorted[j] = value;
+    }
+    return sorted[filter->window_count / 2];
+}
+
+uint16_t co2_filter_process(co2_filter_t *filter, uint16_t ppm, int16_t offset)
+{
+    int32_t  value = (int32_t)ppm + offset;
+    int32_t  delta;
+    uint16_t out;
+
+    if (value < 0) value = 0;
+    if (value > UINT16_MAX) value = UINT16_MAX;
+    filter->raw = (uint16_t)value;
+
+    // Median of N, rejects single sample spikes
+    filter->window[filter->window_idx] = filter->raw;
+    filter->window_idx                 = (filter->window_idx + 1) % filter->cfg.median_n;
+    if (filter->window_count < filter->cfg.median_n) filter->window_count += 1;
+    value = co2_filter_median(filter);
+
+    // EMA in Q8, shift 0 follows the input
+    if (!filter->primed)
+    {
+        filter->ema_q8 = value << 8;
+    }
+    else
+    {
+        filter->ema_q8 += ((value << 8) - filter->ema_q8) >> filter->cfg.ema_shift;
+    }
+    out = (uint16_t)((filter->ema_q8 + 128) >> 8);
+
+    // Slew rate limit against the previous output
+    if (filter->primed && filter->cfg.slew_ppm != 0)
+    {
+        delta = (int32_t)out - filter->filtered;
+        if (delta > filter->cfg.slew_ppm)
+        {
+            out = filter->filtered + filter->cfg.slew_ppm;
+        }
+        else if (delta < -(int32_t)filter->cfg.slew_ppm)
+        {
+            out = filter->filtered - filter->cfg.slew_ppm;
+        }
+    }
+
+    filter->filtered = out;
+    filter->primed   = true;
+    return out;
+}
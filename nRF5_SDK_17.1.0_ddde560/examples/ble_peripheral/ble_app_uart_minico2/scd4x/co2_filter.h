@@ -0,0 +1,96 @@
+#ifndef __CO2_FILTER_H__
+#define __CO2_FILTER_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * Integer processing pipeline of the CO2 readings.
+ * A sensor reading is scaled (Q14), offset by the CC value, then passes an
+ * optional median-of-N spike filter, EMA smoothing and slew rate limit. Every
+ * stage is fixed point with a bounded number of steps; the default
+ * configuration passes the scaled and offset reading through unchanged.
+ */
+
+/** Longest median window */
+#define CO2_FILTER_MEDIAN_MAX 5
+
+/** Largest EMA shift, alpha = 1 / 2^shift */
+#define CO2_FILTER_EMA_SHIFT_MAX 4
+
+/** Fraction bits of the scale factor */
+#define CO2_FILTER_SCALE_SHIFT 14
+
+/** Filter configuration */
+typedef struct
+{
+    uint8_t  median_n;  // median window, 1 (off), 3 or 5
+    uint8_t  ema_shift; // EMA alpha = 1 / 2^ema_shift, 0 (off) to CO2_FILTER_EMA_SHIFT_MAX
+    uint16_t slew_ppm;  // largest change of the output per sample, 0 (off)
+} co2_filter_cfg_t;
+
+/** Filter state */
+typedef struct
+{
+    co2_filter_cfg_t cfg;
+    uint16_t         scale_q14;                     // scale factor in Q14, 16384 = 1.0
+    uint16_t         window[CO2_FILTER_MEDIAN_MAX]; // last readings for the median, oldest is overwritten
+    uint8_t          window_count;                  // valid entries in window
+    uint8_t          window_idx;                    // next entry to write
+    int32_t          ema_q8;                        // EMA state in Q8 ppm
+    uint16_t         raw;                           // last reading after scale and offset
+    uint16_t         filtered;                      // last output
+    bool             primed;                        // EMA and slew limit have a previous output
+} co2_filter_t;
+
+/**
+ * @brief Initialize the filter as a pass-through with a scale factor of 1.0
+ *
+ * @param filter Filter
+ */
+void co2_filter_init(co2_filter_t *filter);
+
+/**
+ * @brief Drop the filter history, the next reading is passed through
+ *
+ * @param filter Filter
+ */
+void co2_filter_reset(co2_filter_t *filter);
+
+/**
+ * @brief Set the filter configuration, resets the history
+ *
+ * @param filter Filter
+ * @param cfg Configuration
+ * @return uint8_t 0 on success, 1 for an invalid configuration
+ */
+uint8_t co2_filter_configure(co2_filter_t *filter, const co2_filter_cfg_t *cfg);
+
+/**
+ * @brief Set the scale factor, converted once to Q14
+ *
+ * @param filter Filter
+ * @param scale Scale factor, 0.5 to 2.0
+ */
+void co2_filter_set_scale(co2_filter_t *filter, float scale);
+
+/**
+ * @brief Scale a sensor reading
+ *
+ * @param filter Filter
+ * @param ppm Sensor reading
+ * @return uint16_t Scaled reading, saturated to 65535
+ */
+uint16_t co2_filter_scale(const co2_filter_t *filter, uint16_t ppm);
+
+/**
+ * @brief Run a scaled reading through offset, median, EMA and slew limit
+ *
+ * @param filter Filter
+ * @param ppm Scaled reading
+ * @param offset Offset added before filtering (CC value)
+ * @return uint16_t Filtered reading
+ */
+uint16_t co2_filter_process(co2_filter_t *filter, uint16_t ppm, int16_t offset);
+
+#endif // __CO2_FILTER_H__
@@ -0,0 +1,155 @@
+#include "co2_predict.h"
+#include "log.h"
+
+typedef struct
+{
+    uint16_t ppm;
+    uint32_t time_s;
+} co2_predict_point_t;
+
+static co2_predict_cfg_t predict_cfg = {
+    .lead_min       = CO2_PREDICT_LEAD_MIN_DEF,
+    .confidence_pct = CO2_PREDICT_CONFIDENCE_PCT_DEF,
+};
+
+/** Readings, oldest first */
+static co2_predict_point_t points[CO2_PREDICT_POINTS];
+static uint8_t             point_count = 0;
+
+/** Fit result: trend value at the newest reading and slope in ppm per second */
+static float fit_ppm   = 0;
+static float fit_slope = 0;
+static bool  fit_valid = false;
+
+uint8_t co2_predict_configure(const co2_predict_cfg_t *cfg)
+{
+    if (cfg->confidence_pct > 100)
+    {
+        return 1;
+    }
+
+    predict_cfg = *cfg;
+    print("co2 predict: lead %d min, confidence %d%%\n", cfg->lead_min, cfg->confidence_pct);
+    return 0;
+}
+
+void co2_predict_get_config(co2_predict_cfg_t *cfg)
+{
+    *cfg = predict_cfg;
+}
+
+void co2_predict_reset(void)
+{
+    point_count = 0;
+    fit_valid   = false;
+}
+
+void co2_predict_add(uint16_t ppm, uint32_t time_s)
+{
+    uint8_t drop = 0;
+
+    // drop readings that are too old, the clock may also have been set back
+    while (drop < point_count &&
+           (time_s < points[drop].time_s || time_s - points[drop].time_s > CO2_PREDICT_MAX_AGE_S))
+    {
+        drop += 1;
+    }
+    if (drop > 0)
+    {
+        for (uint8_t i = drop; i < point_count; i++)
+        {
+            points[i - drop] = points[i];
+        }
+        point_count -= drop;
+    }
+
+    // keep the readings spread over the window, a fast reading replaces the newest one
+    if (point_count > 1 && time_s - points[point_count - 2].time_s < CO2_PREDICT_MIN_SPACING_S)
+    {
+        point_count -= 1;
+    }
+    else if (point_count == CO2_PREDICT_POINTS)
+    {
+        for (uint8_t i = 1; i < CO2_PREDICT_POINTS; i++)
+        {
+            points[i - 1] = points[i];
+        }
+        point_count -= 1;
+    }
+
+    points[point_count].ppm    = ppm;
+    points[point_count].time_s = time_s;
+    point_count += 1;
+}
+
+/**
+ * Least squares fit on values centered on the means, so single precision
+ * keeps the accuracy; R^2 = Sxy^2 / (Sxx * Syy).
+ */
+bool co2_predict_update(void)
+{
+    float   mean_x = 0, mean_y = 0;
+    float   sxx = 0, sxy = 0, syy = 0;
+    float   dx, dy;
+    uint8_t i;
+
+    fit_valid = false;
+    if (predict_cfg.lead_min == 0 || point_count < CO2_PREDICT_MIN_POINTS)
+    {
+        return false;
+    }
+
+    for (i = 0; i < point_count; i++)
+    {
+        mean_x += (float)(points[i].time_s - points[0].time_s);
+        mean_y += (float)points[i].ppm;
+    }
+    mean_x /= point_count;
+    mean_y /= point_count;
+
+    for (i = 0; i < point_count; i++)
+    {
+        dx = (float)(points[i].time_s - points[0].time_s) - mean_x;
+        dy = (float)points[i].ppm - mean_y;
+        sxx += dx * dx;
+        sxy += dx * dy;
+        syy += dy * dy;
+    }
+
+    if (sxx <= 0 || syy <= 0 || sxy <= 0)
+    {
+        return false; // flat or falling
+    }
+
+    fit_slope = sxy / sxx;
+    fit_ppm   = mean_y + fit_slope * ((float)(points[point_count - 1].time_s - points[0].time_s) - mean_x);
+
+    if (fit_slope * 3600 < CO2_PREDICT_MIN_SLOPE_PPM_H ||
+        fit_slope * (float)(points[point_count - 1].time_s - points[0].time_s) < CO2_PREDICT_MIN_RISE_PPM ||
+        sxy * sxy * 100 < (float)predict_cfg.confidence_pct * sxx * syy)
+    {
+        return false;
+    }
+
+    fit_valid = true;
+    dlog_d(CO2, "co2 predict: %d ppm, %d ppm/h, %d points\n", (int)fit_ppm, (int)(fit_slope * 3600), point_count);
+    return true;
+}
+
+uint32_t co2_predict_eta_s(uint16_t level)
+{
+    if (!fit_valid)
+    {
+        return UINT32_MAX;
+    }
+    if (fit_ppm >= level)
+    {
+        return 0;
+    }
+    return (uint32_t)(((float)level - fit_ppm) / fit_slope);
+}
+
+bool co2_predict_within_lead(uint16_t level)
+{
+    return co2_predict_eta_s(level) <= (uint32_t)predict_cfg.lead_min * 60;
+}
@@ -0,0 +1,88 @@
+#ifndef __CO2_PREDICT_H__
+#define __CO2_PREDICT_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * Trend prediction for the CO2 alarms.
+ * A least squares line is fitted to the recent readings; when the fit is good
+ * enough (coefficient of determination) and the line crosses an alarm level
+ * within the lead time, the alarm task raises an early alert.
+ */
+
+/** Readings kept for the fit */
+#define CO2_PREDICT_POINTS 8
+
+/** Fewest readings for a prediction */
+#define CO2_PREDICT_MIN_POINTS 4
+
+/** Shortest spacing of the readings, faster readings (HI mode) replace the newest one */
+#define CO2_PREDICT_MIN_SPACING_S 30
+
+/** Readings older than this are dropped */
+#define CO2_PREDICT_MAX_AGE_S (30 * 60)
+
+/** Slowest rise that is extrapolated, ppm per hour */
+#define CO2_PREDICT_MIN_SLOPE_PPM_H 30
+
+/** Smallest rise of the fitted line over the readings, sensor noise of a flat reading stays below it */
+#define CO2_PREDICT_MIN_RISE_PPM 30
+
+/** Default lead time and confidence */
+#define CO2_PREDICT_LEAD_MIN_DEF       10
+#define CO2_PREDICT_CONFIDENCE_PCT_DEF 80
+
+/** Predictor configuration */
+typedef struct
+{
+    uint8_t lead_min;       // alert when a level is reached within this many minutes, 0 disables prediction
+    uint8_t confidence_pct; // minimum R^2 of the fit in percent
+} co2_predict_cfg_t;
+
+/**
+ * @brief Set the configuration, not persisted
+ *
+ * @param cfg Configuration
+ * @return uint8_t 0 on success, 1 for an invalid configuration
+ */
+uint8_t co2_predict_configure(const co2_predict_cfg_t *cfg);
+
+/** Get the configuration */
+void co2_predict_get_config(co2_predict_cfg_t *cfg);
+
+/** Drop all readings */
+void co2_predict_reset(void);
+
+/**
+ * @brief Add a reading
+ *
+ * @param ppm CO2 value
+ * @param time_s Time of the reading in seconds
+ */
+void co2_predict_add(uint16_t ppm, uint32_t time_s);
+
+/**
+ * @brief Update the fit after readings were added
+ *
+ * @return true The trend is rising with the configured confidence
+ */
+bool co2_predict_update(void);
+
+/**
+ * @brief Seconds until the fitted trend reaches a level, valid after co2_predict_update() returned true
+ *
+ * @param level CO2 level
+ * @return uint32_t Seconds from the newest reading, 0 when the trend is already above, UINT32_MAX when not rising
+ */
+uint32_t co2_predict_eta_s(uint16_t level);
+
+/**
+ * @brief Check if a level is predicted to be reached within the lead time
+ *
+ * @param level CO2 level
+ * @return true The level is reached within the lead time
+ */
+bool co2_predict_within_lead(uint16_t level);
+
+#endif // __CO2_PREDICT_H__
@@ -1737,6 +1737,47 @@ uint8_t scd4x_measure_single_shot_rht_only(scd4x_handle_t *handle)
     return 0; /* success return 0 */
 }
 
+/**
+ * @brief     start a single shot measurement without waiting for it
+ * @param[in] *handle points to an scd4x handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start single shot failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 only scd41 has this function
+ * @note      the result is ready 5000ms later, poll the data ready status before reading
+ */
+uint8_t scd4x_start_single_shot(scd4x_handle_t *handle)
+{
+    uint8_t res;
+
+    if (handle == NULL) /* check handle */
+    {
+        return 2; /* return error */
+    }
+    if (handle->inited != 1) /* check handle initialization */
+    {
+        return 3; /* return error */
+    }
+    if (handle->type != SCD41) /* check type */
+    {
+        handle->debug_print("scd4x: only scd41 has this function.\n"); /* only scd41 has this function */
+
+        return 4; /* return error */
+    }
+
+    res = a_scd4x_iic_write(handle, SCD4X_COMMAND_MEASURE_SINGLE_SHOT, NULL, 0); /* write config */
+    if (res != 0)                                                                /* check result */
+    {
+        handle->debug_print("scd4x: start single shot failed.\n"); /* start single shot failed */
+
+        return 1; /* return error */
+    }
+
+    return 0; /* success return 0 */
+}
+
 /**
  * @brief     power down
  * @param[in] *handle points to an scd4x handle structure
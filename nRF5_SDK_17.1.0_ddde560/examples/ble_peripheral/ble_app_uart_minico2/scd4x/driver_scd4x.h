@@ -665,6 +665,19 @@ extern "C"
      */
     uint8_t scd4x_measure_single_shot_rht_only(scd4x_handle_t *handle);
 
+    /**
+     * @brief     start a single shot measurement without waiting for it
+     * @param[in] *handle points to an scd4x handle structure
+     * @return    status code
+     *            - 0 success
+     *            - 1 start single shot failed
+     *            - 2 handle is NULL
+     *            - 3 handle is not initialized
+     *            - 4 only scd41 has this function
+     * @note      the result is ready 5000ms later, poll the data ready status before reading
+     */
+    uint8_t scd4x_start_single_shot(scd4x_handle_t *handle);
+
     /**
      * @brief     power down
      * @param[in] *handle points to an scd4x handle structure
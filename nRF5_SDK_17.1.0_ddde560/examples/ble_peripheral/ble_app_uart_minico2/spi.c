@@ -8,6 +8,10 @@ static volatile bool         busy       = false;
 static volatile xfer_done_cb tx_done_cb = NULL;
 static volatile xfer_done_cb rx_done_cb = NULL;
 
+// Rest of a write longer than SPI_MAX_XFER, continued from the event handler
+static uint8_t *volatile tx_next = NULL;
+static volatile uint16_t tx_left = 0;
+
 static void spi_event_handler(nrf_drv_spi_evt_t const *p_event, void *p_context);
 
 /**
@@ -56,6 +60,20 @@ static void spi_event_handler(nrf_drv_spi_evt_t const *p_event, void *p_context)
 {
     if (p_event->type == NRF_DRV_SPI_EVENT_DONE)
     {
+        if (tx_left != 0)
+        {
+            uint8_t len = tx_left > SPI_MAX_XFER ? SPI_MAX_XFER : tx_left;
+
+            if (NRF_SUCCESS == nrf_drv_spi_transfer(&spi, tx_next, len, NULL, 0))
+            {
+                tx_next += len;
+                tx_left -= len;
+                return;
+            }
+            print("spi write %d bytes left failed\n", tx_left); // end the write, data is incomplete
+            tx_left = 0;
+        }
+
         busy = false;
 
         if (tx_done_cb != NULL)
@@ -85,6 +103,7 @@ uint8_t spi_read(uint8_t *data, uint8_t len, xfer_done_cb rx_cb, uint32_t timeou
 
     tx_done_cb = NULL;
     rx_done_cb = rx_cb;
+    tx_left    = 0;
     busy       = true;
     tick_from  = app_timer_cnt_get();
 
@@ -114,26 +133,31 @@ uint8_t spi_read(uint8_t *data, uint8_t len, xfer_done_cb rx_cb, uint32_t timeou
 /**
  * @brief SPI write
  *
- * @param data Buffer with data to send
- * @param len Length of data to send
+ * @param data Buffer with data to send, must be in RAM
+ * @param len Length of data to send, longer than SPI_MAX_XFER is sent in consecutive transfers
  * @param tx_cb Callback for write completion, NULL for blocking write
  * @param timeout_ms Timeout in milliseconds for blocking mode
  * @return uint8_t 1 if SPI is busy, 2 if SPI error, 3 if timeout, 0 if success
  */
-uint8_t spi_write(uint8_t *data, uint8_t len, xfer_done_cb tx_cb, uint32_t timeout_ms)
+uint8_t spi_write(uint8_t *data, uint16_t len, xfer_done_cb tx_cb, uint32_t timeout_ms)
 {
     uint32_t tick_from;
+    uint8_t  first = len > SPI_MAX_XFER ? SPI_MAX_XFER : len;
+
     if (busy) return 1;
 
     tx_done_cb = tx_cb;
     rx_done_cb = NULL;
+    tx_next    = data + first;
+    tx_left    = len - first;
     busy       = true;
     tick_from  = app_timer_cnt_get();
 
-    if (NRF_SUCCESS != nrf_drv_spi_transfer(&spi, data, len, NULL, 0))
+    if (NRF_SUCCESS != nrf_drv_spi_transfer(&spi, data, first, NULL, 0))
     {
         busy       = false;
         tx_done_cb = NULL;
+        tx_left    = 0;
         return 2;
     }
 
@@ -147,6 +171,7 @@ uint8_t spi_write(uint8_t *data, uint8_t len, xfer_done_cb tx_cb, uint32_t timeo
         {
             busy       = false;
             tx_done_cb = NULL;
+            tx_left    = 0;
             return 3;
         }
     }
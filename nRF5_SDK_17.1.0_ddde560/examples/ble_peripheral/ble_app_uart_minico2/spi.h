@@ -17,6 +17,9 @@ typedef enum
 
 typedef void (*xfer_done_cb)(void);
 
+/** Longest single EasyDMA transfer, MAXCNT of the nRF52832 SPIM is 8 bits */
+#define SPI_MAX_XFER 255
+
 /**
  * @brief Configure SPI interface
  *
@@ -38,13 +41,13 @@ uint8_t spi_read(uint8_t *data, uint8_t len, xfer_done_cb rx_cb, uint32_t timeou
 /**
  * @brief SPI write
  *
- * @param data Buffer with data to send
- * @param len Length of data to send
+ * @param data Buffer with data to send, must be in RAM
+ * @param len Length of data to send, longer than SPI_MAX_XFER is sent in consecutive transfers
  * @param tx_cb Callback for write completion, NULL for blocking write
  * @param timeout_ms Timeout in milliseconds for blocking mode
  * @return uint8_t 1 if SPI is busy, 2 if SPI error, 3 if timeout, 0 if success
  */
-uint8_t spi_write(uint8_t *data, uint8_t len, xfer_done_cb tx_cb, uint32_t timeout_ms);
+uint8_t spi_write(uint8_t *data, uint16_t len, xfer_done_cb tx_cb, uint32_t timeout_ms);
 
 /**
  * @brief Get SPI usage status
@@ -0,0 +1,13 @@
+#ifndef __SEGGER_RTT_H__
+#define __SEGGER_RTT_H__
+
+#include <stdarg.h>
+
+#define SEGGER_RTT_MODE_NO_BLOCK_SKIP 0
+
+int      SEGGER_RTT_ConfigUpBuffer(unsigned BufferIndex, const char *sName, void *pBuffer, unsigned BufferSize, unsigned Flags);
+unsigned SEGGER_RTT_Write(unsigned BufferIndex, const void *pBuffer, unsigned NumBytes);
+int      SEGGER_RTT_printf(unsigned BufferIndex, const char *sFormat, ...);
+int      SEGGER_RTT_vprintf(unsigned BufferIndex, const char *sFormat, va_list *pParamList);
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef __APP_PWM_H__
+#define __APP_PWM_H__
+
+#include "sdk_stub.h"
+
+typedef struct
+{
+    uint8_t timer_idx;
+} app_pwm_t;
+
+#define APP_PWM_INSTANCE(name, num) static app_pwm_t name = {.timer_idx = (num)}
+
+typedef enum
+{
+    APP_PWM_POLARITY_ACTIVE_LOW  = 0,
+    APP_PWM_POLARITY_ACTIVE_HIGH = 1,
+} app_pwm_polarity_t;
+
+typedef struct
+{
+    uint32_t           pins[2];
+    app_pwm_polarity_t pin_polarity[2];
+    uint32_t           num_of_channels;
+    uint32_t           period_us;
+} app_pwm_config_t;
+
+#define APP_PWM_DEFAULT_CONFIG_1CH(period_in_us, pin)                                  \
+    {                                                                                  \
+        .pins            = {(pin), 0xFFFFFFFF},                                        \
+        .pin_polarity    = {APP_PWM_POLARITY_ACTIVE_LOW, APP_PWM_POLARITY_ACTIVE_LOW}, \
+        .num_of_channels = 1,                                                          \
+        .period_us       = (period_in_us),                                             \
+    }
+
+typedef void (*app_pwm_callback_t)(uint32_t pwm_id);
+
+ret_code_t app_pwm_init(app_pwm_t const *p_instance, app_pwm_config_t const *p_config, app_pwm_callback_t p_ready_callback);
+void       app_pwm_enable(app_pwm_t const *p_instance);
+ret_code_t app_pwm_uninit(app_pwm_t const *p_instance);
+ret_code_t app_pwm_channel_duty_set(app_pwm_t const *p_instance, uint8_t channel, uint8_t duty);
+
+#endif
@@ -0,0 +1,13 @@
+#ifndef __APP_SCHEDULER_H__
+#define __APP_SCHEDULER_H__
+
+#include "sdk_stub.h"
+
+typedef void (*app_sched_event_handler_t)(void *p_event_data, uint16_t event_size);
+
+#define APP_SCHED_INIT(EVENT_SIZE, QUEUE_SIZE)
+
+ret_code_t app_sched_event_put(void const *p_event_data, uint16_t event_size, app_sched_event_handler_t handler);
+void       app_sched_execute(void);
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef __APP_TIMER_H__
+#define __APP_TIMER_H__
+
+#include "sdk_stub.h"
+
+#define APP_TIMER_CLOCK_FREQ           32768
+#define APP_TIMER_CONFIG_RTC_FREQUENCY 1 // same prescaler as sdk_config.h, 16384 Hz
+#define APP_TIMER_MAX_CNT_VAL          0x00FFFFFF
+
+#define APP_TIMER_TICKS(MS) ((uint32_t)ROUNDED_DIV((MS) * (uint64_t)APP_TIMER_CLOCK_FREQ, 1000 * (APP_TIMER_CONFIG_RTC_FREQUENCY + 1)))
+
+typedef void (*app_timer_timeout_handler_t)(void *p_context);
+
+typedef enum
+{
+    APP_TIMER_MODE_SINGLE_SHOT,
+    APP_TIMER_MODE_REPEATED
+} app_timer_mode_t;
+
+typedef struct app_timer_s
+{
+    app_timer_timeout_handler_t handler;
+    app_timer_mode_t            mode;
+    uint64_t                    expire_us; // 0 when stopped
+    uint64_t                    period_us;
+    void                       *p_context;
+    struct app_timer_s         *next; // all created timers
+} app_timer_t;
+
+typedef app_timer_t *app_timer_id_t;
+
+#define APP_TIMER_DEF(timer_id)                    \
+    static app_timer_t    timer_id##_data = {0};   \
+    static app_timer_id_t timer_id        = &timer_id##_data
+
+ret_code_t app_timer_init(void);
+ret_code_t app_timer_create(app_timer_id_t const *p_timer_id, app_timer_mode_t mode, app_timer_timeout_handler_t timeout_handler);
+ret_code_t app_timer_start(app_timer_id_t timer_id, uint32_t timeout_ticks, void *p_context);
+ret_code_t app_timer_stop(app_timer_id_t timer_id);
+ret_code_t app_timer_stop_all(void);
+uint32_t   app_timer_cnt_get(void);
+uint32_t   app_timer_cnt_diff_compute(uint32_t ticks_to, uint32_t ticks_from);
+
+#endif
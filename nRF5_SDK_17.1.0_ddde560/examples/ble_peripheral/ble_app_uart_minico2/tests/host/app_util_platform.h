@@ -0,0 +1,6 @@
+#ifndef __APP_UTIL_PLATFORM_H__
+#define __APP_UTIL_PLATFORM_H__
+
+#include "sdk_stub.h"
+
+#endif
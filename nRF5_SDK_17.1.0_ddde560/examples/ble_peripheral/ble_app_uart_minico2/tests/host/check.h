@@ -0,0 +1,44 @@
+#ifndef __CHECK_H__
+#define __CHECK_H__
+
+/**
+ * Assertions of the host tests: a failed check is printed with its location
+ * and counted, the test keeps going and returns check_failures() from main().
+ */
+
+#include <stdio.h>
+
+static int check_failed = 0;
+
+#define CHECK(cond, ...)                                                                  \
+    do                                                                                    \
+    {                                                                                     \
+        if (!(cond))                                                                      \
+        {                                                                                 \
+            check_failed++;                                                               \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed: ", __FILE__, __LINE__, #cond);      \
+            fprintf(stderr, __VA_ARGS__);                                                 \
+            fprintf(stderr, "\n");                                                        \
+        }                                                                                 \
+    } while (0)
+
+/** lo <= value <= hi, value is evaluated once */
+#define CHECK_RANGE(value, lo, hi)                                                        \
+    do                                                                                    \
+    {                                                                                     \
+        long long v_ = (long long)(value);                                                \
+        CHECK(v_ >= (long long)(lo) && v_ <= (long long)(hi), "%s = %lld, expected %lld..%lld", \
+              #value, v_, (long long)(lo), (long long)(hi));                              \
+    } while (0)
+
+/** Exit code of main() */
+static inline int check_failures(void)
+{
+    if (check_failed != 0)
+    {
+        fprintf(stderr, "%d check(s) failed\n", check_failed);
+    }
+    return check_failed != 0;
+}
+
+#endif // __CHECK_H__
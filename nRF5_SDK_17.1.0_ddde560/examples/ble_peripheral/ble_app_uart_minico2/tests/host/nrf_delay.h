@@ -0,0 +1,10 @@
+#ifndef __NRF_DELAY_H__
+#define __NRF_DELAY_H__
+
+#include "sdk_stub.h"
+
+/** Busy wait, interrupts (timers, peripheral events) still run while virtual time advances */
+void nrf_delay_ms(uint32_t ms);
+void nrf_delay_us(uint32_t us);
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef __NRF_DRV_GPIOTE_H__
+#define __NRF_DRV_GPIOTE_H__
+
+#include "nrf_gpio.h"
+
+typedef uint32_t nrfx_gpiote_pin_t;
+
+typedef enum
+{
+    NRF_GPIOTE_POLARITY_LOTOHI = 1,
+    NRF_GPIOTE_POLARITY_HITOLO = 2,
+    NRF_GPIOTE_POLARITY_TOGGLE = 3,
+} nrf_gpiote_polarity_t;
+
+typedef struct
+{
+    nrf_gpiote_polarity_t sense;
+    nrf_gpio_pin_pull_t   pull;
+    bool                  is_watcher;
+    bool                  hi_accuracy;
+    bool                  skip_gpio_setup;
+} nrf_drv_gpiote_in_config_t;
+
+typedef void (*nrfx_gpiote_evt_handler_t)(nrfx_gpiote_pin_t pin, nrf_gpiote_polarity_t action);
+
+uint32_t   nrfx_gpiote_init(void);
+void       nrfx_gpiote_uninit(void);
+ret_code_t nrf_drv_gpiote_in_init(nrfx_gpiote_pin_t pin, nrf_drv_gpiote_in_config_t const *p_config, nrfx_gpiote_evt_handler_t evt_handler);
+void       nrf_drv_gpiote_in_event_enable(nrfx_gpiote_pin_t pin, bool int_enable);
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef __NRF_DRV_SAADC_H__
+#define __NRF_DRV_SAADC_H__
+
+#include "sdk_stub.h"
+
+typedef int16_t nrf_saadc_value_t;
+
+typedef enum
+{
+    NRF_SAADC_INPUT_AIN4 = 5,
+} nrf_saadc_input_t;
+
+typedef enum
+{
+    NRF_SAADC_REFERENCE_INTERNAL = 0,
+    NRF_SAADC_REFERENCE_VDD4     = 1,
+} nrf_saadc_reference_t;
+
+typedef enum
+{
+    NRF_SAADC_GAIN1_6 = 0,
+    NRF_SAADC_GAIN1   = 5,
+} nrf_saadc_gain_t;
+
+typedef enum
+{
+    NRF_SAADC_ACQTIME_10US = 2,
+    NRF_SAADC_ACQTIME_40US = 5,
+} nrf_saadc_acqtime_t;
+
+typedef enum
+{
+    NRF_SAADC_MODE_SINGLE_ENDED = 0,
+    NRF_SAADC_MODE_DIFFERENTIAL = 1,
+} nrf_saadc_mode_t;
+
+typedef struct
+{
+    nrf_saadc_reference_t reference;
+    nrf_saadc_gain_t      gain;
+    nrf_saadc_acqtime_t   acq_time;
+    nrf_saadc_mode_t      mode;
+    nrf_saadc_input_t     pin_p;
+} nrf_saadc_channel_config_t;
+
+#define NRFX_SAADC_DEFAULT_CHANNEL_CONFIG_SE(PIN_P) \
+    {                                               \
+        .reference = NRF_SAADC_REFERENCE_INTERNAL,  \
+        .gain      = NRF_SAADC_GAIN1_6,             \
+        .acq_time  = NRF_SAADC_ACQTIME_10US,        \
+        .mode      = NRF_SAADC_MODE_SINGLE_ENDED,   \
+        .pin_p     = (PIN_P),                       \
+    }
+
+typedef struct
+{
+    int type;
+} nrfx_saadc_evt_t;
+
+typedef void (*nrf_drv_saadc_event_handler_t)(nrfx_saadc_evt_t const *p_event);
+
+ret_code_t nrf_drv_saadc_init(void const *p_config, nrf_drv_saadc_event_handler_t event_handler);
+ret_code_t nrfx_saadc_channel_init(uint8_t channel, nrf_saadc_channel_config_t const *p_config);
+ret_code_t nrfx_saadc_sample_convert(uint8_t channel, nrf_saadc_value_t *p_value);
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef __NRF_DRV_SPI_H__
+#define __NRF_DRV_SPI_H__
+
+#include "sdk_stub.h"
+
+typedef struct
+{
+    uint8_t inst_idx;
+} nrf_drv_spi_t;
+
+#define NRF_DRV_SPI_INSTANCE(id) {.inst_idx = (id)}
+
+#define NRF_DRV_SPI_PIN_NOT_USED 0xFF
+
+typedef enum
+{
+    NRF_DRV_SPI_FREQ_125K = 125000,
+    NRF_DRV_SPI_FREQ_1M   = 1000000,
+    NRF_DRV_SPI_FREQ_4M   = 4000000,
+    NRF_DRV_SPI_FREQ_8M   = 8000000,
+} nrf_drv_spi_frequency_t;
+
+typedef enum
+{
+    NRF_DRV_SPI_MODE_0,
+    NRF_DRV_SPI_MODE_1,
+    NRF_DRV_SPI_MODE_2,
+    NRF_DRV_SPI_MODE_3
+} nrf_drv_spi_mode_t;
+
+typedef enum
+{
+    NRF_DRV_SPI_BIT_ORDER_MSB_FIRST,
+    NRF_DRV_SPI_BIT_ORDER_LSB_FIRST
+} nrf_drv_spi_bit_order_t;
+
+typedef struct
+{
+    uint8_t                 sck_pin;
+    uint8_t                 mosi_pin;
+    uint8_t                 miso_pin;
+    uint8_t                 ss_pin;
+    uint8_t                 irq_priority;
+    uint8_t                 orc;
+    nrf_drv_spi_frequency_t frequency;
+    nrf_drv_spi_mode_t      mode;
+    nrf_drv_spi_bit_order_t bit_order;
+} nrf_drv_spi_config_t;
+
+#define NRF_DRV_SPI_DEFAULT_CONFIG                    \
+    {                                                 \
+        .sck_pin      = NRF_DRV_SPI_PIN_NOT_USED,     \
+        .mosi_pin     = NRF_DRV_SPI_PIN_NOT_USED,     \
+        .miso_pin     = NRF_DRV_SPI_PIN_NOT_USED,     \
+        .ss_pin       = NRF_DRV_SPI_PIN_NOT_USED,     \
+        .irq_priority = APP_IRQ_PRIORITY_LOWEST,      \
+        .orc          = 0xFF,                         \
+        .frequency    = NRF_DRV_SPI_FREQ_4M,          \
+        .mode         = NRF_DRV_SPI_MODE_0,           \
+        .bit_order    = NRF_DRV_SPI_BIT_ORDER_MSB_FIRST, \
+    }
+
+typedef enum
+{
+    NRF_DRV_SPI_EVENT_DONE,
+} nrf_drv_spi_evt_type_t;
+
+typedef struct
+{
+    nrf_drv_spi_evt_type_t type;
+} nrf_drv_spi_evt_t;
+
+typedef void (*nrf_drv_spi_evt_handler_t)(nrf_drv_spi_evt_t const *p_event, void *p_context);
+
+ret_code_t nrf_drv_spi_init(nrf_drv_spi_t const *p_instance, nrf_drv_spi_config_t const *p_config, nrf_drv_spi_evt_handler_t handler, void *p_context);
+void       nrf_drv_spi_uninit(nrf_drv_spi_t const *p_instance);
+ret_code_t nrf_drv_spi_transfer(nrf_drv_spi_t const *p_instance, uint8_t const *p_tx_buffer, uint8_t tx_buffer_length, uint8_t *p_rx_buffer, uint8_t rx_buffer_length);
+
+#endif
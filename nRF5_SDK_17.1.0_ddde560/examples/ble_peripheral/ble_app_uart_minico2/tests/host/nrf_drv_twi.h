@@ -0,0 +1,54 @@
+#ifndef __NRF_DRV_TWI_H__
+#define __NRF_DRV_TWI_H__
+
+#include "sdk_stub.h"
+
+typedef struct
+{
+    uint8_t inst_idx;
+} nrf_drv_twi_t;
+
+#define NRF_DRV_TWI_INSTANCE(id) {.inst_idx = (id)}
+
+typedef enum
+{
+    NRF_DRV_TWI_FREQ_100K = 100000,
+    NRF_DRV_TWI_FREQ_250K = 250000,
+    NRF_DRV_TWI_FREQ_400K = 400000,
+} nrf_drv_twi_frequency_t;
+
+typedef struct
+{
+    uint32_t                scl;
+    uint32_t                sda;
+    nrf_drv_twi_frequency_t frequency;
+    uint8_t                 interrupt_priority;
+    bool                    clear_bus_init;
+    bool                    hold_bus_uninit;
+} nrf_drv_twi_config_t;
+
+typedef enum
+{
+    NRF_DRV_TWI_EVT_DONE,
+    NRF_DRV_TWI_EVT_ADDRESS_NACK,
+    NRF_DRV_TWI_EVT_DATA_NACK,
+} nrf_drv_twi_evt_type_t;
+
+typedef struct
+{
+    nrf_drv_twi_evt_type_t type;
+} nrf_drv_twi_evt_t;
+
+typedef void (*nrf_drv_twi_evt_handler_t)(nrf_drv_twi_evt_t const *p_event, void *p_context);
+
+ret_code_t nrf_drv_twi_init(nrf_drv_twi_t const *p_instance, nrf_drv_twi_config_t const *p_config, nrf_drv_twi_evt_handler_t event_handler, void *p_context);
+void       nrf_drv_twi_uninit(nrf_drv_twi_t const *p_instance);
+void       nrf_drv_twi_enable(nrf_drv_twi_t const *p_instance);
+ret_code_t nrf_drv_twi_tx(nrf_drv_twi_t const *p_instance, uint8_t address, uint8_t const *p_data, uint8_t length, bool no_stop);
+ret_code_t nrf_drv_twi_rx(nrf_drv_twi_t const *p_instance, uint8_t address, uint8_t *p_data, uint8_t length);
+
+typedef uint32_t nrfx_err_t;
+
+nrfx_err_t nrfx_twim_bus_recover(uint32_t scl_pin, uint32_t sda_pin);
+
+#endif
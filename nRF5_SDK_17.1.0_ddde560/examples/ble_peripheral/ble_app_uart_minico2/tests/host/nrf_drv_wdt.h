@@ -0,0 +1,10 @@
+#ifndef __NRF_DRV_WDT_H__
+#define __NRF_DRV_WDT_H__
+
+#include "sdk_stub.h"
+
+typedef uint32_t nrf_drv_wdt_channel_id;
+
+void nrf_drv_wdt_channel_feed(nrf_drv_wdt_channel_id channel_id);
+
+#endif
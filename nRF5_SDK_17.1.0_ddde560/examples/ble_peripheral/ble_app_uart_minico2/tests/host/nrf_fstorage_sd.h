@@ -0,0 +1,8 @@
+#ifndef __NRF_FSTORAGE_SD_H__
+#define __NRF_FSTORAGE_SD_H__
+
+#include "nrf_fstorage.h"
+
+extern nrf_fstorage_api_t nrf_fstorage_sd;
+
+#endif
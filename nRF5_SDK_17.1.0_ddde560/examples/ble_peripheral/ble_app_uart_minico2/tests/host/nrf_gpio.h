@@ -0,0 +1,33 @@
+#ifndef __NRF_GPIO_H__
+#define __NRF_GPIO_H__
+
+#include "sdk_stub.h"
+
+#define NRF_GPIO_PIN_MAP(port, pin) (((port) << 5) | ((pin) & 0x1F))
+
+typedef enum
+{
+    NRF_GPIO_PIN_NOPULL   = 0,
+    NRF_GPIO_PIN_PULLDOWN = 1,
+    NRF_GPIO_PIN_PULLUP   = 3,
+} nrf_gpio_pin_pull_t;
+
+typedef enum
+{
+    NRF_GPIO_PIN_NOSENSE    = 0,
+    NRF_GPIO_PIN_SENSE_LOW  = 3,
+    NRF_GPIO_PIN_SENSE_HIGH = 2,
+} nrf_gpio_pin_sense_t;
+
+void     nrf_gpio_cfg_default(uint32_t pin);
+void     nrf_gpio_cfg_output(uint32_t pin);
+void     nrf_gpio_cfg_input(uint32_t pin, nrf_gpio_pin_pull_t pull);
+void     nrf_gpio_cfg_sense_input(uint32_t pin, nrf_gpio_pin_pull_t pull, nrf_gpio_pin_sense_t sense);
+void     nrf_gpio_cfg_sense_set(uint32_t pin, nrf_gpio_pin_sense_t sense);
+void     nrf_gpio_pin_set(uint32_t pin);
+void     nrf_gpio_pin_clear(uint32_t pin);
+void     nrf_gpio_pin_write(uint32_t pin, uint32_t value);
+void     nrf_gpio_pin_toggle(uint32_t pin);
+uint32_t nrf_gpio_pin_read(uint32_t pin);
+
+#endif
@@ -0,0 +1,8 @@
+#ifndef __NRF_STRERROR_H__
+#define __NRF_STRERROR_H__
+
+#include "sdk_stub.h"
+
+const char *nrf_strerror_get(ret_code_t code);
+
+#endif
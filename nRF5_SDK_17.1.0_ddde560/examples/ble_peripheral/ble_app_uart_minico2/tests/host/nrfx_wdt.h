@@ -0,0 +1,6 @@
+#ifndef __NRFX_WDT_H__
+#define __NRFX_WDT_H__
+
+#include "nrf_drv_wdt.h"
+
+#endif
@@ -0,0 +1,511 @@
+#include "scd4x_model.h"
+
+#include <string.h>
+
+#include "sim.h"
+
+#define MS(ms) ((uint64_t)(ms) * 1000)
+
+#define BOOT_MS         1000
+#define PERIODIC_MS     5000
+#define LOW_POWER_MS    30000
+#define SINGLE_SHOT_MS  5000
+
+// supply current in uA, see scd4x_model_charge_uas()
+#define IDLE_UA        200
+#define PERIODIC_UA    15000
+#define LOW_POWER_UA   3200
+#define SINGLE_SHOT_UA 15000
+#define EEPROM_UA      2000 // persist settings and factory reset, on top of idle (not in the datasheet, assumed)
+
+scd4x_model_stats_t scd4x_model_stats;
+
+static uint16_t co2_default(uint64_t t_us)
+{
+    (void)t_us;
+    return 600;
+}
+
+static int16_t temp_default(uint64_t t_us)
+{
+    (void)t_us;
+    return 2500;
+}
+
+static uint16_t rh_default(uint64_t t_us)
+{
+    (void)t_us;
+    return 5000;
+}
+
+uint16_t (*scd4x_model_co2)(uint64_t t_us)  = co2_default;
+int16_t (*scd4x_model_temp)(uint64_t t_us)  = temp_default;
+uint16_t (*scd4x_model_rh)(uint64_t t_us)   = rh_default;
+uint8_t scd4x_model_variant                 = 1;
+int16_t  scd4x_model_offset_ppm              = 0;
+uint16_t scd4x_model_noise_ppm               = 0;
+uint32_t scd4x_model_noise_seed              = 1;
+
+static const uint16_t serial[3]         = {0x1234, 0x5678, 0x9ABC};
+static const uint16_t serial_swapped[3] = {0x4321, 0x8765, 0xCBA9};
+
+static bool               powered;
+static scd4x_model_mode_t mode;
+static uint64_t           boot_until; // NACK until booted
+static uint64_t           busy_until; // NACK while a command executes
+static uint64_t           next_data;  // next measurement of the running mode
+static bool               data_ready;
+static uint16_t           co2_ppm;
+static uint16_t           temp_raw, rh_raw;
+
+// injected fault
+static scd4x_model_fault_t fault;
+static uint32_t            fault_count;
+static bool                sda_low;
+static bool                hung;
+static bool                swap_armed; // SWAPPED injected, taken at the next power up
+static bool                swapped;
+
+// acknowledged commands by code
+#define CMD_CODES_MAX 32
+static struct
+{
+    uint16_t cmd;
+    uint32_t count;
+} cmd_codes[CMD_CODES_MAX];
+
+// settings, RAM copy and EEPROM
+static bool     asc, asc_persisted;
+static uint16_t temp_offset, temp_offset_persisted;
+static uint16_t altitude, altitude_persisted;
+static uint16_t pressure;
+
+// supply charge, uA * us
+static uint64_t charge;
+static uint64_t charged_until;
+
+// response of the last command, read once
+static uint16_t resp[6];
+static uint8_t  resp_words;
+
+uint8_t scd4x_model_crc(const uint8_t *data)
+{
+    uint8_t crc = 0xFF;
+
+    for (int i = 0; i < 2; i++)
+    {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x31) : (uint8_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+static void update(void);
+
+static uint32_t mode_ua(void)
+{
+    switch (mode)
+    {
+    case SCD4X_MODEL_IDLE:
+        return IDLE_UA;
+    case SCD4X_MODEL_PERIODIC:
+        return PERIODIC_UA;
+    case SCD4X_MODEL_LOW_POWER_PERIODIC:
+        return LOW_POWER_UA;
+    case SCD4X_MODEL_SINGLE_SHOT:
+        return SINGLE_SHOT_UA;
+    default:
+        return 0;
+    }
+}
+
+/** Charge of the current mode up to t_us, call before every mode change */
+static void charge_until(uint64_t t_us)
+{
+    if (t_us <= charged_until) return;
+    charge += (uint64_t)mode_ua() * (t_us - charged_until);
+    charged_until = t_us;
+}
+
+static void settings_load(void)
+{
+    asc         = asc_persisted;
+    temp_offset = temp_offset_persisted;
+    altitude    = altitude_persisted;
+    pressure    = 1013;
+}
+
+static void factory_defaults(void)
+{
+    asc_persisted         = true;
+    temp_offset_persisted = 1498; // 4 degC
+    altitude_persisted    = 0;
+    settings_load();
+}
+
+void scd4x_model_reset(void)
+{
+    memset(&scd4x_model_stats, 0, sizeof(scd4x_model_stats));
+    memset(cmd_codes, 0, sizeof(cmd_codes));
+    charge        = 0;
+    charged_until = sim_now_us();
+    powered    = false;
+    mode       = SCD4X_MODEL_OFF;
+    data_ready = false;
+    resp_words = 0;
+    fault      = SCD4X_MODEL_FAULT_NONE;
+    sda_low    = false;
+    hung       = false;
+    swap_armed = false;
+    swapped    = false;
+    factory_defaults();
+}
+
+void scd4x_model_inject(scd4x_model_fault_t f, uint32_t count)
+{
+    // a swapped sensor combines with the other faults
+    swap_armed = f == SCD4X_MODEL_FAULT_SWAPPED || (swap_armed && f != SCD4X_MODEL_FAULT_NONE);
+    if (f == SCD4X_MODEL_FAULT_SWAPPED) return;
+
+    fault       = f;
+    fault_count = count;
+    sda_low     = f == SCD4X_MODEL_FAULT_SDA_LOW;
+    hung        = f == SCD4X_MODEL_FAULT_HANG;
+}
+
+scd4x_model_fault_t scd4x_model_fault(void)
+{
+    return fault;
+}
+
+/** Whether an injected fault applies to this transfer, counts it down */
+static bool fault_take(scd4x_model_fault_t f)
+{
+    if (fault != f || fault_count == 0) return false;
+
+    if (fault_count != SCD4X_MODEL_FAULT_FOREVER && --fault_count == 0)
+    {
+        fault = SCD4X_MODEL_FAULT_NONE;
+    }
+    scd4x_model_stats.faults++;
+    return true;
+}
+
+bool scd4x_model_bus_recover(void)
+{
+    scd4x_model_stats.bus_recovers++;
+    if (!sda_low) return true;
+
+    if (fault_count == 0)
+    {
+        sda_low = false;
+        fault   = SCD4X_MODEL_FAULT_NONE;
+        return true;
+    }
+    if (fault_count != SCD4X_MODEL_FAULT_FOREVER) fault_count--;
+    return false;
+}
+
+uint32_t scd4x_model_cmd_count(uint16_t cmd)
+{
+    for (int i = 0; i < CMD_CODES_MAX && cmd_codes[i].count != 0; i++)
+    {
+        if (cmd_codes[i].cmd == cmd) return cmd_codes[i].count;
+    }
+    return 0;
+}
+
+static void cmd_count_add(uint16_t cmd)
+{
+    for (int i = 0; i < CMD_CODES_MAX; i++)
+    {
+        if (cmd_codes[i].count == 0) cmd_codes[i].cmd = cmd;
+        if (cmd_codes[i].cmd == cmd)
+        {
+            cmd_codes[i].count++;
+            return;
+        }
+    }
+}
+
+void scd4x_model_power(bool on)
+{
+    if (on == powered) return;
+
+    update();
+    charge_until(sim_now_us());
+    powered = on;
+    sim_tl_add(SIM_TL_CO2_POWER, on, 0);
+    if (hung)
+    {
+        hung  = false;
+        fault = SCD4X_MODEL_FAULT_NONE;
+    }
+    if (on) swapped = swap_armed;
+    mode       = on ? SCD4X_MODEL_IDLE : SCD4X_MODEL_OFF;
+    boot_until = sim_now_us() + MS(BOOT_MS);
+    busy_until = 0;
+    data_ready = false;
+    resp_words = 0;
+    settings_load();
+}
+
+/** Sample the waveforms at a measurement */
+static void measure(uint64_t t_us)
+{
+    int32_t ppm = (int32_t)scd4x_model_co2(t_us) + scd4x_model_offset_ppm;
+
+    if (scd4x_model_noise_ppm != 0)
+    {
+        scd4x_model_noise_seed = scd4x_model_noise_seed * 1103515245 + 12345;
+        ppm += (int32_t)((scd4x_model_noise_seed >> 16) % (2u * scd4x_model_noise_ppm + 1)) - scd4x_model_noise_ppm;
+    }
+    co2_ppm  = (uint16_t)(ppm < 0 ? 0 : ppm > UINT16_MAX ? UINT16_MAX : ppm);
+    temp_raw = (uint16_t)(((int32_t)scd4x_model_temp(t_us) + 4500) * 65535 / 17500);
+    rh_raw   = (uint16_t)((uint32_t)scd4x_model_rh(t_us) * 65535 / 10000);
+}
+
+/** Measurements that completed up to now */
+static void update(void)
+{
+    uint64_t now = sim_now_us();
+    uint64_t period;
+
+    if (mode == SCD4X_MODEL_SINGLE_SHOT && now >= next_data)
+    {
+        charge_until(next_data);
+        measure(next_data);
+        data_ready = true;
+        mode       = SCD4X_MODEL_IDLE;
+        scd4x_model_stats.measurements++;
+        return;
+    }
+    if (mode != SCD4X_MODEL_PERIODIC && mode != SCD4X_MODEL_LOW_POWER_PERIODIC) return;
+
+    period = MS(mode == SCD4X_MODEL_PERIODIC ? PERIODIC_MS : LOW_POWER_MS);
+    while (now >= next_data)
+    {
+        measure(next_data);
+        data_ready = true;
+        next_data += period;
+        scd4x_model_stats.measurements++;
+    }
+}
+
+scd4x_model_mode_t scd4x_model_mode(void)
+{
+    update();
+    return mode;
+}
+
+double scd4x_model_charge_uas(void)
+{
+    update();
+    charge_until(sim_now_us());
+    return charge / 1e6;
+}
+
+/** Command accepted: busy for its execution time, then words can be read */
+static void respond(uint32_t exec_ms, uint8_t words)
+{
+    busy_until = sim_now_us() + MS(exec_ms);
+    resp_words = words;
+}
+
+/** Command accepted that draws extra_ua on top of the mode for its execution time */
+static void respond_charged(uint32_t exec_ms, uint8_t words, uint32_t extra_ua)
+{
+    charge += (uint64_t)extra_ua * MS(exec_ms);
+    respond(exec_ms, words);
+}
+
+/** Execute a command with its parameter words, returns false for a NACK */
+static bool execute(uint16_t cmd, const uint16_t *param, uint8_t params)
+{
+    uint64_t now = sim_now_us();
+
+    update();
+    charge_until(now);
+    switch (cmd)
+    {
+    case 0x21B1: // start periodic measurement
+    case 0x21AC: // start low power periodic measurement
+        if (mode != SCD4X_MODEL_IDLE) return false;
+        mode       = cmd == 0x21B1 ? SCD4X_MODEL_PERIODIC : SCD4X_MODEL_LOW_POWER_PERIODIC;
+        next_data  = now + MS(cmd == 0x21B1 ? PERIODIC_MS : LOW_POWER_MS);
+        data_ready = false;
+        respond(0, 0);
+        return true;
+    case 0x219D: // measure single shot, SCD41 only
+        if (mode != SCD4X_MODEL_IDLE || scd4x_model_variant != 1) return false;
+        mode       = SCD4X_MODEL_SINGLE_SHOT;
+        next_data  = now + MS(SINGLE_SHOT_MS);
+        data_ready = false;
+        respond(0, 0);
+        return true;
+    case 0x3F86: // stop periodic measurement
+        mode = SCD4X_MODEL_IDLE;
+        respond(500, 0);
+        return true;
+    case 0xE4B8: // get data ready status
+        resp[0] = data_ready && !fault_take(SCD4X_MODEL_FAULT_NOT_READY) ? 0x8006 : 0x8000;
+        respond(1, 1);
+        return true;
+    case 0xEC05: // read measurement
+        resp[0]    = co2_ppm;
+        resp[1]    = temp_raw;
+        resp[2]    = rh_raw;
+        resp[3]    = fault_take(SCD4X_MODEL_FAULT_STATUS) ? 0x0001 : 0; // status
+        resp[4]    = 0;                                                 // ASC count
+        resp[5]    = 0x8000;
+        data_ready = false;
+        scd4x_model_stats.reads++;
+        sim_tl_add(SIM_TL_CO2_SAMPLE, co2_ppm, 0);
+        respond(1, 6);
+        return true;
+    case 0xE000: // get or set ambient pressure, also while measuring
+        if (params == 1) pressure = param[0];
+        resp[0] = pressure;
+        respond(1, params == 0);
+        return true;
+    default:
+        break;
+    }
+
+    // everything else is only accepted in idle
+    if (mode != SCD4X_MODEL_IDLE) return false;
+
+    switch (cmd)
+    {
+    case 0x2416: // set automatic self calibration enabled
+        if (params != 1) return false;
+        asc = param[0] != 0;
+        respond(1, 0);
+        return true;
+    case 0x2313:
+        resp[0] = asc;
+        respond(1, 1);
+        return true;
+    case 0x241D:
+        if (params != 1) return false;
+        temp_offset = param[0];
+        respond(1, 0);
+        return true;
+    case 0x2318:
+        resp[0] = temp_offset;
+        respond(1, 1);
+        return true;
+    case 0x2427:
+        if (params != 1) return false;
+        altitude = param[0];
+        respond(1, 0);
+        return true;
+    case 0x2322:
+        resp[0] = altitude;
+        respond(1, 1);
+        return true;
+    case 0x3682: // get serial number
+        memcpy(resp, swapped ? serial_swapped : serial, sizeof(serial));
+        respond(1, 3);
+        return true;
+    case 0x202F: // get sensor variant
+        resp[0] = scd4x_model_variant == 1 ? 0x1440 : 0x0440;
+        respond(1, 1);
+        return true;
+    case 0x3615: // persist settings
+        asc_persisted         = asc;
+        temp_offset_persisted = temp_offset;
+        altitude_persisted    = altitude;
+        respond_charged(800, 0, EEPROM_UA);
+        return true;
+    case 0x3632: // perform factory reset
+        factory_defaults();
+        respond_charged(1200, 0, EEPROM_UA);
+        return true;
+    case 0x3646: // reinit
+        settings_load();
+        respond(30, 0);
+        return true;
+    case 0x3639: // perform self test, a measurement
+        resp[0] = 0;
+        respond_charged(10000, 1, PERIODIC_UA - IDLE_UA);
+        return true;
+    default:
+        return false;
+    }
+}
+
+/** Whether the address is acknowledged, counts the reason when it is not */
+static bool addressed(uint8_t addr)
+{
+    uint64_t now = sim_now_us();
+
+    if (addr != SCD4X_MODEL_ADDR || !powered || hung || sda_low) return false;
+    if (now < boot_until || now < busy_until)
+    {
+        scd4x_model_stats.early++;
+        return false;
+    }
+    return !fault_take(SCD4X_MODEL_FAULT_NACK);
+}
+
+bool scd4x_model_write(uint8_t addr, const uint8_t *data, uint8_t len)
+{
+    uint16_t cmd;
+    uint16_t param[4];
+    uint8_t  params = 0;
+    bool     ack;
+
+    if (!addressed(addr) || len < 2)
+    {
+        scd4x_model_stats.nacks++;
+        return false;
+    }
+
+    cmd = (uint16_t)(data[0] << 8 | data[1]);
+    ack = (len - 2) % 3 == 0 && (len - 2) / 3 <= 4;
+    for (uint8_t i = 2; ack && i + 3 <= len; i += 3)
+    {
+        ack             = scd4x_model_crc(&data[i]) == data[i + 2];
+        param[params++] = (uint16_t)(data[i] << 8 | data[i + 1]);
+        if (!ack) scd4x_model_stats.crc_errors++;
+    }
+    resp_words = 0;
+    ack        = ack && execute(cmd, param, params);
+
+    sim_tl_add(SIM_TL_CO2_CMD, cmd, !ack);
+    if (ack)
+    {
+        scd4x_model_stats.commands++;
+        cmd_count_add(cmd);
+    }
+    else
+    {
+        scd4x_model_stats.nacks++;
+    }
+    return ack;
+}
+
+bool scd4x_model_read(uint8_t addr, uint8_t *data, uint8_t len)
+{
+    if (!addressed(addr) || resp_words == 0)
+    {
+        scd4x_model_stats.nacks++;
+        return false;
+    }
+
+    memset(data, 0xFF, len);
+    for (uint8_t i = 0; i < resp_words && i * 3 + 2 < len; i++)
+    {
+        data[i * 3]     = (uint8_t)(resp[i] >> 8);
+        data[i * 3 + 1] = (uint8_t)resp[i];
+        data[i * 3 + 2] = scd4x_model_crc(&data[i * 3]);
+    }
+    // a flipped data bit the CRC must catch
+    if (len >= 3 && fault_take(SCD4X_MODEL_FAULT_CRC)) data[1] ^= 0x01;
+    resp_words = 0;
+    return true;
+}
@@ -0,0 +1,122 @@
+#ifndef __SCD4X_MODEL_H__
+#define __SCD4X_MODEL_H__
+
+/**
+ * SCD4x model: the I2C command interface of an SCD41 as seen by co2.c and the
+ * scd4x driver.
+ *
+ * The sensor NACKs until 1000 ms after power up and while a command executes,
+ * so a read issued before the datasheet execution time fails like on the
+ * bench. Periodic, low power periodic and single shot measurements set data
+ * ready at their datasheet intervals; read measurement returns the six words
+ * co2.c expects (CO2, T, RH, status, ASC count, ASC correction) from the
+ * waveforms below, with the offset and noise of the sensor if set.
+ *
+ * Faults are injected with scd4x_model_inject() to drive the error handling
+ * and the staged recovery of co2.c.
+ *
+ * The supply charge is integrated from the current of the measurement mode
+ * and of the command executing, see scd4x_model_charge_uas().
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SCD4X_MODEL_ADDR 0x62
+
+typedef enum
+{
+    SCD4X_MODEL_OFF = 0,
+    SCD4X_MODEL_IDLE,
+    SCD4X_MODEL_PERIODIC,
+    SCD4X_MODEL_LOW_POWER_PERIODIC,
+    SCD4X_MODEL_SINGLE_SHOT,
+} scd4x_model_mode_t;
+
+typedef enum
+{
+    SCD4X_MODEL_FAULT_NONE = 0,
+    SCD4X_MODEL_FAULT_NACK,      // writes and reads are not acknowledged, count transfers
+    SCD4X_MODEL_FAULT_CRC,       // the first word of a response has a wrong CRC, count responses
+    SCD4X_MODEL_FAULT_NOT_READY, // get data ready status reports no data, count polls
+    SCD4X_MODEL_FAULT_STATUS,    // read measurement returns a non-zero status word, count reads
+    SCD4X_MODEL_FAULT_SDA_LOW,   // SDA held low, every transfer fails; count bus recoveries fail before it is released
+    SCD4X_MODEL_FAULT_HANG,      // the firmware hangs, nothing is acknowledged until the supply is cycled
+    SCD4X_MODEL_FAULT_SWAPPED,   // another serial number from the next power up on, combines with the other
+                                 // faults and is cleared with SCD4X_MODEL_FAULT_NONE
+} scd4x_model_fault_t;
+
+/** Count of scd4x_model_inject() for a fault that stays until it is cleared */
+#define SCD4X_MODEL_FAULT_FOREVER UINT32_MAX
+
+typedef struct
+{
+    uint32_t commands;     // commands acknowledged
+    uint32_t nacks;        // writes and reads not acknowledged, for any reason
+    uint32_t early;        // of those, sent before power up completed or while a command executed
+    uint32_t crc_errors;   // parameter words with a wrong CRC
+    uint32_t measurements; // measurements completed
+    uint32_t reads;        // read measurement answered
+    uint32_t faults;       // transfers an injected fault applied to
+    uint32_t bus_recovers; // bus recoveries, successful or not
+} scd4x_model_stats_t;
+
+extern scd4x_model_stats_t scd4x_model_stats;
+
+/** CO2 concentration seen by the sensor at a virtual time, 600 ppm by default */
+extern uint16_t (*scd4x_model_co2)(uint64_t t_us);
+
+/**
+ * Sensor error on top of scd4x_model_co2: a fixed offset and uniform noise of
+ * +-noise ppm per measurement, drawn from a sequence seeded with noise_seed.
+ * Off by default, kept across scd4x_model_reset().
+ */
+extern int16_t  scd4x_model_offset_ppm;
+extern uint16_t scd4x_model_noise_ppm;
+extern uint32_t scd4x_model_noise_seed;
+
+/** Temperature in 0.01 degC and relative humidity in 0.01 %RH, 25 degC and 50 %RH by default */
+extern int16_t (*scd4x_model_temp)(uint64_t t_us);
+extern uint16_t (*scd4x_model_rh)(uint64_t t_us);
+
+/** 0 = SCD40, 1 = SCD41 */
+extern uint8_t scd4x_model_variant;
+
+/** Back to the power-on defaults, statistics cleared */
+void scd4x_model_reset(void);
+
+/** Supply switched */
+void scd4x_model_power(bool on);
+
+scd4x_model_mode_t scd4x_model_mode(void);
+
+/** I2C write to addr, returns false when not acknowledged */
+bool scd4x_model_write(uint8_t addr, const uint8_t *data, uint8_t len);
+
+/** I2C read from addr, returns false when not acknowledged */
+bool scd4x_model_read(uint8_t addr, uint8_t *data, uint8_t len);
+
+/** Inject a fault, SCD4X_MODEL_FAULT_NONE clears it; count is described with each fault */
+void scd4x_model_inject(scd4x_model_fault_t fault, uint32_t count);
+
+/** Transfer fault still in effect */
+scd4x_model_fault_t scd4x_model_fault(void);
+
+/** Nine SCL pulses and a stop condition, returns false while SDA stays low */
+bool scd4x_model_bus_recover(void);
+
+/**
+ * Supply charge since the last reset in uA * s. Datasheet typical averages at
+ * 3.3 V: 200 uA idle, 15 mA periodic, 3.2 mA low power periodic, 15 mA for the
+ * 5 s of a single shot; self test, persist and factory reset add their current
+ * for their execution time.
+ */
+double scd4x_model_charge_uas(void);
+
+/** Acknowledged commands with this code since the last reset */
+uint32_t scd4x_model_cmd_count(uint16_t cmd);
+
+/** Sensirion CRC-8 of a word */
+uint8_t scd4x_model_crc(const uint8_t *data);
+
+#endif // __SCD4X_MODEL_H__
@@ -0,0 +1,694 @@
+#include "sim.h"
+
+#include <stdarg.h>
+#include <stdlib.h>
+
+#include "SEGGER_RTT.h"
+#include "app_pwm.h"
+#include "app_scheduler.h"
+#include "custom_board.h"
+#include "nrf_delay.h"
+#include "nrf_drv_gpiote.h"
+#include "nrf_drv_saadc.h"
+#include "nrf_drv_spi.h"
+#include "nrf_drv_twi.h"
+#include "nrf_drv_wdt.h"
+#include "nrf_fstorage_sd.h"
+#include "nrf_strerror.h"
+#include "scd4x_model.h"
+#include "st7301_model.h"
+#include "zb25d16_model.h"
+
+/**
+ * Peripheral drivers of the SDK on top of the board: GPIO levels wired to the
+ * models, SPIM and TWIM with bus timing, and the smaller services (SAADC,
+ * GPIOTE, fstorage, scheduler, PWM, WDT, RTT).
+ */
+
+sim_spi_stats_t sim_spi_stats;
+sim_twi_stats_t sim_twi_stats;
+uint32_t        sim_wdt_max_gap_ms;
+uint32_t        sim_dlog_bytes;
+
+/** GPIO ***************************************************************** */
+
+#define PIN_COUNT 32
+
+static bool pin_out[PIN_COUNT]; // OUT register
+static bool pin_dir[PIN_COUNT]; // configured as output
+static bool pin_in[PIN_COUNT];  // level driven by the board
+
+/** A board signal changed, forward it to the models */
+static void pin_changed(uint32_t pin)
+{
+    bool level = pin_out[pin];
+
+    switch (pin)
+    {
+    case PIN_FLASH_CS:
+        if (pin_dir[pin] && !level) sim_spi_stats.flash_cs_toggles++;
+        zb25d16_model_cs(!pin_dir[pin] || level);
+        break;
+    case PIN_CO2_PWR:
+        scd4x_model_power(pin_dir[pin] && level);
+        break;
+    case PIN_LCD_PWR: // P-FET, on while driven low
+        st7301_model_power(pin_dir[pin] && !level);
+        break;
+    case PIN_LCD_RST:
+        st7301_model_reset_pin(!pin_dir[pin] || level);
+        break;
+    case PIN_VIBRATOR:
+        sim_tl_add(SIM_TL_VIBRATOR, pin_dir[pin] && level, 0);
+        break;
+    default:
+        break;
+    }
+}
+
+static void pin_write(uint32_t pin, bool level)
+{
+    if (pin >= PIN_COUNT) return;
+    if (pin_out[pin] == level) return;
+    pin_out[pin] = level;
+    if (pin_dir[pin]) pin_changed(pin);
+}
+
+static void pin_dir_set(uint32_t pin, bool output)
+{
+    if (pin >= PIN_COUNT || pin_dir[pin] == output) return;
+    pin_dir[pin] = output;
+    pin_changed(pin);
+}
+
+void nrf_gpio_cfg_default(uint32_t pin)
+{
+    pin_dir_set(pin, false);
+}
+
+void nrf_gpio_cfg_output(uint32_t pin)
+{
+    pin_dir_set(pin, true);
+}
+
+void nrf_gpio_cfg_input(uint32_t pin, nrf_gpio_pin_pull_t pull)
+{
+    (void)pull;
+    pin_dir_set(pin, false);
+}
+
+void nrf_gpio_cfg_sense_input(uint32_t pin, nrf_gpio_pin_pull_t pull, nrf_gpio_pin_sense_t sense)
+{
+    (void)sense;
+    nrf_gpio_cfg_input(pin, pull);
+}
+
+void nrf_gpio_cfg_sense_set(uint32_t pin, nrf_gpio_pin_sense_t sense)
+{
+    (void)pin;
+    (void)sense;
+}
+
+void nrf_gpio_pin_set(uint32_t pin)
+{
+    pin_write(pin, true);
+}
+
+void nrf_gpio_pin_clear(uint32_t pin)
+{
+    pin_write(pin, false);
+}
+
+void nrf_gpio_pin_write(uint32_t pin, uint32_t value)
+{
+    pin_write(pin, value != 0);
+}
+
+void nrf_gpio_pin_toggle(uint32_t pin)
+{
+    if (pin < PIN_COUNT) pin_write(pin, !pin_out[pin]);
+}
+
+uint32_t nrf_gpio_pin_read(uint32_t pin)
+{
+    if (pin >= PIN_COUNT) return 0;
+    return pin_dir[pin] ? pin_out[pin] : pin_in[pin];
+}
+
+bool sim_gpio_output(uint32_t pin)
+{
+    return pin < PIN_COUNT && pin_dir[pin] && pin_out[pin];
+}
+
+/** GPIOTE *************************************************************** */
+
+static nrfx_gpiote_evt_handler_t gpiote_handler[PIN_COUNT];
+static nrf_gpiote_polarity_t     gpiote_sense[PIN_COUNT];
+static bool                      gpiote_enabled[PIN_COUNT];
+
+uint32_t nrfx_gpiote_init(void)
+{
+    return NRF_SUCCESS;
+}
+
+void nrfx_gpiote_uninit(void)
+{
+    memset(gpiote_handler, 0, sizeof(gpiote_handler));
+    memset(gpiote_enabled, 0, sizeof(gpiote_enabled));
+}
+
+ret_code_t nrf_drv_gpiote_in_init(nrfx_gpiote_pin_t pin, nrf_drv_gpiote_in_config_t const *p_config, nrfx_gpiote_evt_handler_t evt_handler)
+{
+    if (pin >= PIN_COUNT) return NRF_ERROR_INVALID_PARAM;
+    gpiote_handler[pin] = evt_handler;
+    gpiote_sense[pin]   = p_config->sense;
+    return NRF_SUCCESS;
+}
+
+void nrf_drv_gpiote_in_event_enable(nrfx_gpiote_pin_t pin, bool int_enable)
+{
+    if (pin < PIN_COUNT) gpiote_enabled[pin] = int_enable;
+}
+
+static void gpiote_event(void *ctx)
+{
+    uint32_t pin = (uint32_t)(uintptr_t)ctx;
+
+    if (gpiote_enabled[pin] && gpiote_handler[pin] != NULL)
+    {
+        gpiote_handler[pin](pin, pin_in[pin] ? NRF_GPIOTE_POLARITY_LOTOHI : NRF_GPIOTE_POLARITY_HITOLO);
+    }
+}
+
+void sim_gpio_input(uint32_t pin, bool level)
+{
+    nrf_gpiote_polarity_t edge = level ? NRF_GPIOTE_POLARITY_LOTOHI : NRF_GPIOTE_POLARITY_HITOLO;
+
+    if (pin >= PIN_COUNT || pin_in[pin] == level) return;
+    pin_in[pin] = level;
+    if (gpiote_sense[pin] & edge)
+    {
+        sim_schedule(sim_now_us(), gpiote_event, (void *)(uintptr_t)pin, SIM_TAG_GPIOTE);
+    }
+}
+
+static void key_release(void *ctx)
+{
+    (void)ctx;
+    sim_gpio_input(PIN_KEY, true);
+}
+
+void sim_press_key(uint32_t ms)
+{
+    sim_gpio_input(PIN_KEY, false);
+    sim_schedule(sim_now_us() + (uint64_t)ms * 1000, key_release, NULL, SIM_TAG_TEST);
+}
+
+/** SPIM ***************************************************************** */
+
+#define SPI_BUF_MAX 255
+
+static struct
+{
+    bool                      inited;
+    nrf_drv_spi_config_t      config;
+    nrf_drv_spi_evt_handler_t handler;
+    bool                      busy;
+    const uint8_t            *tx;
+    uint8_t                   tx_len;
+    uint8_t                   tx_copy[SPI_BUF_MAX];
+    uint8_t                  *rx;
+    uint8_t                   rx_len;
+    bool                      dc; // LCD DC level sampled at the start
+} spim;
+
+ret_code_t nrf_drv_spi_init(nrf_drv_spi_t const *p_instance, nrf_drv_spi_config_t const *p_config, nrf_drv_spi_evt_handler_t handler, void *p_context)
+{
+    (void)p_instance;
+    (void)p_context;
+    if (spim.inited) return NRF_ERROR_INVALID_STATE;
+    spim.inited  = true;
+    spim.config  = *p_config;
+    spim.handler = handler;
+    spim.busy    = false;
+    return NRF_SUCCESS;
+}
+
+void nrf_drv_spi_uninit(nrf_drv_spi_t const *p_instance)
+{
+    (void)p_instance;
+    sim_cancel(SIM_TAG_SPI);
+    spim.inited = false;
+    spim.busy   = false;
+}
+
+static void spi_done(void *ctx)
+{
+    nrf_drv_spi_evt_t evt = {.type = NRF_DRV_SPI_EVENT_DONE};
+    uint8_t           len = spim.tx_len > spim.rx_len ? spim.tx_len : spim.rx_len;
+    uint64_t          t0;
+    uint64_t          dt;
+
+    (void)ctx;
+    if (spim.tx_len != 0 && memcmp(spim.tx_copy, spim.tx, spim.tx_len) != 0)
+    {
+        sim_spi_stats.dma_overwrites++;
+    }
+
+    // the bytes reach the device as they were when the transfer started
+    if (spim.config.ss_pin == PIN_LCD_CS)
+    {
+        st7301_model_cs_begin();
+        for (uint8_t i = 0; i < spim.tx_len; i++)
+        {
+            st7301_model_write(spim.tx_copy[i], spim.dc);
+        }
+        st7301_model_cs_end();
+    }
+    else
+    {
+        for (uint8_t i = 0; i < len; i++)
+        {
+            uint8_t miso = zb25d16_model_xfer(i < spim.tx_len ? spim.tx_copy[i] : spim.config.orc);
+            if (i < spim.rx_len) spim.rx[i] = miso;
+        }
+    }
+
+    spim.busy = false;
+    if (spim.handler == NULL) return;
+
+    t0 = sim_host_ns();
+    spim.handler(&evt, NULL);
+    dt = sim_host_ns() - t0;
+    sim_spi_stats.isr_total_ns += dt;
+    if (dt > sim_spi_stats.isr_max_ns) sim_spi_stats.isr_max_ns = dt;
+}
+
+ret_code_t nrf_drv_spi_transfer(nrf_drv_spi_t const *p_instance, uint8_t const *p_tx_buffer, uint8_t tx_buffer_length, uint8_t *p_rx_buffer, uint8_t rx_buffer_length)
+{
+    uint8_t  len = tx_buffer_length > rx_buffer_length ? tx_buffer_length : rx_buffer_length;
+    uint64_t us;
+
+    (void)p_instance;
+    if (!spim.inited) return NRF_ERROR_INVALID_STATE;
+    if (spim.busy)
+    {
+        sim_spi_stats.busy_rejects++;
+        return NRF_ERROR_BUSY;
+    }
+
+    spim.busy   = true;
+    spim.tx     = p_tx_buffer;
+    spim.tx_len = p_tx_buffer != NULL ? tx_buffer_length : 0;
+    spim.rx     = p_rx_buffer;
+    spim.rx_len = p_rx_buffer != NULL ? rx_buffer_length : 0;
+    spim.dc     = nrf_gpio_pin_read(PIN_LCD_CD) != 0;
+    if (spim.tx_len != 0) memcpy(spim.tx_copy, p_tx_buffer, spim.tx_len);
+
+    us = ((uint64_t)len * 8 * 1000000 + spim.config.frequency - 1) / spim.config.frequency;
+    sim_spi_stats.transfers++;
+    sim_spi_stats.tx_bytes += spim.tx_len;
+    sim_spi_stats.rx_bytes += spim.rx_len;
+    sim_spi_stats.bus_us += us;
+    if (spim.config.ss_pin == PIN_LCD_CS) sim_spi_stats.lcd_cs_toggles++;
+
+    // a blocking driver call completes in place, the event handler only runs when there is one
+    sim_schedule(sim_now_us() + us, spi_done, NULL, SIM_TAG_SPI);
+    return NRF_SUCCESS;
+}
+
+/** TWIM ***************************************************************** */
+
+#define TWI_BUF_MAX 32
+
+static struct
+{
+    bool                      inited;
+    nrf_drv_twi_evt_handler_t handler;
+    uint32_t                  frequency;
+    bool                      busy;
+    uint8_t                   addr;
+    uint8_t                   tx[TWI_BUF_MAX];
+    uint8_t                  *rx;
+    uint8_t                   len;
+    bool                      ack;
+} twim;
+
+ret_code_t nrf_drv_twi_init(nrf_drv_twi_t const *p_instance, nrf_drv_twi_config_t const *p_config, nrf_drv_twi_evt_handler_t event_handler, void *p_context)
+{
+    (void)p_instance;
+    (void)p_context;
+    if (twim.inited) return NRF_ERROR_INVALID_STATE;
+    twim.inited    = true;
+    twim.handler   = event_handler;
+    twim.frequency = p_config->frequency;
+    twim.busy      = false;
+    return NRF_SUCCESS;
+}
+
+void nrf_drv_twi_uninit(nrf_drv_twi_t const *p_instance)
+{
+    (void)p_instance;
+    sim_cancel(SIM_TAG_TWI);
+    twim.inited = false;
+    twim.busy   = false;
+}
+
+void nrf_drv_twi_enable(nrf_drv_twi_t const *p_instance)
+{
+    (void)p_instance;
+}
+
+/** Start, address, data and stop at 9 clocks per byte */
+static uint64_t twi_us(uint8_t len)
+{
+    return ((uint64_t)(len + 1) * 9 + 2) * 1000000 / twim.frequency;
+}
+
+static void twi_done(void *ctx)
+{
+    nrf_drv_twi_evt_t evt;
+    bool              write = ctx != NULL;
+
+    // a write executes at the stop condition
+    if (write) twim.ack = scd4x_model_write(twim.addr, twim.tx, twim.len);
+
+    evt.type  = twim.ack ? NRF_DRV_TWI_EVT_DONE : NRF_DRV_TWI_EVT_ADDRESS_NACK;
+    twim.busy = false;
+    if (!twim.ack) sim_twi_stats.nacks++;
+    if (twim.handler != NULL) twim.handler(&evt, NULL);
+}
+
+/** Address byte of a read, the sensor answers it when it is ready */
+static void twi_read_addressed(void *ctx)
+{
+    (void)ctx;
+    twim.ack = scd4x_model_read(twim.addr, twim.rx, twim.len);
+}
+
+ret_code_t nrf_drv_twi_tx(nrf_drv_twi_t const *p_instance, uint8_t address, uint8_t const *p_data, uint8_t length, bool no_stop)
+{
+    uint64_t us = twi_us(length);
+
+    (void)p_instance;
+    (void)no_stop;
+    if (!twim.inited || length > TWI_BUF_MAX) return NRF_ERROR_INVALID_STATE;
+    if (twim.busy) return NRF_ERROR_BUSY;
+
+    twim.busy = true;
+    twim.addr = address;
+    twim.len  = length;
+    memcpy(twim.tx, p_data, length);
+    sim_twi_stats.transfers++;
+    sim_twi_stats.bus_us += us;
+    sim_schedule(sim_now_us() + us, twi_done, (void *)1, SIM_TAG_TWI);
+    return NRF_SUCCESS;
+}
+
+ret_code_t nrf_drv_twi_rx(nrf_drv_twi_t const *p_instance, uint8_t address, uint8_t *p_data, uint8_t length)
+{
+    uint64_t us = twi_us(length);
+
+    (void)p_instance;
+    if (!twim.inited) return NRF_ERROR_INVALID_STATE;
+    if (twim.busy) return NRF_ERROR_BUSY;
+
+    twim.busy = true;
+    twim.addr = address;
+    twim.rx   = p_data;
+    twim.len  = length;
+    sim_twi_stats.transfers++;
+    sim_twi_stats.bus_us += us;
+    sim_schedule(sim_now_us() + twi_us(0), twi_read_addressed, NULL, SIM_TAG_TWI);
+    sim_schedule(sim_now_us() + us, twi_done, NULL, SIM_TAG_TWI);
+    return NRF_SUCCESS;
+}
+
+nrfx_err_t nrfx_twim_bus_recover(uint32_t scl_pin, uint32_t sda_pin)
+{
+    // 9 clocks and a stop at 100 kHz
+    nrf_delay_us(100);
+    if (scl_pin != PIN_CO2_SCL || sda_pin != PIN_CO2_SDA) return NRFX_ERROR_INTERNAL;
+    return scd4x_model_bus_recover() ? NRFX_SUCCESS : NRFX_ERROR_INTERNAL;
+}
+
+/** SAADC **************************************************************** */
+
+ret_code_t nrf_drv_saadc_init(void const *p_config, nrf_drv_saadc_event_handler_t event_handler)
+{
+    (void)p_config;
+    (void)event_handler;
+    return NRF_SUCCESS;
+}
+
+ret_code_t nrfx_saadc_channel_init(uint8_t channel, nrf_saadc_channel_config_t const *p_config)
+{
+    (void)channel;
+    (void)p_config;
+    return NRF_SUCCESS;
+}
+
+ret_code_t nrfx_saadc_sample_convert(uint8_t channel, nrf_saadc_value_t *p_value)
+{
+    (void)channel;
+    // 0.6 V reference, gain 1/6, 12 bit, and the 1/10 divider of RAW_TO_MV()
+    *p_value = (nrf_saadc_value_t)((uint32_t)sim_config.battery_mv * 4096 / 6000);
+    return NRF_SUCCESS;
+}
+
+/** fstorage, the internal flash pages of cfg_fstorage.c ****************** */
+
+nrf_fstorage_api_t nrf_fstorage_sd;
+
+#define INTERNAL_FLASH_SIZE (512 * 1024)
+
+static uint8_t *internal_flash;
+
+static uint8_t *flash_at(uint32_t addr)
+{
+    if (internal_flash == NULL)
+    {
+        internal_flash = malloc(INTERNAL_FLASH_SIZE);
+        memset(internal_flash, 0xFF, INTERNAL_FLASH_SIZE);
+    }
+    return internal_flash + (addr % INTERNAL_FLASH_SIZE);
+}
+
+static void fstorage_evt(nrf_fstorage_t const *p_fs, nrf_fstorage_evt_id_t id, uint32_t addr, void const *p_src, uint32_t len, void *p_param)
+{
+    nrf_fstorage_evt_t evt = {.id = id, .result = NRF_SUCCESS, .addr = addr, .p_src = p_src, .len = len, .p_param = p_param};
+
+    if (p_fs->evt_handler != NULL) p_fs->evt_handler(&evt);
+}
+
+ret_code_t nrf_fstorage_init(nrf_fstorage_t *p_fs, nrf_fstorage_api_t *p_api, void *p_param)
+{
+    (void)p_param;
+    p_fs->p_api = p_api;
+    return NRF_SUCCESS;
+}
+
+ret_code_t nrf_fstorage_read(nrf_fstorage_t const *p_fs, uint32_t src, void *p_dest, uint32_t len)
+{
+    (void)p_fs;
+    memcpy(p_dest, flash_at(src), len);
+    return NRF_SUCCESS;
+}
+
+ret_code_t nrf_fstorage_write(nrf_fstorage_t const *p_fs, uint32_t dest, void const *p_src, uint32_t len, void *p_param)
+{
+    uint8_t       *dst = flash_at(dest);
+    const uint8_t *src = p_src;
+
+    for (uint32_t i = 0; i < len; i++)
+    {
+        dst[i] &= src[i];
+    }
+    fstorage_evt(p_fs, NRF_FSTORAGE_EVT_WRITE_RESULT, dest, p_src, len, p_param);
+    return NRF_SUCCESS;
+}
+
+ret_code_t nrf_fstorage_erase(nrf_fstorage_t const *p_fs, uint32_t page_addr, uint32_t len, void *p_param)
+{
+    memset(flash_at(page_addr), 0xFF, len * sim_ficr.CODEPAGESIZE);
+    fstorage_evt(p_fs, NRF_FSTORAGE_EVT_ERASE_RESULT, page_addr, NULL, len, p_param);
+    return NRF_SUCCESS;
+}
+
+bool nrf_fstorage_is_busy(nrf_fstorage_t const *p_fs)
+{
+    (void)p_fs;
+    return false;
+}
+
+/** app_scheduler ******************************************************** */
+
+#define SCHED_QUEUE_SIZE 32
+#define SCHED_EVENT_MAX  64
+
+static struct
+{
+    app_sched_event_handler_t handler;
+    uint16_t                  size;
+    uint8_t                   data[SCHED_EVENT_MAX];
+} sched_queue[SCHED_QUEUE_SIZE];
+static uint8_t sched_head, sched_tail;
+
+ret_code_t app_sched_event_put(void const *p_event_data, uint16_t event_size, app_sched_event_handler_t handler)
+{
+    uint8_t next = (sched_tail + 1) % SCHED_QUEUE_SIZE;
+
+    if (event_size > SCHED_EVENT_MAX) return NRF_ERROR_INVALID_PARAM;
+    if (next == sched_head) return NRF_ERROR_NO_MEM;
+
+    sched_queue[sched_tail].handler = handler;
+    sched_queue[sched_tail].size    = event_size;
+    if (event_size != 0) memcpy(sched_queue[sched_tail].data, p_event_data, event_size);
+    sched_tail = next;
+    return NRF_SUCCESS;
+}
+
+void app_sched_execute(void)
+{
+    while (sched_head != sched_tail)
+    {
+        uint8_t i  = sched_head;
+        sched_head = (sched_head + 1) % SCHED_QUEUE_SIZE;
+        sched_queue[i].handler(sched_queue[i].size ? sched_queue[i].data : NULL, sched_queue[i].size);
+    }
+}
+
+/** PWM ****************************************************************** */
+
+ret_code_t app_pwm_init(app_pwm_t const *p_instance, app_pwm_config_t const *p_config, app_pwm_callback_t p_ready_callback)
+{
+    (void)p_instance;
+    (void)p_config;
+    (void)p_ready_callback;
+    return NRF_SUCCESS;
+}
+
+void app_pwm_enable(app_pwm_t const *p_instance)
+{
+    (void)p_instance;
+}
+
+ret_code_t app_pwm_uninit(app_pwm_t const *p_instance)
+{
+    (void)p_instance;
+    return NRF_SUCCESS;
+}
+
+ret_code_t app_pwm_channel_duty_set(app_pwm_t const *p_instance, uint8_t channel, uint8_t duty)
+{
+    (void)p_instance;
+    (void)channel;
+    sim_tl_add(SIM_TL_PWM, duty, 0);
+    return NRF_SUCCESS;
+}
+
+/** WDT, reload value of sdk_config.h ************************************* */
+
+#define WDT_RELOAD_MS 2000
+
+static uint64_t wdt_last_feed_us;
+
+void nrf_drv_wdt_channel_feed(nrf_drv_wdt_channel_id channel_id)
+{
+    uint32_t gap_ms = (uint32_t)((sim_now_us() - wdt_last_feed_us) / 1000);
+
+    (void)channel_id;
+    if (gap_ms > sim_wdt_max_gap_ms) sim_wdt_max_gap_ms = gap_ms;
+    if (gap_ms > WDT_RELOAD_MS) sim_tl_add(SIM_TL_WDT_STARVED, gap_ms, 0);
+    wdt_last_feed_us = sim_now_us();
+}
+
+/** RTT, printed with SIM_VERBOSE set in the environment ***************** */
+
+static bool verbose(void)
+{
+    static int v = -1;
+
+    if (v < 0) v = getenv("SIM_VERBOSE") != NULL;
+    return v != 0;
+}
+
+int SEGGER_RTT_ConfigUpBuffer(unsigned BufferIndex, const char *sName, void *pBuffer, unsigned BufferSize, unsigned Flags)
+{
+    (void)BufferIndex;
+    (void)sName;
+    (void)pBuffer;
+    (void)BufferSize;
+    (void)Flags;
+    return 0;
+}
+
+unsigned SEGGER_RTT_Write(unsigned BufferIndex, const void *pBuffer, unsigned NumBytes)
+{
+    if (BufferIndex != 0) sim_dlog_bytes += NumBytes;
+    if (verbose() && BufferIndex == 0) fwrite(pBuffer, 1, NumBytes, stderr);
+    return NumBytes;
+}
+
+int SEGGER_RTT_vprintf(unsigned BufferIndex, const char *sFormat, va_list *pParamList)
+{
+    (void)BufferIndex;
+    if (!verbose()) return 0;
+    fprintf(stderr, "%10.3f ", sim_now_us() / 1e6);
+    return vfprintf(stderr, sFormat, *pParamList);
+}
+
+int SEGGER_RTT_printf(unsigned BufferIndex, const char *sFormat, ...)
+{
+    va_list args;
+    int     ret;
+
+    va_start(args, sFormat);
+    ret = SEGGER_RTT_vprintf(BufferIndex, sFormat, &args);
+    va_end(args);
+    return ret;
+}
+
+/** SoftDevice ********************************************************** */
+
+uint32_t sd_power_gpregret_set(uint32_t gpregret_id, uint32_t gpregret_msk)
+{
+    (void)gpregret_id;
+    (void)gpregret_msk;
+    return NRF_SUCCESS;
+}
+
+const char *nrf_strerror_get(ret_code_t code)
+{
+    static char buf[16];
+
+    snprintf(buf, sizeof(buf), "0x%X", code);
+    return buf;
+}
+
+/** Board **************************************************************** */
+
+void sim_board_reset(void)
+{
+    memset(pin_out, 0, sizeof(pin_out));
+    memset(pin_dir, 0, sizeof(pin_dir));
+    memset(pin_in, 0, sizeof(pin_in));
+    pin_in[PIN_KEY]      = true;
+    pin_in[PIN_USB_IN]   = sim_config.usb_in;
+    pin_in[PIN_CHRG_STA] = !sim_config.charging;
+
+    nrfx_gpiote_uninit();
+    memset(&spim, 0, sizeof(spim));
+    memset(&twim, 0, sizeof(twim));
+    memset(&sim_spi_stats, 0, sizeof(sim_spi_stats));
+    memset(&sim_twi_stats, 0, sizeof(sim_twi_stats));
+    sched_head = sched_tail = 0;
+    sim_wdt_max_gap_ms      = 0;
+    wdt_last_feed_us        = sim_now_us();
+    sim_dlog_bytes          = 0;
+
+    zb25d16_model_reset();
+    scd4x_model_reset();
+    st7301_model_power(false);
+    st7301_model_stats_clear();
+}
@@ -0,0 +1,6 @@
+#ifndef __SDK_COMMON_H__
+#define __SDK_COMMON_H__
+
+#include "sdk_stub.h"
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef __SDK_STUB_H__
+#define __SDK_STUB_H__
+
+/**
+ * Host stand-ins for the nRF5 SDK, nrfx and SoftDevice definitions used by the
+ * application. The peripherals are backed by sim.c and the models in this
+ * directory, time is virtual and only advances in sim_wfe(), nrf_delay_ms()
+ * and the simulation loop.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+typedef uint32_t ret_code_t;
+
+#define NRF_SUCCESS             0
+#define NRF_ERROR_INTERNAL      3
+#define NRF_ERROR_NO_MEM        4
+#define NRF_ERROR_INVALID_STATE 8
+#define NRF_ERROR_INVALID_PARAM 7
+#define NRF_ERROR_BUSY          17
+#define NRFX_SUCCESS            0
+#define NRFX_ERROR_INTERNAL     0x0BAD0003
+#define NRFX_ERROR_BUSY         0x0BAD000B
+
+#define APP_IRQ_PRIORITY_HIGHEST 2
+#define APP_IRQ_PRIORITY_HIGH    2
+#define APP_IRQ_PRIORITY_MID     4
+#define APP_IRQ_PRIORITY_LOW     6
+#define APP_IRQ_PRIORITY_LOWEST  7
+
+#define ROUNDED_DIV(A, B) (((A) + ((B) / 2)) / (B))
+#define UNUSED_PARAMETER(X) (void)(X)
+#define UNUSED_VARIABLE(X)  (void)(X)
+
+/** Stops the simulation with the location of a failed APP_ERROR_CHECK */
+void sim_error(const char *file, int line, uint32_t err_code);
+
+#define APP_ERROR_CHECK(err_code)                           \
+    do                                                      \
+    {                                                       \
+        uint32_t _err = (err_code);                         \
+        if (_err != NRF_SUCCESS)                            \
+        {                                                   \
+            sim_error(__FILE__, __LINE__, _err);            \
+        }                                                   \
+    } while (0)
+
+#define STATIC_ASSERT(EXPR) _Static_assert(EXPR, #EXPR)
+
+/** Interrupts are simulated by sim.c between statements, a critical region only counts its nesting */
+extern volatile uint8_t sim_critical_nesting;
+
+#define CRITICAL_REGION_ENTER() \
+    {                           \
+        sim_critical_nesting++;
+
+#define CRITICAL_REGION_EXIT()  \
+    sim_critical_nesting--;     \
+    }
+
+/** Sleep until the next event: runs pending peripheral completions and timers */
+void sim_wfe(void);
+
+/** Memory barrier, a point where a test can cut the program off as a reset would */
+void sim_dmb(void);
+
+#define __WFE() sim_wfe()
+#define __SEV()
+#define __DMB() sim_dmb()
+#define __DSB()
+#define __ISB()
+
+/** Code size registers read by cfg_fstorage.c */
+typedef struct
+{
+    uint32_t CODEPAGESIZE;
+    uint32_t CODESIZE;
+    uint32_t DEVICEID[2];
+    uint32_t DEVICEADDR[2];
+} NRF_FICR_Type;
+
+extern NRF_FICR_Type sim_ficr;
+#define NRF_FICR (&sim_ficr)
+
+#define BOOTLOADER_ADDRESS 0x00078000
+
+#define NRF_MODULE_ENABLED(module) 1
+
+/** Resets the simulated device, returns to the boot point of sim_run() */
+void NVIC_SystemReset(void);
+void sd_nvic_SystemReset(void);
+
+uint32_t sd_power_gpregret_set(uint32_t gpregret_id, uint32_t gpregret_msk);
+uint32_t sd_power_system_off(void);
+
+#endif // __SDK_STUB_H__
@@ -0,0 +1,700 @@
+#include "sim.h"
+
+#include <setjmp.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "app_scheduler.h"
+#include "app_timer.h"
+#include "button.h"
+#include "cfg_fstorage.h"
+#include "energy.h"
+#include "history.h"
+#include "log.h"
+#include "nrf_delay.h"
+#include "nrf_drv_wdt.h"
+#include "protocol.h"
+#include "trace.h"
+#include "ttask.h"
+#include "user.h"
+
+/**
+ * Virtual time, the event queue, app_timer, the run loop and the parts of
+ * main.c that talk to the SoftDevice. The scheduler glue itself (ttask.c) is
+ * the application's.
+ */
+
+sim_config_t sim_config = {
+    .reset_reason_code = 1,
+    .battery_mv        = 3900,
+    .usb_in            = false,
+    .charging          = false,
+};
+
+volatile uint8_t sim_critical_nesting = 0;
+int              sim_in_isr           = 0;
+NRF_FICR_Type    sim_ficr             = {.CODEPAGESIZE = 4096, .CODESIZE = 128};
+
+const char *sim_error_file = NULL;
+int         sim_error_line = 0;
+
+uint64_t sim_busy_us = 0;
+
+static uint64_t now_us = 0;
+
+/** Exit point of sim_boot()/sim_run(), NULL outside of them */
+static jmp_buf *exit_jmp      = NULL;
+static bool     system_is_off = false;
+
+/** Events ************************************************************** */
+
+#define SIM_EVT_MAX 64
+
+typedef struct
+{
+    uint64_t     t_us;
+    uint64_t     seq; // insertion order among events at the same time
+    sim_evt_fn_t fn;
+    void        *ctx;
+    int          tag; // 0 = free
+} sim_evt_t;
+
+static sim_evt_t evts[SIM_EVT_MAX];
+static uint64_t  evt_seq   = 0;
+static int       evt_count = 0; // slots in use, most ticks have none
+
+uint64_t sim_now_us(void)
+{
+    return now_us;
+}
+
+uint64_t sim_host_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+void sim_schedule(uint64_t t_us, sim_evt_fn_t fn, void *ctx, int tag)
+{
+    for (int i = 0; i < SIM_EVT_MAX; i++)
+    {
+        if (evts[i].tag == 0)
+        {
+            evts[i] = (sim_evt_t){.t_us = t_us, .seq = evt_seq++, .fn = fn, .ctx = ctx, .tag = tag};
+            evt_count++;
+            return;
+        }
+    }
+    fprintf(stderr, "sim: event queue full\n");
+    abort();
+}
+
+void sim_cancel(int tag)
+{
+    for (int i = 0; i < SIM_EVT_MAX; i++)
+    {
+        if (evts[i].tag == tag)
+        {
+            evts[i].tag = 0;
+            evt_count--;
+        }
+    }
+}
+
+/** app_timer ************************************************************ */
+
+static app_timer_t *timers = NULL;
+
+static uint64_t ticks_to_us(uint32_t ticks)
+{
+    uint32_t freq = APP_TIMER_CLOCK_FREQ / (APP_TIMER_CONFIG_RTC_FREQUENCY + 1);
+    return ((uint64_t)ticks * 1000000ull + freq / 2) / freq;
+}
+
+ret_code_t app_timer_init(void)
+{
+    return NRF_SUCCESS;
+}
+
+ret_code_t app_timer_create(app_timer_id_t const *p_timer_id, app_timer_mode_t mode, app_timer_timeout_handler_t timeout_handler)
+{
+    app_timer_t *t = *p_timer_id;
+    app_timer_t *i;
+
+    if (timeout_handler == NULL) return NRF_ERROR_INVALID_PARAM;
+
+    t->handler   = timeout_handler;
+    t->mode      = mode;
+    t->expire_us = 0;
+    for (i = timers; i != NULL && i != t; i = i->next)
+    {
+    }
+    if (i == NULL)
+    {
+        t->next = timers;
+        timers  = t;
+    }
+    return NRF_SUCCESS;
+}
+
+ret_code_t app_timer_start(app_timer_id_t timer_id, uint32_t timeout_ticks, void *p_context)
+{
+    if (timer_id->handler == NULL || timeout_ticks < 5) return NRF_ERROR_INVALID_PARAM;
+
+    if (timer_id->handler == ttask_timer_timerout_handler && ticks_to_us(timeout_ticks) != timer_id->period_us)
+    {
+        sim_tl_add(SIM_TL_TIMER_MODE, (uint32_t)(ticks_to_us(timeout_ticks) / 1000), 0);
+    }
+    timer_id->period_us = ticks_to_us(timeout_ticks);
+    timer_id->expire_us = now_us + timer_id->period_us;
+    timer_id->p_context = p_context;
+    return NRF_SUCCESS;
+}
+
+ret_code_t app_timer_stop(app_timer_id_t timer_id)
+{
+    timer_id->expire_us = 0;
+    return NRF_SUCCESS;
+}
+
+ret_code_t app_timer_stop_all(void)
+{
+    for (app_timer_t *t = timers; t != NULL; t = t->next)
+    {
+        t->expire_us = 0;
+    }
+    return NRF_SUCCESS;
+}
+
+uint32_t app_timer_cnt_get(void)
+{
+    uint32_t freq = APP_TIMER_CLOCK_FREQ / (APP_TIMER_CONFIG_RTC_FREQUENCY + 1);
+    return (uint32_t)(now_us * freq / 1000000ull) & APP_TIMER_MAX_CNT_VAL;
+}
+
+uint32_t app_timer_cnt_diff_compute(uint32_t ticks_to, uint32_t ticks_from)
+{
+    return (ticks_to - ticks_from) & APP_TIMER_MAX_CNT_VAL;
+}
+
+/** Delivery ************************************************************* */
+
+static EventGroup_t events_seen = 0;
+
+/** Record the event bits that became set since the last look */
+static void events_diff(void)
+{
+    EventGroup_t set = event_group_system & ~events_seen;
+
+    events_seen = event_group_system;
+    if (set != 0)
+    {
+        sim_tl_add(SIM_TL_EVENT, (uint32_t)set, (uint32_t)(set >> 32));
+    }
+}
+
+/** Earliest pending event or timer, returns false when there is none */
+static bool next_due(uint64_t *t_us, sim_evt_t **evt, app_timer_t **timer)
+{
+    *evt   = NULL;
+    *timer = NULL;
+
+    for (int i = 0; i < SIM_EVT_MAX && evt_count != 0; i++)
+    {
+        if (evts[i].tag != 0 &&
+            (*evt == NULL || evts[i].t_us < (*evt)->t_us || (evts[i].t_us == (*evt)->t_us && evts[i].seq < (*evt)->seq)))
+        {
+            *evt = &evts[i];
+        }
+    }
+    for (app_timer_t *t = timers; t != NULL; t = t->next)
+    {
+        if (t->expire_us != 0 && (*timer == NULL || t->expire_us < (*timer)->expire_us))
+        {
+            *timer = t;
+        }
+    }
+    // peripheral events first at the same time
+    if (*evt != NULL && (*timer == NULL || (*evt)->t_us <= (*timer)->expire_us))
+    {
+        *timer = NULL;
+        *t_us  = (*evt)->t_us;
+        return true;
+    }
+    if (*timer != NULL)
+    {
+        *evt  = NULL;
+        *t_us = (*timer)->expire_us;
+        return true;
+    }
+    return false;
+}
+
+/** Deliver everything due up to t_us in time order, then move the clock to t_us */
+static void process_until(uint64_t t_us)
+{
+    uint64_t     t;
+    sim_evt_t   *evt;
+    app_timer_t *timer;
+
+    while (next_due(&t, &evt, &timer) && t <= t_us)
+    {
+        if (t > now_us) now_us = t;
+
+        sim_in_isr++;
+        if (evt != NULL)
+        {
+            sim_evt_t e = *evt;
+            evt->tag    = 0;
+            evt_count--;
+            e.fn(e.ctx);
+        }
+        else
+        {
+            timer->expire_us = timer->mode == APP_TIMER_MODE_REPEATED ? timer->expire_us + timer->period_us : 0;
+            timer->handler(timer->p_context);
+        }
+        sim_in_isr--;
+        events_diff();
+    }
+    if (t_us > now_us) now_us = t_us;
+}
+
+static void sim_exit(sim_exit_t reason)
+{
+    if (exit_jmp == NULL)
+    {
+        fprintf(stderr, "sim: exit %d outside of sim_run()\n", reason);
+        abort();
+    }
+    longjmp(*exit_jmp, (int)reason + 1);
+}
+
+void sim_wfe(void)
+{
+    uint64_t     t;
+    sim_evt_t   *evt;
+    app_timer_t *timer;
+
+    if (!next_due(&t, &evt, &timer))
+    {
+        sim_exit(system_is_off ? SIM_EXIT_OFF : SIM_EXIT_HANG);
+    }
+    process_until(t > now_us ? t : now_us);
+}
+
+void nrf_delay_us(uint32_t us)
+{
+    sim_busy_us += us;
+
+    // a busy wait in an interrupt or critical region holds off everything else
+    if (sim_in_isr || sim_critical_nesting)
+    {
+        now_us += us;
+        return;
+    }
+    process_until(now_us + us);
+}
+
+void nrf_delay_ms(uint32_t ms)
+{
+    nrf_delay_us(ms * 1000);
+}
+
+void sim_error(const char *file, int line, uint32_t err_code)
+{
+    fprintf(stderr, "sim: APP_ERROR_CHECK 0x%X at %s:%d\n", err_code, file, line);
+    sim_error_file = file;
+    sim_error_line = line;
+    sim_tl_add(SIM_TL_ERROR, err_code, (uint32_t)line);
+    sim_exit(SIM_EXIT_ERROR);
+}
+
+void NVIC_SystemReset(void)
+{
+    sim_tl_add(SIM_TL_RESET, 0, 0);
+    sim_exit(SIM_EXIT_RESET);
+}
+
+void sd_nvic_SystemReset(void)
+{
+    NVIC_SystemReset();
+}
+
+uint32_t sd_power_system_off(void)
+{
+    system_is_off = true;
+    sim_tl_add(SIM_TL_SYSTEM_OFF, 0, 0);
+    sim_exit(SIM_EXIT_OFF);
+    return NRF_SUCCESS;
+}
+
+/** Timeline ************************************************************* */
+
+static sim_tl_t *tl       = NULL;
+static uint32_t  tl_count = 0;
+static uint32_t  tl_size  = 0;
+
+void sim_tl_add(sim_tl_type_t type, uint32_t a, uint32_t b)
+{
+    if (tl_count == tl_size)
+    {
+        tl_size = tl_size ? tl_size * 2 : 4096;
+        tl      = realloc(tl, tl_size * sizeof(*tl));
+        if (tl == NULL) abort();
+    }
+    tl[tl_count++] = (sim_tl_t){.t_us = now_us, .type = (uint16_t)type, .a = a, .b = b};
+}
+
+uint32_t sim_tl_count(void)
+{
+    return tl_count;
+}
+
+const sim_tl_t *sim_tl_get(uint32_t index)
+{
+    return index < tl_count ? &tl[index] : NULL;
+}
+
+uint32_t sim_tl_count_type(sim_tl_type_t type)
+{
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < tl_count; i++)
+    {
+        n += tl[i].type == type;
+    }
+    return n;
+}
+
+uint32_t sim_tl_count_type_a(sim_tl_type_t type, uint32_t a)
+{
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < tl_count; i++)
+    {
+        n += tl[i].type == type && tl[i].a == a;
+    }
+    return n;
+}
+
+const char *sim_tl_name(sim_tl_type_t type)
+{
+    static const char *names[SIM_TL_TYPE_COUNT] = {
+        [SIM_TL_BOOT] = "boot", [SIM_TL_EVENT] = "event", [SIM_TL_TIMER_MODE] = "timer_mode",
+        [SIM_TL_FLASH_READ] = "flash_read", [SIM_TL_FLASH_PROG] = "flash_prog", [SIM_TL_FLASH_ERASE] = "flash_erase",
+        [SIM_TL_NUS_TX] = "nus_tx", [SIM_TL_NUS_RX] = "nus_rx", [SIM_TL_ADV] = "adv", [SIM_TL_CONN] = "conn",
+        [SIM_TL_CO2_CMD] = "co2_cmd", [SIM_TL_CO2_SAMPLE] = "co2_sample", [SIM_TL_CO2_POWER] = "co2_power",
+        [SIM_TL_LCD_POWER] = "lcd_power", [SIM_TL_LCD_MODE] = "lcd_mode", [SIM_TL_LCD_FRAME] = "lcd_frame",
+        [SIM_TL_PWM] = "pwm", [SIM_TL_VIBRATOR] = "vibrator", [SIM_TL_BATTERY] = "battery",
+        [SIM_TL_WDT_STARVED] = "wdt_starved", [SIM_TL_RESET] = "reset", [SIM_TL_SYSTEM_OFF] = "system_off",
+        [SIM_TL_ERROR] = "error",
+    };
+    return type < SIM_TL_TYPE_COUNT && names[type] ? names[type] : "?";
+}
+
+void sim_tl_dump(FILE *f)
+{
+    fprintf(f, "t_us,type,a,b\n");
+    for (uint32_t i = 0; i < tl_count; i++)
+    {
+        fprintf(f, "%llu,%s,%u,%u\n", (unsigned long long)tl[i].t_us, sim_tl_name(tl[i].type), tl[i].a, tl[i].b);
+    }
+}
+
+/** main.c stand-ins ***************************************************** */
+
+uint8_t ble_state = IDLE; // BleState, declared by ui.h as uint8_t
+
+uint16_t reset_reason_code = 0;
+uint16_t co2_history[CO2_HISTORY_LEN] = {0};
+bool     stop_advertising = false;
+
+bool     is_fast_interval          = false;
+uint16_t fast_interval_timer_ticks = 0;
+#define FAST_INTERVAL_SECONDS_MAX 30
+
+nrf_drv_wdt_channel_id m_channel_id;
+
+void (*sim_nus_tx_hook)(const uint8_t *frame, uint16_t len) = NULL;
+void (*sim_dmb_hook)(void)                                  = NULL;
+
+void sim_dmb(void)
+{
+    if (sim_dmb_hook != NULL) sim_dmb_hook();
+}
+
+uint8_t get_ble_state(void)
+{
+    return ble_state;
+}
+
+void update_co2_history(uint16_t new_value)
+{
+    for (int i = CO2_HISTORY_LEN - 1; i > 0; i--)
+    {
+        co2_history[i] = co2_history[i - 1];
+    }
+    co2_history[0] = new_value;
+}
+
+char *get_ble_name(void)
+{
+    static char name[] = DEVICE_NAME;
+    return name;
+}
+
+void set_fast_interval_timer(void)
+{
+    fast_interval_timer_ticks = FAST_INTERVAL_SECONDS_MAX;
+}
+
+void toggle_connection_interval(void)
+{
+    if (fast_interval_timer_ticks > 0) return;
+
+    is_fast_interval = !is_fast_interval;
+    if (is_fast_interval)
+    {
+        set_fast_interval_timer();
+    }
+    else
+    {
+        fast_interval_timer_ticks = 0;
+    }
+}
+
+void battery_level_update(uint8_t battery_level)
+{
+    sim_tl_add(SIM_TL_BATTERY, battery_level, 0);
+}
+
+void proto_send_frame(uint8_t *frame, uint16_t len)
+{
+    if (ble_state != CONNECTED) return;
+
+    sim_tl_add(SIM_TL_NUS_TX, len, len ? frame[0] : 0);
+    if (sim_nus_tx_hook != NULL) sim_nus_tx_hook(frame, len);
+}
+
+void advertising_start(void)
+{
+    if (ble_state != IDLE) return;
+
+    ble_state = ADVERTISING;
+    trace_add(TRACE_EVT_BLE_ADV_START, 0, 0);
+    EventGroupSetBits(event_group_system, EVT_UI_UP_BLE);
+    sim_tl_add(SIM_TL_ADV, 1, 0);
+}
+
+void advertising_stop(void)
+{
+    if (ble_state == IDLE) return;
+
+    trace_add(TRACE_EVT_BLE_ADV_STOP, 0, 0);
+    if (ble_state == CONNECTED)
+    {
+        stop_advertising = true;
+        sim_ble_connect(false);
+    }
+    else
+    {
+        ble_state = IDLE;
+        sim_tl_add(SIM_TL_ADV, 0, 0);
+    }
+}
+
+void set_ble_disconnect(void)
+{
+    if (ble_state != CONNECTED) return;
+    ble_state = IDLE;
+    sim_ble_connect(false);
+}
+
+void ble_delete_bonds(void)
+{
+    set_ble_disconnect();
+}
+
+void sim_ble_connect(bool connected)
+{
+    if (connected)
+    {
+        if (ble_state != ADVERTISING) return;
+        ble_state = CONNECTED;
+        trace_add(TRACE_EVT_BLE_CONNECTED, 0, 0);
+        EventGroupSetBits(event_group_system, EVT_UI_UP_BLE);
+        sim_tl_add(SIM_TL_CONN, 1, 0);
+        return;
+    }
+
+    sim_tl_add(SIM_TL_CONN, 0, 0);
+    trace_add(TRACE_EVT_BLE_DISCONNECTED, 0x16, 0);
+    if (stop_advertising)
+    {
+        ble_state        = IDLE;
+        stop_advertising = false;
+        sim_tl_add(SIM_TL_ADV, 0, 0);
+    }
+    else
+    {
+        ble_state = ADVERTISING; // the advertising module restarts on disconnect
+        EventGroupSetBits(event_group_system, EVT_UI_UP_BLE);
+    }
+}
+
+static void nus_rx_deliver(void *ctx)
+{
+    uint8_t *buf = ctx;
+    uint16_t len = (uint16_t)(buf[0] | buf[1] << 8);
+
+    proto_put_data(buf + 2, len);
+    free(buf);
+}
+
+void sim_nus_rx(const uint8_t *data, uint16_t len)
+{
+    uint8_t *buf = malloc(len + 2u);
+
+    buf[0] = (uint8_t)len;
+    buf[1] = (uint8_t)(len >> 8);
+    memcpy(buf + 2, data, len);
+    sim_tl_add(SIM_TL_NUS_RX, len, len ? data[0] : 0);
+    sim_schedule(now_us, nus_rx_deliver, buf, SIM_TAG_NUS); // from the SoftDevice event interrupt
+}
+
+void system_off(void)
+{
+    trace_add(TRACE_EVT_SLEEP, 0, 0);
+    nrf_gpio_cfg_sense_input(BUTTON_0, NRF_GPIO_PIN_PULLUP, NRF_GPIO_PIN_SENSE_LOW);
+    sd_power_gpregret_set(0, 1);
+    EventGroupClearBits(event_group_system, EVT_DEVICE_SLEEP);
+    sd_power_system_off();
+}
+
+void sleep_device(void)
+{
+    advertising_stop();
+    app_timer_stop_all();
+    button_sleep_mode_enter();
+
+    nrf_gpio_pin_clear(PIN_VIBRATOR);
+    nrf_gpio_pin_clear(PIN_BUZZER);
+    co2_twi_uninit();
+    nrf_gpio_pin_clear(PIN_CO2_PWR);
+    nrf_gpio_pin_clear(PIN_LCD_PWR);
+    nrf_drv_wdt_channel_feed(m_channel_id);
+
+    system_off();
+}
+
+void start_factory_test(void)
+{
+    advertising_stop();
+    app_timer_stop_all();
+    trace_add(TRACE_EVT_RESET, TRACE_RESET_FACTORY_TEST, 0);
+    sd_nvic_SystemReset();
+}
+
+// factory_test_task.c is not part of this tree
+TaskDefine(task_factory_test)
+{
+    TTS
+    {
+    }
+    TTE
+}
+
+/** Run ****************************************************************** */
+
+sim_exit_t sim_boot(void)
+{
+    jmp_buf env;
+    int     ret;
+
+    exit_jmp = &env;
+    ret      = setjmp(env);
+    if (ret != 0)
+    {
+        exit_jmp = NULL;
+        return (sim_exit_t)(ret - 1);
+    }
+
+    sim_board_reset();
+
+    // main()
+    dlog_init();
+
+    // init(), the SoftDevice and BLE services have no host counterpart
+    trace_init();
+    energy_init();
+    cfg_fstorage_init();
+    cfg_fstorage_load();
+    user_init();
+
+    // check_reset_reason()
+    reset_reason_code = sim_config.reset_reason_code;
+    sim_tl_add(SIM_TL_BOOT, reset_reason_code, 0);
+    trace_add(TRACE_EVT_BOOT, (uint8_t)reset_reason_code, 0);
+    set_timebase(0);
+    set_time_set(false);
+    add_record(reset_reason_code, RECORD_TYPE_RESET_REASON);
+
+    if (reset_reason_code == RESET_REASON_CODE_POWER_ON)
+    {
+        ttask_timer_create(power_on_timer_timeout_handler);
+    }
+    else if (reset_reason_code == RESET_REASON_CODE_FACTORY_TEST)
+    {
+        ttask_timer_create(factory_test_timer_timeout_handler);
+        advertising_start();
+    }
+    else
+    {
+        ttask_timer_create(ttask_timer_timerout_handler);
+        if (cfg_fstorage_get_bluetooth_enabled() == 1)
+        {
+            advertising_start();
+        }
+    }
+
+    // start_timer_and_main_loop()
+    ttask_timer_start();
+    button_init();
+
+    exit_jmp = NULL;
+    return SIM_EXIT_TIME;
+}
+
+sim_exit_t sim_run(uint64_t duration_us)
+{
+    jmp_buf  env;
+    int      ret;
+    uint64_t end = now_us + duration_us;
+
+    exit_jmp = &env;
+    ret      = setjmp(env);
+    if (ret != 0)
+    {
+        exit_jmp             = NULL;
+        sim_in_isr           = 0;
+        sim_critical_nesting = 0;
+        return (sim_exit_t)(ret - 1);
+    }
+
+    // exec_main_loop()
+    while (now_us < end)
+    {
+        nrf_drv_wdt_channel_feed(m_channel_id);
+        run_task();
+        app_sched_execute();
+        events_diff();
+
+        // idle_state_handle()
+        energy_end(ENERGY_CPU);
+        sim_wfe();
+        energy_begin(ENERGY_CPU);
+    }
+
+    exit_jmp = NULL;
+    return SIM_EXIT_TIME;
+}
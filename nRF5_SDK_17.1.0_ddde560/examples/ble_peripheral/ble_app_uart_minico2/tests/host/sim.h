@@ -0,0 +1,202 @@
+#ifndef __SIM_H__
+#define __SIM_H__
+
+/**
+ * Host simulation of the device around the unmodified application sources.
+ *
+ * Time is virtual: it only advances when the CPU sleeps (sim_wfe()), busy
+ * waits (nrf_delay_ms()) or the run loop reaches the next event, so a week of
+ * operation runs in seconds. Peripheral completions and app_timer expiries are
+ * events delivered in time order from those points, in "interrupt" context.
+ *
+ * The SPI, TWI and GPIO drivers forward to the ST7301, ZB25D16 and SCD4x
+ * models, everything observable is appended to a timeline.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/** Timeline record types */
+typedef enum
+{
+    SIM_TL_BOOT = 0,   // a = reset reason code
+    SIM_TL_EVENT,      // bits of event_group_system that became set, a = low word, b = high word
+    SIM_TL_TIMER_MODE, // scheduler tick changed, a = tick ms
+    SIM_TL_FLASH_READ, // a = address, b = length
+    SIM_TL_FLASH_PROG, // a = address, b = length
+    SIM_TL_FLASH_ERASE,// a = address, b = length
+    SIM_TL_NUS_TX,     // notification sent, a = length, b = first byte
+    SIM_TL_NUS_RX,     // write received, a = length, b = first byte
+    SIM_TL_ADV,        // a = 1 advertising started, 0 stopped
+    SIM_TL_CONN,       // a = 1 connected, 0 disconnected
+    SIM_TL_CO2_CMD,    // command received by the sensor, a = command, b = 1 when NACKed
+    SIM_TL_CO2_SAMPLE, // measurement read by the application, a = ppm
+    SIM_TL_CO2_POWER,  // a = 1 powered
+    SIM_TL_LCD_POWER,  // a = 1 powered
+    SIM_TL_LCD_MODE,   // a = 0x38 HPM, 0x39 LPM
+    SIM_TL_LCD_FRAME,  // pixel write ended, a = pixel bytes, b = command bytes
+    SIM_TL_PWM,        // buzzer, a = duty
+    SIM_TL_VIBRATOR,   // a = level
+    SIM_TL_BATTERY,    // battery level reported to BAS, a = percent
+    SIM_TL_WDT_STARVED,// a = ms since the last feed
+    SIM_TL_RESET,      // system reset requested, the run ends
+    SIM_TL_SYSTEM_OFF, // System OFF entered, the run ends
+    SIM_TL_ERROR,      // APP_ERROR_CHECK failed, a = error code, b = line
+    SIM_TL_TYPE_COUNT,
+} sim_tl_type_t;
+
+typedef struct
+{
+    uint64_t t_us;
+    uint16_t type;
+    uint32_t a;
+    uint32_t b;
+} sim_tl_t;
+
+/** Why sim_run() returned */
+typedef enum
+{
+    SIM_EXIT_TIME = 0, // the requested time elapsed
+    SIM_EXIT_RESET,    // NVIC_SystemReset or sd_nvic_SystemReset
+    SIM_EXIT_OFF,      // System OFF
+    SIM_EXIT_ERROR,    // APP_ERROR_CHECK
+    SIM_EXIT_HANG,     // the CPU slept with no event left to wake it
+} sim_exit_t;
+
+/** Board inputs and boot configuration, set before sim_boot() */
+typedef struct
+{
+    uint16_t reset_reason_code; // as check_reset_reason() would set it, 1 = pin reset
+    uint16_t battery_mv;        // cell voltage seen by the SAADC
+    bool     usb_in;            // USB_IN pin level
+    bool     charging;          // charger status output active
+} sim_config_t;
+
+extern sim_config_t sim_config;
+
+/** Time ****************************************************************** */
+
+uint64_t sim_now_us(void);
+
+typedef void (*sim_evt_fn_t)(void *ctx);
+
+/** Deliver fn(ctx) at t_us in interrupt context, tag identifies the source for sim_cancel() */
+void sim_schedule(uint64_t t_us, sim_evt_fn_t fn, void *ctx, int tag);
+
+/** Drop pending events of a source */
+void sim_cancel(int tag);
+
+/** Event tags */
+enum
+{
+    SIM_TAG_SPI = 1,
+    SIM_TAG_TWI,
+    SIM_TAG_GPIOTE,
+    SIM_TAG_NUS,
+    SIM_TAG_TEST,
+};
+
+/** 1 while an event handler or timer handler runs */
+extern int sim_in_isr;
+
+/** Run ****************************************************************** */
+
+/**
+ * Power up the device: the board and the models start from their power-on
+ * state, then the init() and init_system_on() sequence of main.c runs. The
+ * application's static data cannot be reset, so a process boots once.
+ */
+sim_exit_t sim_boot(void);
+
+/** Run the main loop of main.c until the virtual time reaches now + duration */
+sim_exit_t sim_run(uint64_t duration_us);
+
+/** File and line of the failed APP_ERROR_CHECK after SIM_EXIT_ERROR */
+extern const char *sim_error_file;
+extern int         sim_error_line;
+
+/** Timeline ************************************************************* */
+
+void            sim_tl_add(sim_tl_type_t type, uint32_t a, uint32_t b);
+uint32_t        sim_tl_count(void);
+const sim_tl_t *sim_tl_get(uint32_t index);
+
+/** Number of records of a type, optionally only those with a == value */
+uint32_t sim_tl_count_type(sim_tl_type_t type);
+uint32_t sim_tl_count_type_a(sim_tl_type_t type, uint32_t a);
+
+/** Write the timeline as CSV: t_us,type,a,b */
+void sim_tl_dump(FILE *f);
+
+const char *sim_tl_name(sim_tl_type_t type);
+
+/** Board ***************************************************************** */
+
+/** Power-on state of the pins, the buses and the models, called by sim_boot() */
+void sim_board_reset(void);
+
+/** Drive an input pin, gpiote handlers run as on an edge */
+void sim_gpio_input(uint32_t pin, bool level);
+
+/** Level of an output pin */
+bool sim_gpio_output(uint32_t pin);
+
+/** Press the key now and release it ms milliseconds later */
+void sim_press_key(uint32_t ms);
+
+/** Connect or disconnect a central */
+void sim_ble_connect(bool connected);
+
+/** Deliver a NUS write from the central */
+void sim_nus_rx(const uint8_t *data, uint16_t len);
+
+/** Called with every notification the application sends, NULL by default */
+extern void (*sim_nus_tx_hook)(const uint8_t *frame, uint16_t len);
+
+/**
+ * Called at every __DMB() the application executes, NULL by default. A hook
+ * that longjmps out stops the application there as a reset would; it is left
+ * inside a critical region, clear sim_critical_nesting afterwards.
+ */
+extern void (*sim_dmb_hook)(void);
+
+/** Bus statistics ******************************************************* */
+
+typedef struct
+{
+    uint32_t transfers;       // SPIM transfers started
+    uint32_t tx_bytes;
+    uint32_t rx_bytes;
+    uint64_t bus_us;          // time the bus was clocking
+    uint32_t lcd_cs_toggles;  // LCD chip select assertions, one per transfer (ss_pin driven by the SPIM)
+    uint32_t flash_cs_toggles;// flash chip select assertions (GPIO driven)
+    uint32_t dma_overwrites;  // transfers whose TX buffer changed while the SPIM was reading it
+    uint32_t busy_rejects;    // nrf_drv_spi_transfer() called while busy
+    uint64_t isr_max_ns;      // longest SPI event handler, host time
+    uint64_t isr_total_ns;
+} sim_spi_stats_t;
+
+typedef struct
+{
+    uint32_t transfers;
+    uint32_t nacks;
+    uint64_t bus_us;
+} sim_twi_stats_t;
+
+extern sim_spi_stats_t sim_spi_stats;
+extern sim_twi_stats_t sim_twi_stats;
+
+/** Longest time between two watchdog feeds, ms */
+extern uint32_t sim_wdt_max_gap_ms;
+
+/** Bytes written to the dlog RTT channel */
+extern uint32_t sim_dlog_bytes;
+
+/** Time spent in nrf_delay_us() busy waits, us; __WFE waits sleep and are not counted */
+extern uint64_t sim_busy_us;
+
+/** Host clock in ns, for the benchmarks */
+uint64_t sim_host_ns(void);
+
+#endif // __SIM_H__
@@ -0,0 +1,295 @@
+#include "st7301_model.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "sim.h"
+
+#define RAM_GROUPS 60
+#define RAM_ROWS   240
+#define VIS_GROUP0 8
+#define VIS_ROW0   64
+
+st7301_model_stats_t st7301_model_stats;
+
+static st7301_model_state_t state;
+static uint64_t             mode_since_us;
+
+static uint8_t ram[RAM_ROWS][RAM_GROUPS * 4];
+
+// parser state
+static uint8_t cmd;       // last command
+static uint8_t param_idx; // parameters received for cmd
+static bool    ram_write; // after 0x2C, parameters are pixels
+
+// window and write pointer
+static uint8_t xs, xe, ys, ye;
+static uint8_t px, py, sub; // column group, row, pixel in the group
+
+static uint32_t frame_pixels, frame_cmds;
+
+void st7301_model_stats_clear(void)
+{
+    memset(&st7301_model_stats, 0, sizeof(st7301_model_stats));
+}
+
+static void mode_account(void)
+{
+    uint64_t now = sim_now_us();
+
+    if (state.powered && state.power_mode == 0x38) state.hpm_us += now - mode_since_us;
+    if (state.powered && state.power_mode == 0x39) state.lpm_us += now - mode_since_us;
+    mode_since_us = now;
+}
+
+st7301_model_state_t st7301_model_state(void)
+{
+    mode_account();
+    return state;
+}
+
+static void controller_reset(void)
+{
+    mode_account();
+    state.sleep_out  = false;
+    state.display_on = false;
+    state.power_mode = 0;
+    cmd              = 0;
+    param_idx        = 0;
+    ram_write        = false;
+    xs = ys = 0;
+    xe      = RAM_GROUPS - 1;
+    ye      = RAM_ROWS - 1;
+    px = py = sub = 0;
+}
+
+void st7301_model_power(bool on)
+{
+    uint32_t seed = 0x12345678u ^ state.power_ups;
+
+    if (on == state.powered) return;
+
+    mode_account();
+    state.powered = on;
+    sim_tl_add(SIM_TL_LCD_POWER, on, 0);
+    controller_reset();
+    if (on)
+    {
+        state.power_ups++;
+        for (int y = 0; y < RAM_ROWS; y++)
+        {
+            for (int x = 0; x < RAM_GROUPS * 4; x++)
+            {
+                seed      = seed * 1103515245u + 12345u;
+                ram[y][x] = (uint8_t)((seed >> 16) & 0xFC);
+            }
+        }
+    }
+}
+
+void st7301_model_reset_pin(bool level)
+{
+    if (!level && state.powered) controller_reset();
+}
+
+static void frame_log(void)
+{
+    if (frame_pixels != 0)
+    {
+        sim_tl_add(SIM_TL_LCD_FRAME, frame_pixels, frame_cmds);
+    }
+    frame_pixels = 0;
+    frame_cmds   = 0;
+}
+
+static void frame_end(void)
+{
+    if (ram_write) frame_log();
+    ram_write = false;
+}
+
+static void pixel_write(uint8_t value)
+{
+    uint16_t col = px * 4 + sub;
+
+    st7301_model_stats.pixel_bytes++;
+    frame_pixels++;
+
+    if (px >= VIS_GROUP0 && px < VIS_GROUP0 + ST7301_MODEL_W / 4 && py >= VIS_ROW0 && ram[py][col] != value)
+    {
+        st7301_model_stats.pixels_changed++;
+    }
+    ram[py][col] = value;
+
+    // 4 pixels per column group, then the next group, wrapping to the next row at the window edge
+    if (++sub < 4) return;
+    sub = 0;
+    if (px < xe)
+    {
+        px++;
+        return;
+    }
+    px = xs;
+    if (py < ye)
+    {
+        py++;
+        return;
+    }
+    py = ys;
+    frame_log(); // the window is full, logged now and not at the next command
+}
+
+static void command(uint8_t value)
+{
+    frame_end();
+    cmd       = value;
+    param_idx = 0;
+    st7301_model_stats.cmd_bytes++;
+
+    switch (value)
+    {
+    case 0x01: // software reset
+        controller_reset();
+        break;
+    case 0x10:
+        state.sleep_out = false;
+        break;
+    case 0x11:
+        state.sleep_out = true;
+        break;
+    case 0x28:
+        state.display_on = false;
+        break;
+    case 0x29:
+        state.display_on = true;
+        break;
+    case 0x2C:
+        ram_write = true;
+        px        = xs;
+        py        = ys;
+        sub       = 0;
+        break;
+    case 0x38:
+    case 0x39:
+        mode_account();
+        state.power_mode = value;
+        sim_tl_add(SIM_TL_LCD_MODE, value, 0);
+        break;
+    default:
+        break;
+    }
+}
+
+static void parameter(uint8_t value)
+{
+    if (ram_write)
+    {
+        pixel_write(value);
+        return;
+    }
+
+    st7301_model_stats.param_bytes++;
+    frame_cmds++;
+
+    if (cmd == 0x2A)
+    {
+        if (param_idx == 0) xs = value;
+        if (param_idx == 1) xe = value;
+    }
+    else if (cmd == 0x2B)
+    {
+        if (param_idx == 0) ys = value;
+        if (param_idx == 1)
+        {
+            ye = value;
+            st7301_model_stats.windows++;
+        }
+    }
+    param_idx++;
+}
+
+void st7301_model_cs_begin(void)
+{
+    st7301_model_stats.cs_assertions++;
+}
+
+void st7301_model_write(uint8_t value, bool param)
+{
+    if (!state.powered) return;
+
+    if (param)
+    {
+        parameter(value);
+    }
+    else
+    {
+        command(value);
+        frame_cmds++;
+    }
+}
+
+void st7301_model_cs_end(void)
+{
+}
+
+uint8_t st7301_model_pixel(uint8_t x, uint8_t y)
+{
+    if (!state.powered) return 0xFF;
+    return ram[VIS_ROW0 + y][VIS_GROUP0 * 4 + x] >> 2;
+}
+
+void st7301_model_image(uint8_t img[ST7301_MODEL_H][ST7301_MODEL_W])
+{
+    for (int y = 0; y < ST7301_MODEL_H; y++)
+    {
+        for (int x = 0; x < ST7301_MODEL_W; x++)
+        {
+            img[y][x] = st7301_model_pixel(x, y);
+        }
+    }
+}
+
+int st7301_model_write_pgm(const char *path, uint8_t img[ST7301_MODEL_H][ST7301_MODEL_W])
+{
+    FILE *f = fopen(path, "wb");
+
+    if (f == NULL) return -1;
+    fprintf(f, "P5\n%d %d\n63\n", ST7301_MODEL_W, ST7301_MODEL_H);
+    fwrite(img, 1, ST7301_MODEL_W * ST7301_MODEL_H, f);
+    fclose(f);
+    return 0;
+}
+
+int st7301_model_write_ppm(const char *path, uint8_t img[ST7301_MODEL_H][ST7301_MODEL_W])
+{
+    FILE *f = fopen(path, "wb");
+
+    if (f == NULL) return -1;
+    fprintf(f, "P6\n%d %d\n255\n", ST7301_MODEL_W, ST7301_MODEL_H);
+    for (int y = 0; y < ST7301_MODEL_H; y++)
+    {
+        for (int x = 0; x < ST7301_MODEL_W; x++)
+        {
+            uint8_t c      = img[y][x];
+            uint8_t rgb[3] = {(uint8_t)((c & 3) * 85), (uint8_t)(((c >> 2) & 3) * 85), (uint8_t)(((c >> 4) & 3) * 85)};
+            fwrite(rgb, 1, 3, f);
+        }
+    }
+    fclose(f);
+    return 0;
+}
+
+int st7301_model_read_pgm(const char *path, uint8_t img[ST7301_MODEL_H][ST7301_MODEL_W])
+{
+    FILE *f = fopen(path, "rb");
+    int   w, h, maxval, ret = -1;
+
+    if (f == NULL) return -1;
+    if (fscanf(f, "P5 %d %d %d", &w, &h, &maxval) == 3 && w == ST7301_MODEL_W && h == ST7301_MODEL_H && fgetc(f) != EOF &&
+        fread(img, 1, ST7301_MODEL_W * ST7301_MODEL_H, f) == ST7301_MODEL_W * ST7301_MODEL_H)
+    {
+        ret = 0;
+    }
+    fclose(f);
+    return ret;
+}
@@ -0,0 +1,75 @@
+#ifndef __ST7301_MODEL_H__
+#define __ST7301_MODEL_H__
+
+/**
+ * ST7301 model: command parser, display RAM and power state.
+ *
+ * The RAM is addressed like the controller, 60 column groups of 4 pixels by
+ * 240 rows, one byte per pixel in the 64 colour mode (colour << 2). The panel
+ * shows column groups 8..51 and rows 64..239, i.e. the 176x176 image read by
+ * st7301_model_pixel(). RAM content is undefined after power up.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define ST7301_MODEL_W 176
+#define ST7301_MODEL_H 176
+
+typedef struct
+{
+    uint32_t cmd_bytes;      // command bytes (DC low)
+    uint32_t param_bytes;    // parameter bytes other than pixel data
+    uint32_t pixel_bytes;    // bytes written to RAM after 0x2C
+    uint32_t windows;        // column/row address pairs set
+    uint32_t pixels_changed; // visible pixels whose value changed
+    uint32_t cs_assertions;  // transfers, the SPIM asserts CS for each
+} st7301_model_stats_t;
+
+typedef struct
+{
+    bool     powered;
+    bool     sleep_out;  // 0x11 received
+    bool     display_on; // 0x29 received
+    uint8_t  power_mode; // 0x38 HPM or 0x39 LPM, 0 before either
+    uint64_t hpm_us;     // time powered in HPM
+    uint64_t lpm_us;     // time powered in LPM
+    uint32_t power_ups;
+} st7301_model_state_t;
+
+/** Statistics since the last st7301_model_stats_clear() */
+extern st7301_model_stats_t st7301_model_stats;
+
+void st7301_model_stats_clear(void);
+
+st7301_model_state_t st7301_model_state(void);
+
+/** Supply switched, RAM is filled with noise on power up */
+void st7301_model_power(bool on);
+
+/** RESX level, low resets the controller state (not the RAM) */
+void st7301_model_reset_pin(bool level);
+
+/** Start of an SPIM transfer, CS asserted */
+void st7301_model_cs_begin(void);
+
+/** One byte clocked in, param = DC level */
+void st7301_model_write(uint8_t value, bool param);
+
+/** End of an SPIM transfer, CS released */
+void st7301_model_cs_end(void);
+
+/** Visible pixel, 6-bit colour; 0xFF while unpowered */
+uint8_t st7301_model_pixel(uint8_t x, uint8_t y);
+
+/** Copy the visible image, 6-bit colour per byte */
+void st7301_model_image(uint8_t img[ST7301_MODEL_H][ST7301_MODEL_W]);
+
+/** Write an image as binary PGM (maxval 63, the 6-bit colour) or as PPM in RGB */
+int st7301_model_write_pgm(const char *path, uint8_t img[ST7301_MODEL_H][ST7301_MODEL_W]);
+int st7301_model_write_ppm(const char *path, uint8_t img[ST7301_MODEL_H][ST7301_MODEL_W]);
+
+/** Read a PGM written by st7301_model_write_pgm(), returns 0 on success */
+int st7301_model_read_pgm(const char *path, uint8_t img[ST7301_MODEL_H][ST7301_MODEL_W]);
+
+#endif // __ST7301_MODEL_H__
@@ -0,0 +1,227 @@
+/**
+ * Host harness of the UI, see ui_host.h. The application sources are included
+ * unmodified, this file replaces ui.o and ui_task.o in the tests linked with it.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+// the application sources rely on implicit declarations the Keil build accepts
+#include "cfg_fstorage.h"
+#include "user.h"
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wimplicit-function-declaration"
+#pragma GCC diagnostic ignored "-Wunused-but-set-variable"
+#pragma GCC diagnostic ignored "-Wmisleading-indentation"
+#pragma GCC diagnostic ignored "-Wimplicit-fallthrough"
+#include "ui.c"
+#include "ui_task.c"
+#pragma GCC diagnostic pop
+
+#include "nrf_delay.h"
+#include "sim.h"
+#include "ui_host.h"
+
+uint16_t ui_host_co2_ppm      = 0;
+uint32_t ui_host_getter_calls = 0;
+
+static bool     ui_host_active = false;
+static uint64_t draw_start_ns;
+
+/** Wrapped getters, -Wl,--wrap=<name> ************************************* */
+
+#define UI_HOST_GETTER(_type, _name)  \
+    _type __real_##_name(void);       \
+    _type __wrap_##_name(void)        \
+    {                                 \
+        ui_host_getter_calls++;       \
+        return __real_##_name();      \
+    }
+
+UI_HOST_GETTER(uint8_t, cfg_fstorage_get_ui_mode)
+UI_HOST_GETTER(uint16_t, cfg_fstorage_get_graph_max_value)
+UI_HOST_GETTER(uint16_t, cfg_fstorage_get_graph_min_value)
+UI_HOST_GETTER(uint16_t, cfg_fstorage_get_graph_yellow_start)
+UI_HOST_GETTER(uint16_t, cfg_fstorage_get_graph_red_start)
+UI_HOST_GETTER(uint8_t, cfg_fstorage_get_dnd_mode)
+UI_HOST_GETTER(uint8_t, cfg_fstorage_get_dnd_start_hour)
+UI_HOST_GETTER(uint8_t, cfg_fstorage_get_dnd_start_minute)
+UI_HOST_GETTER(uint8_t, cfg_fstorage_get_dnd_end_hour)
+UI_HOST_GETTER(uint8_t, cfg_fstorage_get_dnd_end_minute)
+UI_HOST_GETTER(uint8_t, cfg_fstorage_get_auto_calibrate)
+UI_HOST_GETTER(uint8_t, cfg_fstorage_get_flight_mode)
+
+uint16_t __real_get_co2_value(void);
+uint16_t __wrap_get_co2_value(void)
+{
+    return ui_host_active ? ui_host_co2_ppm : __real_get_co2_value();
+}
+
+/** Frames ***************************************************************** */
+
+void ui_host_init(void)
+{
+    sim_board_reset();
+    cfg_fstorage_init();
+    cfg_fstorage_load();
+    battery_state_update();
+    ui_host_active = true;
+
+    // task_ui: power up and configure the panel
+    lcd_gpio_init();
+    LCD_PWR_ON();
+    LCD_RESET_LOW();
+    nrf_delay_ms(20);
+    LCD_RESET_HIGH();
+    nrf_delay_ms(120);
+    spi_config(SPI_LCD);
+    st7301_config();
+    spi_config(SPI_NOT_USE);
+    update_elements_position(cfg_fstorage_get_ui_mode());
+    ui_refresh_invalidate();
+}
+
+void ui_host_begin(void)
+{
+    st7301_model_stats_clear();
+    memset(&sim_spi_stats, 0, sizeof(sim_spi_stats));
+    ui_host_getter_calls = 0;
+    draw_start_ns        = sim_host_ns();
+}
+
+ui_host_frame_t ui_host_flush(const ui_rect_t *rect)
+{
+    ui_host_frame_t f    = {0};
+    ui_rect_t       r    = *rect;
+    uint64_t        t_us, t_ns;
+    bool            done;
+
+    f.draw_ns = sim_host_ns() - draw_start_ns;
+
+    spi_config(SPI_LCD);
+    t_us = sim_now_us();
+    t_ns = sim_host_ns();
+    ui_refresh(&r);
+    done      = ui_refresh_done();
+    f.task_ns = sim_host_ns() - t_ns;
+    while (!done)
+    {
+        __WFE();
+        t_ns = sim_host_ns();
+        done = ui_refresh_done();
+        f.task_ns += sim_host_ns() - t_ns;
+    }
+    f.wall_us = sim_now_us() - t_us;
+    spi_config(SPI_NOT_USE);
+
+    f.pixels_changed = st7301_model_stats.pixels_changed;
+    f.pixel_bytes    = st7301_model_stats.pixel_bytes;
+    f.cmd_bytes      = st7301_model_stats.cmd_bytes + st7301_model_stats.param_bytes;
+    f.windows        = st7301_model_stats.windows;
+    f.rows           = refresh_rows_sent;
+    f.spi_transfers  = sim_spi_stats.transfers;
+    f.cs_toggles     = sim_spi_stats.lcd_cs_toggles;
+    f.spi_bytes      = sim_spi_stats.tx_bytes;
+    f.bus_us         = sim_spi_stats.bus_us;
+    f.isr_max_ns     = sim_spi_stats.isr_max_ns;
+    f.isr_total_ns   = sim_spi_stats.isr_total_ns;
+    f.dma_overwrites = sim_spi_stats.dma_overwrites;
+    f.busy_rejects   = sim_spi_stats.busy_rejects;
+    f.getter_calls   = ui_host_getter_calls;
+    return f;
+}
+
+/** ui.c internals ********************************************************* */
+
+uint8_t *ui_host_gram(void)
+{
+    return &gram[0][0];
+}
+
+void ui_host_blit(const ui_rect_t *rect, const uint8_t *pix, uint8_t rle, uint8_t op)
+{
+    ui_blit(rect, pix, rle, (ui_blit_op_t)op);
+}
+
+uint16_t ui_host_rle_decode(const uint8_t *rle, uint8_t *dst, uint16_t len)
+{
+    ui_rle_t decoder = {.src = rle};
+
+    while (len > 0)
+    {
+        uint8_t n = len > 255 ? 255 : (uint8_t)len;
+        ui_rle_read(&decoder, dst, n);
+        dst += n;
+        len -= n;
+    }
+    return (uint16_t)(decoder.src - rle) + decoder.high; // a started byte counts
+}
+
+void ui_host_color_update(void)
+{
+    ui_color_ctx_update();
+}
+
+void ui_host_render_row(uint8_t y, uint8_t *buf)
+{
+    ui_render_row(y, 0, LCD_WIDTH, buf);
+}
+
+/** ui_task.c internals **************************************************** */
+
+void ui_host_set_blink(ui_blink_t slc, ui_bool_t state)
+{
+    ui_blink_slc   = slc;
+    ui_blink_state = state;
+}
+
+ui_host_frame_t ui_host_blink_toggle(bool layer)
+{
+    ui_host_begin();
+    ui_blink_state = ui_blink_state == UI_BOOL_TRUE ? UI_BOOL_FALSE : UI_BOOL_TRUE;
+    if (layer && ui_draw_blink_layer(&blink_rows))
+    {
+        return ui_host_flush(&blink_rows);
+    }
+    ui_draw_main_page();
+    return ui_host_flush(&rect_full_screen);
+}
+
+/** Images ***************************************************************** */
+
+int ui_host_golden(const char *name)
+{
+    static uint8_t img[ST7301_MODEL_H][ST7301_MODEL_W];
+    static uint8_t ref[ST7301_MODEL_H][ST7301_MODEL_W];
+    char           path[128];
+    const char    *update = getenv("UI_GOLDEN_UPDATE");
+    int            diff   = 0;
+
+    st7301_model_image(img);
+    mkdir("build/ui", 0755);
+    snprintf(path, sizeof(path), "build/ui/%s.pgm", name);
+    st7301_model_write_pgm(path, img);
+    snprintf(path, sizeof(path), "build/ui/%s.ppm", name);
+    st7301_model_write_ppm(path, img);
+
+    snprintf(path, sizeof(path), "golden/%s.pgm", name);
+    if (update != NULL && strcmp(update, "1") == 0)
+    {
+        return st7301_model_write_pgm(path, img) == 0 ? 0 : -1;
+    }
+    if (st7301_model_read_pgm(path, ref) != 0)
+    {
+        return -1;
+    }
+    for (int y = 0; y < ST7301_MODEL_H; y++)
+    {
+        for (int x = 0; x < ST7301_MODEL_W; x++)
+        {
+            diff += img[y][x] != ref[y][x];
+        }
+    }
+    return diff;
+}
@@ -0,0 +1,95 @@
+#ifndef __UI_HOST_H__
+#define __UI_HOST_H__
+
+/**
+ * Host harness of the UI: lcd/ui.c and lcd/ui_task.c are compiled into
+ * ui_host.c, so the tests reach the canvas, the blitter and the blink state
+ * without the firmware exporting them. Frames are drawn by the test with the
+ * application's ui_draw_* functions and sent by ui_refresh() over the
+ * simulated SPIM to the ST7301 model, outside sim_run(): the application is
+ * not booted, only the panel is powered and configured as task_ui does.
+ *
+ * Tests linked with the harness get the cfg_fstorage_get_* getters and
+ * get_co2_value() wrapped (-Wl,--wrap, see the Makefile), the first are
+ * counted per frame, the second returns ui_host_co2_ppm once ui_host_init()
+ * has run.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "st7301_model.h"
+#include "ui.h"
+
+/** Canvas bytes per row */
+#define UI_HOST_STRIDE (LCD_WIDTH / 8)
+
+/** What one frame cost, from ui_host_begin() to the end of its refresh */
+typedef struct
+{
+    uint32_t pixels_changed; // visible pixels whose colour changed on the panel
+    uint32_t pixel_bytes;    // bytes written to display RAM
+    uint32_t cmd_bytes;      // command and parameter bytes
+    uint32_t windows;        // address windows set
+    uint32_t rows;           // display rows sent, whole or the window's columns
+    uint32_t spi_transfers;  // SPIM transactions, CS is asserted once for each
+    uint32_t cs_toggles;     // LCD chip select assertions counted by the SPIM
+    uint32_t spi_bytes;      // bytes clocked out
+    uint64_t bus_us;         // time the bus was clocking
+    uint64_t wall_us;        // from ui_refresh() to ui_refresh_done(), virtual time
+    uint64_t isr_max_ns;     // longest SPI event handler, host time
+    uint64_t isr_total_ns;   // all SPI event handlers, host time
+    uint64_t task_ns;        // ui_refresh() and ui_refresh_done() in the task, host time
+    uint32_t dma_overwrites; // send buffers changed while the SPIM was reading them
+    uint32_t busy_rejects;   // transfers started while the SPIM was busy
+    uint64_t draw_ns;        // drawing into the canvas, host time
+    uint32_t getter_calls;   // cfg_fstorage_get_* calls while drawing and refreshing
+} ui_host_frame_t;
+
+/** Page drawing of ui_task.c, not declared by ui.h */
+void ui_draw_main_page(void);
+void ui_draw_off_screen(void);
+
+/** CO2 value seen by the UI after ui_host_init() */
+extern uint16_t ui_host_co2_ppm;
+
+/** cfg_fstorage_get_* calls since the last ui_host_begin() */
+extern uint32_t ui_host_getter_calls;
+
+/** Reset the board, load the default configuration, power up and configure the panel */
+void ui_host_init(void);
+
+/** Start a frame: clear the counters, the drawing that follows is timed */
+void ui_host_begin(void);
+
+/** Refresh rect (ui_refresh() and ui_refresh_done() until done) and return the frame's counters */
+ui_host_frame_t ui_host_flush(const ui_rect_t *rect);
+
+/** Canvas, LCD_HIGHT rows of UI_HOST_STRIDE bytes, LSB is the leftmost pixel */
+uint8_t *ui_host_gram(void);
+
+/** ui_blit() with op 0 copy, 1 xor, 2 set, 3 clear */
+void ui_host_blit(const ui_rect_t *rect, const uint8_t *pix, uint8_t rle, uint8_t op);
+
+/** Decode len bytes of a run-length encoded bitmap with ui_rle_read(), returns the encoded bytes read */
+uint16_t ui_host_rle_decode(const uint8_t *rle, uint8_t *dst, uint16_t len);
+
+/** Update the frame's colour table as ui_refresh() does, then convert row y of the canvas into buf (LCD_WIDTH bytes) */
+void ui_host_color_update(void);
+void ui_host_render_row(uint8_t y, uint8_t *buf);
+
+/** Blink state of the main page, as the key handler of ui_task.c sets it */
+void ui_host_set_blink(ui_blink_t slc, ui_bool_t state);
+
+/**
+ * One blink timer tick the way task_ui handles it: the state flips and
+ * either only the blinking element is redrawn (layer) or the whole main page
+ */
+ui_host_frame_t ui_host_blink_toggle(bool layer);
+
+/** Write the panel image to build/ui/<name>.pgm and .ppm and compare it with golden/<name>.pgm,
+ *  returns the number of differing pixels, -1 without a golden image. With UI_GOLDEN_UPDATE=1 in
+ *  the environment the golden image is rewritten instead. */
+int ui_host_golden(const char *name);
+
+#endif // __UI_HOST_H__
@@ -0,0 +1,207 @@
+#include "zb25d16_model.h"
+
+#include <string.h>
+
+#include "sim.h"
+
+#define PAGE_SIZE (256)
+
+// datasheet typical times
+#define PAGE_PROGRAM_US (700)
+#define SECTOR_ERASE_US (45000)
+#define BLOCK32_ERASE_US (150000)
+#define BLOCK64_ERASE_US (200000)
+#define CHIP_ERASE_US   (8000000)
+
+zb25d16_model_stats_t zb25d16_model_stats;
+
+static uint8_t mem[ZB25D16_MODEL_SIZE];
+
+static bool     cs_low     = false;
+static bool     wel        = false;
+static bool     power_down = false;
+static uint64_t busy_until = 0;
+
+// current frame
+static uint8_t  cmd;
+static uint32_t pos; // bytes received in the frame
+static uint32_t addr;
+static uint32_t prog_count;
+
+void zb25d16_model_reset(void)
+{
+    memset(mem, 0xFF, sizeof(mem));
+    memset(&zb25d16_model_stats, 0, sizeof(zb25d16_model_stats));
+    cs_low     = false;
+    wel        = false;
+    power_down = false;
+    busy_until = 0;
+}
+
+uint8_t *zb25d16_model_mem(void)
+{
+    return mem;
+}
+
+bool zb25d16_model_busy(void)
+{
+    return sim_now_us() < busy_until;
+}
+
+bool zb25d16_model_powered_down(void)
+{
+    return power_down;
+}
+
+static void erase(uint32_t start, uint32_t len, uint32_t busy_us)
+{
+    start &= ~(len - 1);
+    memset(mem + start, 0xFF, len);
+    busy_until = sim_now_us() + busy_us;
+    wel        = false;
+    zb25d16_model_stats.erases++;
+    sim_tl_add(SIM_TL_FLASH_ERASE, start, len);
+}
+
+/** Frame ended, commands that act on CS high */
+static void frame_end(void)
+{
+    if (pos == 0) return;
+
+    zb25d16_model_stats.commands++;
+    switch (cmd)
+    {
+    case 0x06:
+        wel = true;
+        break;
+    case 0x04:
+        wel = false;
+        break;
+    case 0xB9:
+        power_down = true;
+        zb25d16_model_stats.power_downs++;
+        break;
+    case 0x20:
+        if (pos >= 4) erase(addr, 4096, SECTOR_ERASE_US);
+        break;
+    case 0x52:
+        if (pos >= 4) erase(addr, 32768, BLOCK32_ERASE_US);
+        break;
+    case 0xD8:
+        if (pos >= 4) erase(addr, 65536, BLOCK64_ERASE_US);
+        break;
+    case 0xC7:
+    case 0x60:
+        erase(0, ZB25D16_MODEL_SIZE, CHIP_ERASE_US);
+        break;
+    case 0x02:
+        if (prog_count != 0)
+        {
+            busy_until = sim_now_us() + PAGE_PROGRAM_US;
+            zb25d16_model_stats.programs++;
+            zb25d16_model_stats.program_bytes += prog_count;
+            sim_tl_add(SIM_TL_FLASH_PROG, addr, prog_count);
+        }
+        wel = false;
+        break;
+    case 0x03:
+    case 0x0B:
+        zb25d16_model_stats.reads++;
+        zb25d16_model_stats.read_bytes += pos - (cmd == 0x03 ? 4 : 5);
+        sim_tl_add(SIM_TL_FLASH_READ, addr, pos - (cmd == 0x03 ? 4 : 5));
+        break;
+    default:
+        break;
+    }
+}
+
+void zb25d16_model_cs(bool level)
+{
+    if (level == !cs_low) return;
+
+    cs_low = !level;
+    if (cs_low)
+    {
+        pos        = 0;
+        prog_count = 0;
+        return;
+    }
+    frame_end();
+}
+
+/** Whether the frame that starts with this byte is executed */
+static bool accepted(uint8_t first)
+{
+    if (power_down) return first == 0xAB;
+    if (zb25d16_model_busy()) return first == 0x05;
+    switch (first)
+    {
+    case 0x02:
+    case 0x20:
+    case 0x52:
+    case 0xD8:
+    case 0xC7:
+    case 0x60:
+        return wel;
+    default:
+        return true;
+    }
+}
+
+uint8_t zb25d16_model_xfer(uint8_t mosi)
+{
+    uint8_t miso = 0xFF;
+
+    if (!cs_low) return miso;
+
+    if (pos == 0)
+    {
+        cmd = mosi;
+        if (!accepted(cmd))
+        {
+            zb25d16_model_stats.ignored++;
+            cmd = 0; // the rest of the frame is ignored
+        }
+        if (cmd == 0xAB) power_down = false;
+        if (cmd == 0x05) zb25d16_model_stats.status_polls++;
+        addr = 0;
+        pos++;
+        return miso;
+    }
+
+    switch (cmd)
+    {
+    case 0x05:
+        miso = (zb25d16_model_busy() ? 0x01 : 0) | (wel ? 0x02 : 0);
+        break;
+    case 0x03:
+    case 0x0B:
+    case 0x02:
+    case 0x20:
+    case 0x52:
+    case 0xD8:
+        if (pos <= 3)
+        {
+            addr = (addr << 8) | mosi;
+            addr &= ZB25D16_MODEL_SIZE - 1;
+            break;
+        }
+        if (cmd == 0x03 || (cmd == 0x0B && pos >= 5))
+        {
+            uint32_t offset = pos - (cmd == 0x03 ? 4 : 5);
+            miso            = mem[(addr + offset) & (ZB25D16_MODEL_SIZE - 1)];
+        }
+        else if (cmd == 0x02)
+        {
+            // wraps inside the page like the real part
+            uint32_t a = (addr & ~(PAGE_SIZE - 1)) | ((addr + prog_count) & (PAGE_SIZE - 1));
+            mem[a] &= mosi;
+            prog_count++;
+        }
+        break;
+    default:
+        break;
+    }
+    pos++;
+    return miso;
+}
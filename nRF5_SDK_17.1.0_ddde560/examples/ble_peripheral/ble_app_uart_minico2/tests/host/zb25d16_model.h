@@ -0,0 +1,47 @@
+#ifndef __ZB25D16_MODEL_H__
+#define __ZB25D16_MODEL_H__
+
+/**
+ * ZB25D16 model: 2 MB NOR array behind the SPI command set used by zb25d16.c.
+ *
+ * Programming can only clear bits, erases set them back to 0xFF. Program and
+ * erase need WEL, take the datasheet typical time during which only RDSR is
+ * answered, and clear WEL. In deep power down everything but 0xAB is ignored.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define ZB25D16_MODEL_SIZE (2 * 1024 * 1024)
+
+typedef struct
+{
+    uint32_t commands;       // CS frames with at least one byte
+    uint32_t reads;          // 0x03/0x0B frames
+    uint32_t read_bytes;
+    uint32_t programs;       // accepted 0x02 frames
+    uint32_t program_bytes;
+    uint32_t erases;         // accepted sector, block and chip erases
+    uint32_t status_polls;   // 0x05 frames
+    uint32_t ignored;        // frames dropped: busy, no WEL or powered down
+    uint32_t power_downs;
+} zb25d16_model_stats_t;
+
+extern zb25d16_model_stats_t zb25d16_model_stats;
+
+/** Erase the whole array and clear state and statistics */
+void zb25d16_model_reset(void);
+
+/** Chip select level */
+void zb25d16_model_cs(bool level);
+
+/** One byte exchanged while CS is low, returns the byte driven on MISO */
+uint8_t zb25d16_model_xfer(uint8_t mosi);
+
+/** Direct access to the array for tests */
+uint8_t *zb25d16_model_mem(void);
+
+bool zb25d16_model_busy(void);
+bool zb25d16_model_powered_down(void);
+
+#endif // __ZB25D16_MODEL_H__
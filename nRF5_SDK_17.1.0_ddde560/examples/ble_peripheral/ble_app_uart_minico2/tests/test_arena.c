@@ -0,0 +1,67 @@
+/**
+ * Arena ownership and allocation, called directly as the history tasks do
+ * (TaskWait(arena_begin(...)) polls once per scheduler pass). Checked:
+ *
+ *   - a history upload is refused while the boot recovery owns the arena
+ *   - the upload polling for POLLS passes is counted as one conflict, a new
+ *     wait after it got the arena counts again
+ *   - the upload gets the arena once the recovery ends it, a phase that does
+ *     not own the arena can neither allocate from it nor release it
+ *   - allocations are 4-byte aligned, the one that would pass ARENA_SIZE
+ *     returns NULL and the high-water mark stays at the largest total
+ */
+
+#include <stdint.h>
+
+#include "arena.h"
+#include "check.h"
+
+#define POLLS 50
+
+int main(void)
+{
+    uint8_t *a, *b, *c;
+
+    // boot: the recovery takes the arena for its page
+    CHECK(arena_begin(ARENA_PHASE_HISTORY_RECOVER), "recovery refused on a free arena");
+    CHECK(arena_begin(ARENA_PHASE_HISTORY_RECOVER), "recovery refused the arena it owns");
+    a = arena_alloc(ARENA_PHASE_HISTORY_RECOVER, 130);
+    CHECK(a != NULL && ((uintptr_t)a & 3) == 0, "recovery allocation %p", (void *)a);
+
+    // a central asks for the history meanwhile, the upload task polls
+    for (uint8_t i = 0; i < POLLS; i++)
+    {
+        CHECK(!arena_begin(ARENA_PHASE_HISTORY_UPLOAD), "upload took the arena from the recovery, poll %u", i);
+    }
+    CHECK(arena_get_conflicts() == 1, "%u conflicts counted for one wait", arena_get_conflicts());
+    CHECK(arena_alloc(ARENA_PHASE_HISTORY_UPLOAD, 4) == NULL, "upload allocated without owning the arena");
+    arena_end(ARENA_PHASE_HISTORY_UPLOAD);
+    CHECK(arena_get_phase() == ARENA_PHASE_HISTORY_RECOVER, "upload released the recovery's arena");
+
+    // the recovery allocates up to the end of the pool, one byte more fails
+    b = arena_alloc(ARENA_PHASE_HISTORY_RECOVER, 61);
+    CHECK(b == a + 132, "second allocation at %+d, expected +132", (int)(b - a));
+    c = arena_alloc(ARENA_PHASE_HISTORY_RECOVER, ARENA_SIZE - 132 - 64);
+    CHECK(c == a + 196, "third allocation at %+d, expected +196", (int)(c - a));
+    CHECK(arena_alloc(ARENA_PHASE_HISTORY_RECOVER, 1) == NULL, "allocation past ARENA_SIZE succeeded");
+    CHECK(arena_get_high_water() == ARENA_SIZE, "high water %u, expected %u", arena_get_high_water(), ARENA_SIZE);
+    arena_end(ARENA_PHASE_HISTORY_RECOVER);
+
+    // the upload gets it now, from the start of the pool
+    CHECK(arena_begin(ARENA_PHASE_HISTORY_UPLOAD), "upload refused after the recovery ended");
+    CHECK(arena_alloc(ARENA_PHASE_HISTORY_UPLOAD, 100) == a, "upload allocation not at the start of the pool");
+    CHECK(arena_alloc(ARENA_PHASE_HISTORY_UPLOAD, ARENA_SIZE) == NULL, "oversized allocation succeeded");
+    CHECK(arena_get_high_water() == ARENA_SIZE, "high water changed to %u", arena_get_high_water());
+
+    // a fake record request while uploading is a new wait
+    CHECK(!arena_begin(ARENA_PHASE_FAKE_RECORDS), "fake records took the upload's arena");
+    CHECK(!arena_begin(ARENA_PHASE_FAKE_RECORDS), "fake records took the upload's arena");
+    CHECK(arena_get_conflicts() == 2, "%u conflicts, expected 2", arena_get_conflicts());
+    arena_end(ARENA_PHASE_HISTORY_UPLOAD);
+    CHECK(arena_begin(ARENA_PHASE_FAKE_RECORDS), "fake records refused a free arena");
+    arena_end(ARENA_PHASE_FAKE_RECORDS);
+    CHECK(arena_get_phase() == ARENA_PHASE_NONE, "arena owned by %d after all phases ended", arena_get_phase());
+
+    printf("conflicts %u, high water %u/%u\n", arena_get_conflicts(), arena_get_high_water(), ARENA_SIZE);
+    return check_failures();
+}
@@ -0,0 +1,172 @@
+/**
+ * Adaptive sample interval of MID and LOW (co2_adapt_interval) replayed on
+ * the simulator against the fixed interval of the mode. Each waveform runs
+ * twice per mode on the SCD4x model, once with the bounds set to the mode's
+ * fixed interval and once with the adaptive defaults. Per run the table shows
+ * the samples taken, the sensor charge (scd4x_model_charge_uas) and the
+ * largest and the mean difference between the value shown (get_co2_value,
+ * checked every second) and the concentration at the sensor.
+ *
+ * Checked per waveform and mode: the adaptive run takes fewer samples and
+ * less charge. Its largest error stays within the steepest slope of the
+ * waveform times the longest interval plus ERROR_SLACK_PPM: after a flat
+ * stretch the first sample of a change comes up to one longest interval late,
+ * from then on the interval follows the slope.
+ */
+
+#include <stdlib.h>
+
+#include "check.h"
+#include "co2.h"
+#include "scd4x_model.h"
+#include "sim.h"
+
+#define S(s)   ((uint64_t)(s) * 1000000)
+
+#define SETTLE_S        (10 * 60)
+#define ERROR_SLACK_PPM 25 // noise, rounding and the 5 s of a single shot
+
+typedef struct
+{
+    const char *name;
+    uint32_t    duration_s;
+    uint32_t    max_slope;   // ppm per minute, rounded up
+    uint16_t (*ppm)(uint32_t s); // concentration s seconds into the run, flat before it
+} wave_t;
+
+typedef struct
+{
+    uint32_t samples;
+    double   charge_mas;
+    uint32_t max_error;
+    double   mean_error;
+} result_t;
+
+/** Repeatability of the sensor, +-5 ppm, the same sequence every run */
+static int16_t noise(uint32_t s)
+{
+    uint32_t h = s * 2654435761u;
+
+    return (int16_t)((h >> 16) % 11) - 5;
+}
+
+/** An office day from midnight: 450 ppm, up to 1400 ppm from 8:00 to 9:00, held until 14:00, aired out by 17:00 */
+static uint16_t office(uint32_t s)
+{
+    if (s < 8 * 3600) return 450;
+    if (s < 9 * 3600) return (uint16_t)(450 + (s - 8 * 3600) * 950 / 3600);
+    if (s < 14 * 3600) return 1400;
+    if (s < 17 * 3600) return (uint16_t)(1400 - (s - 14 * 3600) * 950 / (3 * 3600));
+    return 450;
+}
+
+/** A meeting room at 1200 ppm, a window opened at 1 h for 15 min: down 60 ppm/min to 500 ppm, back up 10 ppm/min */
+static uint16_t window(uint32_t s)
+{
+    uint32_t t = s - 3600;
+
+    if (s < 3600) return 1200;
+    if (t < 15 * 60) return (uint16_t)(t < 700 ? 1200 - t : 500);
+    return (uint16_t)(500 + (t - 15 * 60) / 6 < 1200 ? 500 + (t - 15 * 60) / 6 : 1200);
+}
+
+static const wave_t waves[] = {
+    {"office", 24 * 3600, 16, office},
+    {"window", 12 * 3600, 60, window},
+};
+
+static const wave_t *wave;
+static uint64_t      wave_start_us;
+
+static uint16_t model_co2(uint64_t t_us)
+{
+    uint32_t s = t_us > wave_start_us ? (uint32_t)((t_us - wave_start_us) / 1000000) : 0;
+
+    return (uint16_t)(wave->ppm(s) + noise((uint32_t)(t_us / 1000000)));
+}
+
+static uint32_t samples(void)
+{
+    return sim_tl_count_type(SIM_TL_CO2_SAMPLE);
+}
+
+static result_t replay(const wave_t *w, power_mode_t mode, uint16_t min_s, uint16_t max_s)
+{
+    result_t r = {0};
+    uint32_t samples0;
+    double   charge0;
+    double   error_sum = 0;
+
+    // settle on the starting level with the bounds of the run
+    wave          = w;
+    wave_start_us = UINT64_MAX;
+    CHECK(set_co2_interval_bounds(mode, min_s, max_s) == 0, "bounds %u..%u s rejected", min_s, max_s);
+    set_power_mode(mode);
+    sim_run(S(SETTLE_S));
+
+    wave_start_us = sim_now_us();
+    samples0      = samples();
+    charge0       = scd4x_model_charge_uas();
+    for (uint32_t s = 0; s < w->duration_s; s++)
+    {
+        uint32_t error;
+
+        CHECK(sim_run(S(1)) == SIM_EXIT_TIME, "%s: run stopped at %u s", w->name, s);
+        error = (uint32_t)abs((int)get_co2_value() - (int)w->ppm(s + 1));
+        error_sum += error;
+        if (error > r.max_error) r.max_error = error;
+    }
+    r.samples    = samples() - samples0;
+    r.charge_mas = (scd4x_model_charge_uas() - charge0) / 1000;
+    r.mean_error = error_sum / w->duration_s;
+    return r;
+}
+
+static void print_result(const char *wave_name, const char *mode, const char *interval, const result_t *r)
+{
+    printf("%-8s %-4s %-10s %8u %10.0f %10u %10.1f\n", wave_name, mode, interval, r->samples, r->charge_mas,
+           r->max_error, r->mean_error);
+}
+
+int main(void)
+{
+    static const struct
+    {
+        power_mode_t mode;
+        const char  *name;
+        uint16_t     fixed_s, min_s, max_s;
+    } modes[] = {
+        {PWR_MODE_MID, "MID", 60, CO2_ADAPT_MID_MIN_MS / 1000, CO2_ADAPT_MID_MAX_MS / 1000},
+        {PWR_MODE_LOW, "LOW", 180, CO2_ADAPT_LOW_MIN_MS / 1000, CO2_ADAPT_LOW_MAX_MS / 1000},
+    };
+
+    wave            = &waves[0];
+    wave_start_us   = UINT64_MAX;
+    scd4x_model_co2 = model_co2;
+    CHECK(sim_boot() == SIM_EXIT_TIME, "boot failed");
+
+    printf("%-8s %-4s %-10s %8s %10s %10s %10s\n", "wave", "mode", "interval", "samples", "charge mAs", "max ppm",
+           "mean ppm");
+    for (uint8_t w = 0; w < sizeof(waves) / sizeof(waves[0]); w++)
+    {
+        for (uint8_t m = 0; m < sizeof(modes) / sizeof(modes[0]); m++)
+        {
+            result_t fixed    = replay(&waves[w], modes[m].mode, modes[m].fixed_s, modes[m].fixed_s);
+            result_t adaptive = replay(&waves[w], modes[m].mode, modes[m].min_s, modes[m].max_s);
+
+            print_result(waves[w].name, modes[m].name, "fixed", &fixed);
+            print_result(waves[w].name, modes[m].name, "adaptive", &adaptive);
+
+            CHECK(adaptive.samples < fixed.samples, "%s %s: %u adaptive samples, %u fixed", waves[w].name,
+                  modes[m].name, adaptive.samples, fixed.samples);
+            CHECK(adaptive.charge_mas < fixed.charge_mas, "%s %s: adaptive %.0f mAs, fixed %.0f mAs", waves[w].name,
+                  modes[m].name, adaptive.charge_mas, fixed.charge_mas);
+            CHECK(adaptive.max_error <= waves[w].max_slope * modes[m].max_s / 60 + ERROR_SLACK_PPM,
+                  "%s %s: adaptive error up to %u ppm, fixed %u ppm", waves[w].name, modes[m].name,
+                  adaptive.max_error, fixed.max_error);
+        }
+    }
+
+    CHECK(sim_tl_count_type(SIM_TL_ERROR) == 0 && sim_tl_count_type(SIM_TL_RESET) == 0, "error or reset");
+    return check_failures();
+}
@@ -0,0 +1,239 @@
+/**
+ * ASC across resets (asc_resume), WEEKS weeks of readings every INTERVAL_S.
+ * The device boots once to enable ASC, then readings go to
+ * asc_process_reading and asc_check_daily_update(true) runs at 23:59 the way
+ * task_co2_read and user.c call them. The sensor reads a floor of
+ * CO2_CALIB_TARGET at night plus an offset drifting DRIFT_PPM_DAY a day, and
+ * +-NOISE_PPM; the CC of the device is added as co2.c adds it. A reset reloads
+ * the CC from flash and calls asc_resume with the retained state; the test
+ * links co2.c with asc_state and co2_ctx made global (Makefile) to compare and
+ * corrupt them.
+ *
+ * Runs against the uninterrupted one:
+ *   - RESETS_PER_DAY resets at random readings: the state resumes unchanged,
+ *     the CC and the baseline are the same every day
+ *   - the same with the reading in flight lost at each reset: no day is
+ *     dropped, the CC stays within LOSSY_PPM
+ *   - a bit flipped in the retained state on CORRUPT_DAY: the resume starts a
+ *     new period with the CC kept, the next adjustment comes ASC_WINDOW_DAYS
+ *     full days later (the half day left has too few readings to count) and
+ *     the error is back within the bound of the others
+ *
+ * The error (CC + offset) after every weekly adjustment stays within a week of
+ * drift plus the noise and ERROR_SLACK_PPM. A retained state with a valid CRC
+ * but a field out of range is rejected as well. Printed: the CC of every run
+ * at the end of each week.
+ */
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "check.h"
+#include "co2.h"
+#include "crc16.h"
+#include "sim.h"
+
+#define WEEKS           6
+#define DAYS            (WEEKS * 7)
+#define INTERVAL_S      210
+#define OFFSET0_PPM     40
+#define DRIFT_PPM_DAY   1
+#define NOISE_PPM       5
+#define RESETS_PER_DAY  3
+#define LOSSY_PPM       2
+#define CORRUPT_DAY     10
+#define ERROR_SLACK_PPM 3
+
+#define DAY_S (24 * 3600)
+
+extern asc_state_t asc_state;
+extern co2_ctx_t   co2_ctx;
+
+typedef struct
+{
+    int16_t  cc[DAYS];       // at the end of the day
+    uint16_t baseline[DAYS]; // lowest daily low of the window, UINT16_MAX without one
+    uint8_t  day_count[DAYS];
+    uint32_t resets;
+    uint32_t lost;
+} run_t;
+
+/** Concentration at the sensor: CO2_CALIB_TARGET at night, occupied from 8:00 to 18:00 */
+static uint16_t true_ppm(uint32_t s)
+{
+    if (s < 7 * 3600 || s >= 20 * 3600) return CO2_CALIB_TARGET;
+    if (s < 9 * 3600) return (uint16_t)(CO2_CALIB_TARGET + (s - 7 * 3600) * 500 / (2 * 3600));
+    if (s < 18 * 3600) return CO2_CALIB_TARGET + 500;
+    return (uint16_t)(CO2_CALIB_TARGET + 500 - (s - 18 * 3600) * 500 / (2 * 3600));
+}
+
+/** Sensor noise of reading n, the same sequence in every run */
+static int16_t noise(uint32_t n)
+{
+    uint32_t h = n * 2654435761u;
+
+    return (int16_t)((h >> 16) % (2 * NOISE_PPM + 1)) - NOISE_PPM;
+}
+
+static int16_t offset(uint32_t day)
+{
+    return (int16_t)(OFFSET0_PPM + DRIFT_PPM_DAY * day);
+}
+
+static uint16_t baseline(void)
+{
+    uint16_t b = UINT16_MAX;
+
+    for (uint8_t i = 0; i < asc_state.daily_count; i++)
+    {
+        if (asc_state.daily_low[i] < b) b = asc_state.daily_low[i];
+    }
+    return b;
+}
+
+/** Reset: the CC comes back from flash, the retained ASC state is resumed */
+static void reset(void)
+{
+    co2_ctx.cc_value = cfg_fstorage_get_cc();
+    asc_resume();
+}
+
+static void run(run_t *r, uint8_t resets_per_day, bool lose, uint32_t corrupt_day)
+{
+    uint32_t rng = 4242;
+    uint32_t n   = 0;
+
+    memset(r, 0, sizeof(*r));
+    co2_ctx.cc_value = 0;
+    cfg_fstorage_set_cc(0);
+    asc_init();
+
+    for (uint32_t day = 0; day < DAYS; day++)
+    {
+        uint32_t reset_at[RESETS_PER_DAY];
+
+        for (uint8_t i = 0; i < resets_per_day; i++)
+        {
+            rng         = rng * 1103515245 + 12345;
+            reset_at[i] = (rng >> 16) % (DAY_S - 60);
+        }
+        for (uint32_t s = 0; s < DAY_S - 60; s += INTERVAL_S, n++)
+        {
+            bool lost = false;
+
+            for (uint8_t i = 0; i < resets_per_day; i++)
+            {
+                if (reset_at[i] >= s && reset_at[i] < s + INTERVAL_S)
+                {
+                    asc_state_t before = asc_state;
+
+                    reset();
+                    CHECK(memcmp(&before, &asc_state, sizeof(asc_state)) == 0, "day %u: state changed by the resume",
+                          day);
+                    r->resets++;
+                    lost |= lose;
+                }
+            }
+            if (day == corrupt_day && s / INTERVAL_S == DAY_S / 2 / INTERVAL_S)
+            {
+                int16_t cc = co2_ctx.cc_value;
+
+                asc_state.day_lows[0] ^= 0x40;
+                reset();
+                CHECK(asc_state.day_count == 0 && asc_state.daily_count == 0 && asc_state.day_low_count == 0 &&
+                          asc_state.day_record_count == 0,
+                      "corrupted state resumed: day %u, %u daily lows", asc_state.day_count, asc_state.daily_count);
+                CHECK(co2_ctx.cc_value == cc, "CC %d changed to %d by the new period", cc, co2_ctx.cc_value);
+            }
+            if (lost)
+            {
+                r->lost++;
+                continue;
+            }
+            asc_process_reading((uint16_t)(true_ppm(s) + offset(day) + co2_ctx.cc_value + noise(n)));
+        }
+        asc_check_daily_update(true);
+
+        r->cc[day]        = co2_ctx.cc_value;
+        r->baseline[day]  = baseline();
+        r->day_count[day] = asc_state.day_count;
+    }
+}
+
+static void check_accuracy(const run_t *r, const char *name, uint32_t first_day)
+{
+    for (uint32_t day = first_day; day < DAYS; day++)
+    {
+        int16_t error = (int16_t)(r->cc[day] + offset(day));
+
+        if (r->day_count[day] != 0) continue; // the CC moves at the end of a period
+        CHECK(abs(error) <= 7 * DRIFT_PPM_DAY + NOISE_PPM + ERROR_SLACK_PPM, "%s: error %+d ppm after day %u", name,
+              error, day);
+    }
+}
+
+/** A state with a valid CRC but a field out of range starts a new period */
+static void check_range(void)
+{
+    asc_init();
+    asc_state.day_count  = 3;
+    asc_state.daily_head = ASC_WINDOW_DAYS;
+    asc_state.crc        = crc16_compute((const uint8_t *)&asc_state, offsetof(asc_state_t, crc), NULL);
+    asc_resume();
+    CHECK(asc_state.daily_head == 0 && asc_state.day_count == 0, "daily head %u resumed", asc_state.daily_head);
+
+    asc_state.day_count = 3;
+    asc_state.crc       = crc16_compute((const uint8_t *)&asc_state, offsetof(asc_state_t, crc), NULL);
+    asc_resume();
+    CHECK(asc_state.day_count == 3, "valid state not resumed");
+}
+
+int main(void)
+{
+    static run_t ref, resets, lossy, corrupt;
+
+    CHECK(sim_boot() == SIM_EXIT_TIME, "boot failed");
+    co2_set_self_calibration(1);
+
+    check_range();
+    run(&ref, 0, false, UINT32_MAX);
+    run(&resets, RESETS_PER_DAY, false, UINT32_MAX);
+    run(&lossy, RESETS_PER_DAY, true, UINT32_MAX);
+    run(&corrupt, 0, false, CORRUPT_DAY);
+
+    printf("%-5s %7s %9s %9s %9s %9s %9s\n", "week", "offset", "baseline", "cc", "resets", "lost", "corrupted");
+    for (uint32_t day = 6; day < DAYS; day += 7)
+    {
+        printf("%-5u %+7d %9u %+9d %+9d %+9d %+9d\n", day / 7 + 1, offset(day), ref.baseline[day], ref.cc[day],
+               resets.cc[day], lossy.cc[day], corrupt.cc[day]);
+    }
+    printf("%u resets, %u readings lost\n", resets.resets + lossy.resets, lossy.lost);
+
+    for (uint32_t day = 0; day < DAYS; day++)
+    {
+        CHECK(resets.cc[day] == ref.cc[day] && resets.baseline[day] == ref.baseline[day] &&
+                  resets.day_count[day] == ref.day_count[day],
+              "day %u with resets: CC %d baseline %u, uninterrupted %d %u", day, resets.cc[day], resets.baseline[day],
+              ref.cc[day], ref.baseline[day]);
+        CHECK(abs(lossy.cc[day] - ref.cc[day]) <= LOSSY_PPM && lossy.day_count[day] == ref.day_count[day],
+              "day %u with readings lost: CC %d day %u, uninterrupted %d day %u", day, lossy.cc[day],
+              lossy.day_count[day], ref.cc[day], ref.day_count[day]);
+    }
+    CHECK(resets.resets > DAYS * RESETS_PER_DAY * 9 / 10, "%u resets", resets.resets);
+
+    // the corrupted period restarts on CORRUPT_DAY, whose half of the readings is not a day of the window
+    for (uint32_t day = CORRUPT_DAY; day < CORRUPT_DAY + ASC_WINDOW_DAYS; day++)
+    {
+        CHECK(corrupt.cc[day] == corrupt.cc[CORRUPT_DAY - 1], "corrupted: CC moved on day %u", day);
+    }
+    CHECK(corrupt.day_count[CORRUPT_DAY + ASC_WINDOW_DAYS] == 0 &&
+              corrupt.cc[CORRUPT_DAY + ASC_WINDOW_DAYS] != corrupt.cc[CORRUPT_DAY - 1],
+          "corrupted: no adjustment %u full days after the new period", ASC_WINDOW_DAYS);
+
+    check_accuracy(&ref, "uninterrupted", ASC_WINDOW_DAYS - 1);
+    check_accuracy(&lossy, "readings lost", ASC_WINDOW_DAYS - 1);
+    check_accuracy(&corrupt, "corrupted", CORRUPT_DAY + ASC_WINDOW_DAYS);
+
+    return check_failures();
+}
@@ -0,0 +1,182 @@
+/**
+ * Manual calibration (calib_add_reading) on the simulator with sensor error:
+ * outdoors at CO2_CALIB_TARGET, the SCD4x model reads with a fixed offset and
+ * uniform noise (scd4x_model_offset_ppm / scd4x_model_noise_ppm). Every run
+ * starts the calibration with CMD_CALIB_START from the central and lasts until
+ * ui_task ends it, converged or at the end of its countdown. Default power
+ * mode (LOW), so the countdown is the long one.
+ *
+ * Checked per run:
+ *   - the new correction cancels the offset to within three standard errors
+ *     of the mean (get_co2_calib_confidence) plus one for rounding
+ *   - at least CO2_CALIB_SKIP_SAMPLES + CO2_CALIB_MIN_SAMPLES readings are
+ *     taken, at most one per 5 s period of the countdown plus MAX_EXTRA
+ *   - up to CONVERGING_NOISE_PPM of noise it converges before the countdown
+ *     ends, and the value shown afterwards is back at the target
+ *
+ * Printed: a row per run, then the duration and readings per noise level
+ * (min / mean / max over the offsets).
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "check.h"
+#include "co2.h"
+#include "protocol.h"
+#include "scd4x_model.h"
+#include "sim.h"
+#include "ttask.h"
+
+extern int16_t get_cc_value(void);
+
+#define S(s) ((uint64_t)(s) * 1000000)
+
+#define COUNTDOWN_S          541 // ui_task, LOW mode
+#define PERIOD_S             5   // periodic measurement
+#define MAX_EXTRA            3   // the reading in flight when the countdown ends, start up
+#define CONVERGING_NOISE_PPM 20
+#define AFTER_S              (10 * 60)
+
+#define SCD4X_CMD_READ_MEASUREMENT 0xEC05
+
+static const int16_t  offsets[] = {-60, -25, 0, 35, 80};
+static const uint16_t noises[]  = {0, 5, 10, 20, 80};
+
+typedef struct
+{
+    uint32_t duration_s;
+    uint32_t readings;
+    int16_t  error;       // correction + offset
+    uint16_t confidence;  // 0.1 ppm
+    bool     converged;
+    uint16_t shown;       // value shown AFTER_S later
+} run_t;
+
+static uint16_t outdoors(uint64_t t_us)
+{
+    (void)t_us;
+    return CO2_CALIB_TARGET;
+}
+
+static void send_command(uint8_t cmd, const uint8_t *payload, uint8_t len)
+{
+    uint8_t  frame[32] = {CMD_FIRST_BYTE, CMD_SECOND_BYTE, cmd, len};
+    uint32_t sum       = 0;
+
+    memcpy(frame + 4, payload, len);
+    for (uint8_t i = 0; i < 4 + len; i++)
+    {
+        sum += frame[i];
+    }
+    frame[4 + len] = (uint8_t)sum;
+    sim_nus_rx(frame, (uint16_t)(5 + len));
+}
+
+static bool calibrating(void)
+{
+    return EventGroupCheckBits(event_group_system, EVT_CO2_CALIB_START | EVT_CO2_CALIB_TIMING | EVT_CO2_CALIB_DONE);
+}
+
+static run_t calibrate(int16_t offset, uint16_t noise, uint32_t seed)
+{
+    run_t    r = {0};
+    uint32_t readings0;
+    uint32_t s;
+
+    scd4x_model_offset_ppm = offset;
+    scd4x_model_noise_ppm  = noise;
+    scd4x_model_noise_seed = seed;
+
+    send_command(CMD_CALIB_START, NULL, 0);
+    for (s = 0; s < 60 && !EventGroupCheckBits(event_group_system, EVT_CO2_CALIB_TIMING); s++)
+    {
+        sim_run(S(1));
+    }
+    CHECK(s < 60, "offset %d, noise %u: calibration did not start", offset, noise);
+
+    readings0 = scd4x_model_cmd_count(SCD4X_CMD_READ_MEASUREMENT);
+    while (EventGroupCheckBits(event_group_system, EVT_CO2_CALIB_TIMING) && r.duration_s < 2 * COUNTDOWN_S)
+    {
+        sim_run(S(1));
+        r.duration_s++;
+    }
+    r.readings   = scd4x_model_cmd_count(SCD4X_CMD_READ_MEASUREMENT) - readings0;
+    r.converged  = is_co2_calib_converged();
+    r.confidence = get_co2_calib_confidence();
+
+    for (s = 0; s < 60 && calibrating(); s++)
+    {
+        sim_run(S(1));
+    }
+    CHECK(!calibrating(), "offset %d, noise %u: calibration did not end", offset, noise);
+    r.error = (int16_t)(get_cc_value() + offset);
+
+    sim_run(S(AFTER_S));
+    r.shown = get_co2_value();
+    return r;
+}
+
+typedef struct
+{
+    uint32_t min, max, sum;
+} dist_t;
+
+static void dist_add(dist_t *d, uint32_t v)
+{
+    if (d->sum == 0 || v < d->min) d->min = v;
+    if (v > d->max) d->max = v;
+    d->sum += v;
+}
+
+#define OFFSETS (sizeof(offsets) / sizeof(offsets[0]))
+#define NOISES  (sizeof(noises) / sizeof(noises[0]))
+
+int main(void)
+{
+    dist_t duration[NOISES] = {0}, readings[NOISES] = {0};
+
+    scd4x_model_co2 = outdoors;
+    CHECK(sim_boot() == SIM_EXIT_TIME, "boot failed");
+    sim_run(S(10 * 60));
+
+    printf("%-7s %-8s %9s %9s %8s %10s %9s %6s\n", "offset", "noise", "duration", "readings", "error", "confidence",
+           "converged", "shown");
+    for (uint8_t n = 0; n < NOISES; n++)
+    {
+        for (uint8_t o = 0; o < OFFSETS; o++)
+        {
+            run_t    r     = calibrate(offsets[o], noises[n], 1 + n * OFFSETS + o);
+            uint32_t bound = 3 * r.confidence / 10 + 1;
+
+            printf("%-7d +-%-3u ppm %7u s %9u %+8d %6u.%u ppm %9s %6u\n", offsets[o], noises[n], r.duration_s,
+                   r.readings, r.error, r.confidence / 10, r.confidence % 10, r.converged ? "yes" : "no", r.shown);
+            dist_add(&duration[n], r.duration_s);
+            dist_add(&readings[n], r.readings);
+
+            CHECK((uint32_t)abs(r.error) <= bound, "offset %d, noise %u: correction off by %d ppm, bound %u",
+                  offsets[o], noises[n], r.error, bound);
+            CHECK(r.readings >= CO2_CALIB_SKIP_SAMPLES + CO2_CALIB_MIN_SAMPLES &&
+                      r.readings <= COUNTDOWN_S / PERIOD_S + MAX_EXTRA,
+                  "offset %d, noise %u: %u readings", offsets[o], noises[n], r.readings);
+            if (noises[n] <= CONVERGING_NOISE_PPM)
+            {
+                CHECK(r.converged && r.duration_s < COUNTDOWN_S, "offset %d, noise %u: not converged in %u s",
+                      offsets[o], noises[n], r.duration_s);
+                CHECK(abs((int)r.shown - CO2_CALIB_TARGET) <= (int)(bound + noises[n]),
+                      "offset %d, noise %u: %u ppm shown after the calibration", offsets[o], noises[n], r.shown);
+            }
+        }
+    }
+
+    printf("\n%-8s %24s %24s\n", "noise", "duration min/mean/max s", "readings min/mean/max");
+    for (uint8_t n = 0; n < NOISES; n++)
+    {
+        printf("+-%-3u    %8u %7.1f %7u %8u %7.1f %7u\n", noises[n], duration[n].min,
+               (double)duration[n].sum / OFFSETS, duration[n].max, readings[n].min, (double)readings[n].sum / OFFSETS,
+               readings[n].max);
+    }
+
+    CHECK(sim_tl_count_type(SIM_TL_ERROR) == 0 && sim_tl_count_type(SIM_TL_RESET) == 0, "error or reset");
+    return check_failures();
+}
@@ -0,0 +1,357 @@
+/**
+ * Integer pipeline of the CO2 readings (scd4x/co2_filter.c), linked alone.
+ * Checked:
+ *
+ *   - the default configuration passes readings through, invalid ones are
+ *     refused and leave the configuration as it was
+ *   - median of 1 passes a spike, of 3 rejects one, of 5 rejects two in a
+ *     row; while the window fills the upper middle is returned
+ *   - the EMA follows the Q8 recurrence, settles on a step without overshoot
+ *   - the slew limit moves the output by at most slew_ppm per sample
+ *   - Q14 scaling rounds to nearest, the factor is clamped to 0.5..2.0 and
+ *     stays within 1 ppm of the float multiplication it replaced
+ *   - offsets over the whole int16 range saturate the reading to 0..65535,
+ *     every stage stays in range there
+ *
+ * Then host cycles per sample of the pipeline against the same pipeline in
+ * float, averaged over SAMPLES readings. The host has a hardware FPU like the
+ * nRF52's Cortex-M4F, the integer path is checked to cost no more than
+ * MAX_SLOWDOWN times the float one and to stay within 2 ppm of it. The cycle
+ * counter is the TSC on x86, host nanoseconds elsewhere.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "check.h"
+#include "co2_filter.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#define SAMPLES      1000000
+#define READINGS     1024 // a power of two
+#define MAX_SLOWDOWN 1.5
+
+static uint64_t cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+#endif
+}
+
+static co2_filter_t filter_with(uint8_t median_n, uint8_t ema_shift, uint16_t slew_ppm)
+{
+    co2_filter_t     f;
+    co2_filter_cfg_t cfg = {median_n, ema_shift, slew_ppm};
+
+    co2_filter_init(&f);
+    CHECK(co2_filter_configure(&f, &cfg) == 0, "median %u, ema %u, slew %u refused", median_n, ema_shift, slew_ppm);
+    return f;
+}
+
+/** Feed n readings, compare every output with expect */
+static void feed(co2_filter_t *f, const char *name, const uint16_t *in, const uint16_t *expect, uint8_t n)
+{
+    for (uint8_t i = 0; i < n; i++)
+    {
+        uint16_t out = co2_filter_process(f, in[i], 0);
+
+        CHECK(out == expect[i], "%s: reading %u of %u ppm gave %u, expected %u", name, i, in[i], out, expect[i]);
+    }
+}
+
+static void test_config(void)
+{
+    static const co2_filter_cfg_t invalid[] = {{0, 0, 0}, {2, 0, 0}, {4, 0, 0}, {6, 0, 0}, {1, 5, 0}};
+    co2_filter_cfg_t              good      = {3, 2, 100};
+    co2_filter_t                  f;
+
+    co2_filter_init(&f);
+    for (uint32_t ppm = 0; ppm <= UINT16_MAX; ppm += 7)
+    {
+        CHECK(co2_filter_process(&f, (uint16_t)ppm, 0) == ppm, "pass-through changed %u ppm", ppm);
+    }
+    CHECK(co2_filter_configure(&f, &good) == 0, "valid configuration refused");
+    for (uint8_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++)
+    {
+        CHECK(co2_filter_configure(&f, &invalid[i]) == 1, "median %u, ema %u accepted", invalid[i].median_n,
+              invalid[i].ema_shift);
+    }
+    CHECK(memcmp(&f.cfg, &good, sizeof(good)) == 0, "an invalid configuration changed the filter");
+}
+
+static void test_median(void)
+{
+    static const uint16_t in[] = {500, 500, 2000, 500, 500, 500, 500, 2000, 2000, 500, 500};
+    static const uint16_t m3[] = {500, 500, 500, 500, 500, 500, 500, 500, 2000, 2000, 500};
+    static const uint16_t m5[] = {500, 500, 500, 500, 500, 500, 500, 500, 500, 500, 500};
+    static const uint16_t fill_in[] = {800, 400, 200, 600, 700};
+    static const uint16_t fill[]    = {800, 800, 400, 600, 600};
+    co2_filter_t          f;
+
+    f = filter_with(1, 0, 0);
+    feed(&f, "median 1", in, in, 11);
+    f = filter_with(3, 0, 0);
+    feed(&f, "median 3", in, m3, 11);
+    f = filter_with(5, 0, 0);
+    feed(&f, "median 5", in, m5, 11);
+
+    // {800}, {400 800}, {200 400 800}, {200 400 600 800}, {200 400 600 700 800}
+    f = filter_with(5, 0, 0);
+    feed(&f, "median 5 filling", fill_in, fill, 5);
+
+    // a reset empties the window
+    co2_filter_reset(&f);
+    CHECK(co2_filter_process(&f, 1234, 0) == 1234, "median after reset");
+}
+
+static void test_ema(void)
+{
+    for (uint8_t shift = 1; shift <= CO2_FILTER_EMA_SHIFT_MAX; shift++)
+    {
+        co2_filter_t f     = filter_with(1, shift, 0);
+        int32_t      ref   = 400 << 8;
+        uint16_t     out   = co2_filter_process(&f, 400, 0);
+        uint8_t      steps = 0;
+
+        CHECK(out == 400, "ema %u: first reading %u, passed through", shift, out);
+        for (uint8_t target = 0; target < 2; target++)
+        {
+            uint16_t to   = target == 0 ? 800 : 400;
+            uint16_t prev = out;
+
+            for (steps = 0; steps < 200; steps++)
+            {
+                ref += ((to << 8) - ref) >> shift;
+                out = co2_filter_process(&f, to, 0);
+                CHECK(out == (uint16_t)((ref + 128) >> 8), "ema %u: %u, expected %d", shift, out, (ref + 128) >> 8);
+                CHECK(to > 400 ? out >= prev && out <= to : out <= prev && out >= to, "ema %u: %u after %u", shift,
+                      out, prev);
+                prev = out;
+                if (out == to) break;
+            }
+            // alpha = 1/2^shift: within 1 ppm after about 2^shift * ln(400 * 2) samples
+            CHECK(out == to && steps < (7u << shift) + 8, "ema %u: %u after %u samples toward %u", shift, out, steps,
+                  to);
+        }
+    }
+}
+
+static void test_slew(void)
+{
+    co2_filter_t f = filter_with(1, 0, 50);
+    uint16_t     out;
+
+    CHECK(co2_filter_process(&f, 400, 0) == 400, "slew: first reading limited");
+    for (uint8_t i = 1; i <= 8; i++)
+    {
+        out = co2_filter_process(&f, 800, 0);
+        CHECK(out == 400 + 50 * i, "slew: %u after %u samples up", out, i);
+    }
+    CHECK(co2_filter_process(&f, 830, 0) == 830, "slew: a change below the limit limited");
+    for (uint8_t i = 1; i <= 3; i++)
+    {
+        out = co2_filter_process(&f, 0, 0);
+        CHECK(out == 830 - 50 * i, "slew: %u after %u samples down", out, i);
+    }
+}
+
+static void test_scale(void)
+{
+    static const struct
+    {
+        float    scale;
+        uint16_t q14;
+    } factors[] = {{1.0f, 16384}, {1.1f, 18022}, {0.75f, 12288}, {0.3f, 8192}, {0.5f, 8192}, {2.0f, 32768},
+                   {3.0f, 32768}, {1.234f, 20218}};
+    co2_filter_t f;
+
+    co2_filter_init(&f);
+    for (uint8_t i = 0; i < sizeof(factors) / sizeof(factors[0]); i++)
+    {
+        float scale = factors[i].scale < 0.5f ? 0.5f : factors[i].scale > 2.0f ? 2.0f : factors[i].scale;
+
+        co2_filter_set_scale(&f, factors[i].scale);
+        CHECK(f.scale_q14 == factors[i].q14, "scale %.3f: Q14 %u, expected %u", factors[i].scale, f.scale_q14,
+              factors[i].q14);
+        for (uint32_t ppm = 0; ppm <= UINT16_MAX; ppm++)
+        {
+            uint64_t exact = ((uint64_t)ppm * f.scale_q14 * 2 + 16384) / 32768; // round half up
+            uint16_t got   = co2_filter_scale(&f, (uint16_t)ppm);
+            float    old   = ppm * scale; // (uint16_t)(co2_ppm * get_co2_scale_factor()) before
+
+            CHECK(got == (exact > UINT16_MAX ? UINT16_MAX : exact), "scale %.3f: %u ppm gave %u", factors[i].scale,
+                  ppm, got);
+            if (ppm <= 10000)
+            {
+                CHECK(abs((int)got - (int)old) <= 1, "scale %.3f: %u ppm gave %u, float %.2f", factors[i].scale, ppm,
+                      got, old);
+            }
+        }
+    }
+    co2_filter_set_scale(&f, 0.75f);
+    CHECK(co2_filter_scale(&f, 1001) == 751 && co2_filter_scale(&f, 1002) == 752, "0.75: 750.75 and 751.5 rounded");
+}
+
+static void test_saturation(void)
+{
+    co2_filter_t f = filter_with(5, 3, 1000);
+
+    co2_filter_set_scale(&f, 2.0f);
+    CHECK(co2_filter_scale(&f, 40000) == UINT16_MAX, "2.0 * 40000 not saturated");
+    CHECK(co2_filter_scale(&f, UINT16_MAX) == UINT16_MAX, "2.0 * 65535 not saturated");
+
+    CHECK(co2_filter_process(&f, 1000, INT16_MIN) == 0 && f.raw == 0, "1000 - 32768: raw %u", f.raw);
+    co2_filter_reset(&f);
+    CHECK(co2_filter_process(&f, UINT16_MAX, INT16_MAX) == UINT16_MAX && f.raw == UINT16_MAX,
+          "65535 + 32767: raw %u", f.raw);
+    CHECK(co2_filter_process(&f, 40000, INT16_MAX) == UINT16_MAX && f.raw == UINT16_MAX, "40000 + 32767: raw %u",
+          f.raw);
+
+    // full scale swings through every stage, the output never wraps
+    for (uint16_t i = 0; i < 200; i++)
+    {
+        uint16_t in   = i & 8 ? UINT16_MAX : 0;
+        int16_t  off  = i & 4 ? INT16_MAX : INT16_MIN;
+        uint16_t prev = f.filtered;
+        uint16_t out  = co2_filter_process(&f, in, off);
+
+        CHECK(abs((int)out - (int)prev) <= 1000, "swing %u: %u after %u", i, out, prev);
+    }
+}
+
+/** The pipeline in float, as it would be written without the Q formats */
+typedef struct
+{
+    float   scale;
+    float   alpha;
+    float   slew;
+    float   window[CO2_FILTER_MEDIAN_MAX];
+    uint8_t n, count, idx;
+    float   ema;
+    float   out;
+    bool    primed;
+} float_filter_t;
+
+static uint16_t float_process(float_filter_t *f, uint16_t ppm, int16_t offset)
+{
+    float   sorted[CO2_FILTER_MEDIAN_MAX];
+    float   value = ppm * f->scale + offset;
+    uint8_t i, j;
+
+    if (value < 0) value = 0;
+    if (value > UINT16_MAX) value = UINT16_MAX;
+
+    f->window[f->idx] = value;
+    f->idx            = (f->idx + 1) % f->n;
+    if (f->count < f->n) f->count++;
+    for (i = 0; i < f->count; i++)
+    {
+        for (j = i; j > 0 && sorted[j - 1] > f->window[i]; j--) sorted[j] = sorted[j - 1];
+        sorted[j] = f->window[i];
+    }
+    value = sorted[f->count / 2];
+
+    f->ema = f->primed ? f->ema + (value - f->ema) * f->alpha : value;
+    value  = f->ema;
+    if (f->primed && f->slew > 0)
+    {
+        if (value > f->out + f->slew) value = f->out + f->slew;
+        if (value < f->out - f->slew) value = f->out - f->slew;
+    }
+    f->out    = value;
+    f->primed = true;
+    return (uint16_t)(value + 0.5f);
+}
+
+typedef struct
+{
+    double int_cycles;
+    double float_cycles;
+    int    max_diff;
+} bench_t;
+
+static bench_t bench(const uint16_t *readings, uint8_t median_n, uint8_t ema_shift, uint16_t slew_ppm)
+{
+    co2_filter_t      f  = filter_with(median_n, ema_shift, slew_ppm);
+    float_filter_t    ff = {1.1f, 1.0f / (1 << ema_shift), slew_ppm, {0}, median_n};
+    volatile uint32_t sink = 0;
+    bench_t           b    = {0};
+    uint64_t          t0;
+
+    co2_filter_set_scale(&f, 1.1f);
+    for (uint32_t i = 0; i < READINGS; i++)
+    {
+        uint16_t a = co2_filter_process(&f, co2_filter_scale(&f, readings[i]), -20);
+        uint16_t c = float_process(&ff, readings[i], -20);
+
+        if (abs((int)a - (int)c) > b.max_diff) b.max_diff = abs((int)a - (int)c);
+    }
+
+    t0 = cycles();
+    for (uint32_t i = 0; i < SAMPLES; i++)
+    {
+        sink += co2_filter_process(&f, co2_filter_scale(&f, readings[i & (READINGS - 1)]), -20);
+    }
+    b.int_cycles = (double)(cycles() - t0) / SAMPLES;
+
+    t0 = cycles();
+    for (uint32_t i = 0; i < SAMPLES; i++)
+    {
+        sink += float_process(&ff, readings[i & (READINGS - 1)], -20);
+    }
+    b.float_cycles = (double)(cycles() - t0) / SAMPLES;
+    (void)sink;
+    return b;
+}
+
+int main(void)
+{
+    static const struct
+    {
+        const char *name;
+        uint8_t     median_n, ema_shift;
+        uint16_t    slew_ppm;
+    } configs[] = {
+        {"scale only", 1, 0, 0},
+        {"median 3", 3, 0, 0},
+        {"median 5, ema 2, slew 50", 5, 2, 50},
+    };
+    uint16_t readings[READINGS];
+    uint32_t rng = 12345;
+
+    test_config();
+    test_median();
+    test_ema();
+    test_slew();
+    test_scale();
+    test_saturation();
+
+    // a noisy office ramp with spikes
+    for (uint32_t i = 0; i < READINGS; i++)
+    {
+        rng         = rng * 1103515245 + 12345;
+        readings[i] = (uint16_t)(450 + i + (rng >> 16) % 31 + ((rng >> 8) % 50 == 0 ? 1500 : 0));
+    }
+
+    printf("%-26s %12s %12s %9s\n", "pipeline", "int cyc", "float cyc", "max diff");
+    for (uint8_t c = 0; c < sizeof(configs) / sizeof(configs[0]); c++)
+    {
+        bench_t b = bench(readings, configs[c].median_n, configs[c].ema_shift, configs[c].slew_ppm);
+
+        printf("%-26s %12.1f %12.1f %9d\n", configs[c].name, b.int_cycles, b.float_cycles, b.max_diff);
+        // the Q8 EMA and the rounding of the scaled reading against float
+        CHECK(b.max_diff <= 2, "%s: integer and float differ by %d ppm", configs[c].name, b.max_diff);
+        CHECK(b.int_cycles <= b.float_cycles * MAX_SLOWDOWN, "%s: %.1f integer cycles, %.1f float",
+              configs[c].name, b.int_cycles, b.float_cycles);
+    }
+
+    return check_failures();
+}
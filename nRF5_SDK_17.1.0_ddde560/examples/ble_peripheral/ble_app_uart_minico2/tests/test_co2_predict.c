@@ -0,0 +1,186 @@
+/**
+ * Trend prediction of the CO2 alarms (scd4x/co2_predict.c) replayed on
+ * waveforms with sensor noise. No boot: readings go through co2_predict_add /
+ * co2_predict_update / co2_predict_within_lead the way task_co2_alarm calls
+ * them: a reading below the previous one is falling and skips the evaluation,
+ * a level pre-alerts once and re-arms when the trend has not reached it for
+ * a lead time (evaluate_predicted_alarms). Default configuration, alarm level LEVEL.
+ *
+ *   - ramps from START_PPM at several rates and sample intervals, SEEDS noise
+ *     sequences each: the pre-alert fires before the first reading at or
+ *     above the level for every run of a rate from MIN_RATE_PPM_H up, once per
+ *     run and at most twice the configured lead ahead; the detection rate,
+ *     the mean and the shortest lead and the most pre-alerts of a run are
+ *     printed
+ *   - flat input below the level with noise up to the sensor's repeatability
+ *     (+-10 ppm) and +-25 ppm from 100 ppm below, FLAT_DAYS per case: no
+ *     pre-alert at all; the false positive rate is printed per day, also for
+ *     a stress case that is not checked
+ */
+
+#include <stdlib.h>
+
+#include "check.h"
+#include "co2_predict.h"
+
+#define LEVEL          1000
+#define START_PPM      600
+#define SEEDS          20
+#define MIN_RATE_PPM_H 600
+#define FLAT_DAYS      7
+
+typedef struct
+{
+    uint32_t rate_ppm_h; // 0 for flat input
+    uint16_t base_ppm;
+    uint16_t noise_ppm;  // uniform +-noise_ppm
+    uint16_t interval_s;
+} wave_t;
+
+typedef struct
+{
+    bool     crossed;    // a reading reached the level
+    uint32_t cross_s;    // time of that reading from the start
+    bool     alerted;    // pre-alert before the crossing
+    uint32_t alert_s;    // time of the first pre-alert
+    uint32_t alerts;     // pre-alerts before the crossing
+} run_t;
+
+static uint32_t rng;
+
+static int16_t noise(uint16_t amplitude)
+{
+    rng = rng * 1103515245 + 12345;
+    return amplitude ? (int16_t)((rng >> 16) % (2 * amplitude + 1)) - (int16_t)amplitude : 0;
+}
+
+/** Readings every interval_s until the level is reached or duration_s passed */
+static run_t replay(const wave_t *w, uint32_t seed, uint32_t duration_s)
+{
+    co2_predict_cfg_t cfg;
+    const uint32_t t0    = 1000000; // time_s of the first reading
+    run_t          r     = {0};
+    uint16_t       last  = 0;
+    bool           fired = false;
+    uint32_t       reach = 0; // time the trend last reached the level
+    uint32_t       lead_s;
+
+    co2_predict_get_config(&cfg);
+    lead_s = (uint32_t)cfg.lead_min * 60;
+    rng    = seed;
+    co2_predict_reset();
+    for (uint32_t s = 0; s <= duration_s; s += w->interval_s)
+    {
+        uint16_t ppm     = (uint16_t)(w->base_ppm + (uint64_t)w->rate_ppm_h * s / 3600 + noise(w->noise_ppm));
+        bool     falling = last != 0 && ppm < last;
+
+        co2_predict_add(ppm, t0 + s);
+        last = ppm;
+        if (ppm >= LEVEL)
+        {
+            r.crossed = true;
+            r.cross_s = s;
+            break;
+        }
+        if (falling) continue;
+
+        if (co2_predict_update() && co2_predict_within_lead(LEVEL))
+        {
+            reach = s;
+            if (!fired)
+            {
+                if (!r.alerted) r.alert_s = s;
+                r.alerted = true;
+                r.alerts++;
+                fired = true;
+            }
+        }
+        else if (s - reach >= lead_s)
+        {
+            fired = false;
+        }
+    }
+    return r;
+}
+
+static void test_ramps(void)
+{
+    static const uint32_t rates[]     = {300, 600, 1200, 2400};
+    static const uint16_t intervals[] = {30, 60, 180};
+    co2_predict_cfg_t     cfg;
+
+    co2_predict_get_config(&cfg);
+    printf("%-10s %-9s %9s %10s %10s %10s\n", "ramp ppm/h", "interval", "detected", "mean lead", "min lead",
+           "alerts/run");
+    for (uint8_t i = 0; i < sizeof(intervals) / sizeof(intervals[0]); i++)
+    {
+        for (uint8_t k = 0; k < sizeof(rates) / sizeof(rates[0]); k++)
+        {
+            wave_t   w        = {rates[k], START_PPM, 10, intervals[i]};
+            uint32_t detected = 0, lead_sum = 0, min_lead = UINT32_MAX, max_alerts = 0;
+
+            for (uint32_t seed = 1; seed <= SEEDS; seed++)
+            {
+                run_t    r    = replay(&w, seed, 2 * (LEVEL - START_PPM) * 3600 / rates[k]);
+                uint32_t lead = r.cross_s - r.alert_s;
+
+                CHECK(r.crossed, "%u ppm/h every %u s, seed %u: level not reached", rates[k], intervals[i], seed);
+                if (r.alerted)
+                {
+                    detected++;
+                    lead_sum += lead;
+                    if (lead < min_lead) min_lead = lead;
+                    CHECK(lead <= 2 * cfg.lead_min * 60u,
+                          "%u ppm/h every %u s, seed %u: pre-alert %u s ahead", rates[k], intervals[i], seed, lead);
+                }
+                if (r.alerts > max_alerts) max_alerts = r.alerts;
+                if (rates[k] >= MIN_RATE_PPM_H)
+                {
+                    CHECK(r.alerted && lead > 0, "%u ppm/h every %u s, seed %u: no pre-alert before the crossing",
+                          rates[k], intervals[i], seed);
+                    CHECK(r.alerts == 1, "%u ppm/h every %u s, seed %u: %u pre-alerts", rates[k], intervals[i], seed,
+                          r.alerts);
+                }
+            }
+            printf("%-10u %7u s %8u%% %8.1f m %8.1f m %10u\n", rates[k], intervals[i], detected * 100 / SEEDS,
+                   detected ? lead_sum / 60.0 / detected : 0.0, detected ? min_lead / 60.0 : 0.0, max_alerts);
+        }
+    }
+}
+
+static void test_flat(void)
+{
+    static const struct
+    {
+        wave_t w;
+        bool   checked;
+    } flats[] = {
+        {{0, 900, 10, 60}, true},
+        {{0, 950, 10, 60}, true},
+        {{0, 980, 10, 30}, true},
+        {{0, 980, 10, 180}, true},
+        {{0, 900, 25, 60}, true},
+        {{0, 900, 25, 180}, true},
+        {{0, 950, 25, 60}, false}, // stress, noise beyond the repeatability 50 ppm below the level
+    };
+
+    printf("\n%-10s %-9s %-9s %12s\n", "flat ppm", "noise", "interval", "alerts/day");
+    for (uint8_t i = 0; i < sizeof(flats) / sizeof(flats[0]); i++)
+    {
+        const wave_t *w = &flats[i].w;
+        run_t         r = replay(w, 1000 + i, FLAT_DAYS * 86400);
+
+        printf("%-10u +-%-3u ppm %7u s %12.2f%s\n", w->base_ppm, w->noise_ppm, w->interval_s,
+               (double)r.alerts / FLAT_DAYS, flats[i].checked ? "" : " (not checked)");
+        CHECK(!r.crossed, "flat %u ppm +-%u crossed the level", w->base_ppm, w->noise_ppm);
+        CHECK(!flats[i].checked || r.alerts == 0, "flat %u ppm +-%u every %u s: %u pre-alerts in %u days",
+              w->base_ppm, w->noise_ppm, w->interval_s, r.alerts, FLAT_DAYS);
+    }
+}
+
+int main(void)
+{
+    test_ramps();
+    test_flat();
+    return check_failures();
+}
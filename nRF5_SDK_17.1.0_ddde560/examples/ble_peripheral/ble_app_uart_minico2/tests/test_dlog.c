@@ -0,0 +1,173 @@
+/**
+ * Cost of a log call, deferred (dlog_x) against formatted (print). Linked
+ * with log.c alone: SEGGER_RTT_Write is stubbed here with a ring copy as the
+ * target's RTT does, SEGGER_RTT_printf formats into a 64 byte buffer and
+ * writes it out chunk by chunk as SEGGER_RTT_printf does. Host nanoseconds
+ * per call averaged over CALLS calls, the ratio is what carries over to the
+ * target, plus the RTT bytes per call.
+ *
+ * Checked: the dlog record carries the format address, tick, module, level
+ * and arguments as log.h describes; dlog is at least MIN_SPEEDUP times
+ * cheaper than print and writes fewer bytes; a record above the runtime level
+ * writes nothing.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "check.h"
+#include "log.h"
+
+#define CALLS       200000
+#define MIN_SPEEDUP 3
+
+#define RTT_SIZE    1024 // a power of two
+#define PRINTF_SIZE 64   // SEGGER_RTT_PRINTF_BUFFER_SIZE
+
+unsigned int systemTickCount = 0;
+
+static uint8_t  rtt[2][RTT_SIZE];
+static uint32_t rtt_wr[2];
+static uint32_t rtt_bytes[2];
+
+int SEGGER_RTT_ConfigUpBuffer(unsigned BufferIndex, const char *sName, void *pBuffer, unsigned BufferSize, unsigned Flags)
+{
+    (void)BufferIndex;
+    (void)sName;
+    (void)pBuffer;
+    (void)BufferSize;
+    (void)Flags;
+    return 0;
+}
+
+/** The host drains the buffer at once, the copy into it is the cost on the target */
+unsigned SEGGER_RTT_Write(unsigned BufferIndex, const void *pBuffer, unsigned NumBytes)
+{
+    const uint8_t *p = pBuffer;
+
+    for (unsigned i = 0; i < NumBytes; i++)
+    {
+        rtt[BufferIndex][(rtt_wr[BufferIndex] + i) & (RTT_SIZE - 1)] = p[i];
+    }
+    rtt_wr[BufferIndex] += NumBytes;
+    rtt_bytes[BufferIndex] += NumBytes;
+    return NumBytes;
+}
+
+int SEGGER_RTT_vprintf(unsigned BufferIndex, const char *sFormat, va_list *pParamList)
+{
+    char buf[256];
+    int  n = vsnprintf(buf, sizeof(buf), sFormat, *pParamList);
+
+    for (int i = 0; i < n; i += PRINTF_SIZE)
+    {
+        SEGGER_RTT_Write(BufferIndex, buf + i, n - i > PRINTF_SIZE ? PRINTF_SIZE : n - i);
+    }
+    return n;
+}
+
+int SEGGER_RTT_printf(unsigned BufferIndex, const char *sFormat, ...)
+{
+    va_list args;
+    int     ret;
+
+    va_start(args, sFormat);
+    ret = SEGGER_RTT_vprintf(BufferIndex, sFormat, &args);
+    va_end(args);
+    return ret;
+}
+
+static uint64_t host_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+typedef struct
+{
+    double   ns;
+    uint32_t bytes;
+} cost_t;
+
+/** Calls of the co2 task, the most frequent ones */
+static void log_print(uint16_t co2, int16_t status)
+{
+    print("read co2 %d ppm, sensor status %d\n", co2, status);
+}
+
+static void log_dlog(uint16_t co2, int16_t status)
+{
+    dlog_i(CO2, "read co2 %d ppm, sensor status %d\n", co2, status);
+}
+
+/** Compiled in, filtered by the runtime level */
+static void log_dlog_off(uint16_t co2, int16_t status)
+{
+    dlog_d(CO2, "read co2 %d ppm, sensor status %d\n", co2, status);
+}
+
+static cost_t measure(void (*fn)(uint16_t, int16_t), unsigned channel)
+{
+    uint32_t bytes = rtt_bytes[channel];
+    uint64_t t0    = host_ns();
+
+    for (uint32_t i = 0; i < CALLS; i++)
+    {
+        systemTickCount = i;
+        fn((uint16_t)(400 + (i & 1023)), (int16_t)(i & 7));
+    }
+    return (cost_t){(double)(host_ns() - t0) / CALLS, (rtt_bytes[channel] - bytes) / CALLS};
+}
+
+static void check_record(void)
+{
+    static const char fmt[] = "%d %d %d\n";
+    uint32_t          record[5];
+    uint32_t          start = rtt_wr[DLOG_RTT_CHANNEL];
+
+    systemTickCount = 0x12345;
+    dlog_w(HISTORY, fmt, 7, -1, 0x10000);
+    CHECK(rtt_wr[DLOG_RTT_CHANNEL] - start == sizeof(record), "record of %u bytes", rtt_wr[DLOG_RTT_CHANNEL] - start);
+
+    for (uint32_t i = 0; i < sizeof(record); i++)
+    {
+        ((uint8_t *)record)[i] = rtt[DLOG_RTT_CHANNEL][(start + i) & (RTT_SIZE - 1)];
+    }
+    CHECK(record[0] == (uint32_t)(uintptr_t)fmt, "format address %08X", record[0]);
+    CHECK(record[1] >> 16 == 0x2345 && (record[1] >> 12 & 0x0F) == DLOG_MODULE_HISTORY &&
+              (record[1] >> 9 & 0x07) == DLOG_LEVEL_WARN && (record[1] >> 8 & 1) == 0 && (record[1] & 0xFF) == 3,
+          "header %08X", record[1]);
+    CHECK(record[2] == 7 && record[3] == 0xFFFFFFFF && record[4] == 0x10000, "arguments %X %X %X", record[2], record[3],
+          record[4]);
+}
+
+int main(void)
+{
+    cost_t p, d, off;
+
+    dlog_init();
+    check_record();
+
+    // warm up the caches and the branch predictors
+    measure(log_print, 0);
+    measure(log_dlog, DLOG_RTT_CHANNEL);
+
+    p   = measure(log_print, 0);
+    d   = measure(log_dlog, DLOG_RTT_CHANNEL);
+    dlog_set_level(DLOG_MODULE_CO2, DLOG_LEVEL_INFO);
+    off = measure(log_dlog_off, DLOG_RTT_CHANNEL);
+
+    printf("%-14s %8s %6s\n", "call", "ns/call", "bytes");
+    printf("%-14s %8.1f %6u\n", "print", p.ns, p.bytes);
+    printf("%-14s %8.1f %6u\n", "dlog", d.ns, d.bytes);
+    printf("%-14s %8.1f %6u\n", "dlog filtered", off.ns, off.bytes);
+    printf("dlog %.1fx cheaper than print\n", p.ns / d.ns);
+
+    CHECK(d.ns * MIN_SPEEDUP <= p.ns, "dlog %.1f ns, print %.1f ns, less than %dx", d.ns, p.ns, MIN_SPEEDUP);
+    CHECK(d.bytes < p.bytes, "dlog writes %u bytes, print %u", d.bytes, p.bytes);
+    CHECK(off.bytes == 0, "a filtered record wrote %u bytes", off.bytes);
+
+    return check_failures();
+}
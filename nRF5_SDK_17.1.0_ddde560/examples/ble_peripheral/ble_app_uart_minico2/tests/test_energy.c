@@ -0,0 +1,220 @@
+/**
+ * Energy ledger against synthetic activity traces. No boot: the ledger is
+ * initialized on its own and a trace drives energy_begin / energy_end /
+ * energy_add_us on the simulator clock, energy_tick_second() is called once
+ * per simulated second as the scheduler tick does. Both traces run past the
+ * 1024 s RTC wrap. Per trace the checks are:
+ *
+ *   - the active time and the charge of every consumer equal to the trace's
+ *     analytic values, within one RTC tick per begin / end interval; times
+ *     added by energy_add_us() exactly
+ *   - the average current equal to base + sum(time * current) / duration
+ *   - the remaining hours equal to capacity * level / average current, also
+ *     with a capacity beyond the 32 bit range of the uAh product
+ *
+ * Per consumer the expected and the ledger time and charge are printed.
+ */
+
+#include <string.h>
+
+#include "battery.h"
+#include "check.h"
+#include "energy.h"
+#include "nrf_delay.h"
+#include "sim.h"
+
+#define NONE ENERGY_CONSUMER_COUNT
+
+/** A periodic activity: active duration_us from offset_ms in every period, or energy_add_us() of it at offset_ms */
+typedef struct
+{
+    energy_consumer_t consumer;
+    uint32_t          period_ms;
+    uint32_t          offset_ms;
+    uint32_t          duration_us;
+    bool              add; // energy_add_us() instead of begin / end
+} activity_t;
+
+typedef struct
+{
+    const char *name;
+    uint32_t    duration_s; // a multiple of every period
+    activity_t  act[12];    // ended by consumer NONE
+} trace_t;
+
+static const char *const names[ENERGY_CONSUMER_COUNT] = {
+    "cpu", "scd4x idle", "scd4x meas", "scd4x lp", "twi",    "lcd on",   "lcd refresh",
+    "flash", "ble adv",  "ble conn",   "buzzer",   "vibrator", "lcd hpm",
+};
+
+/** Screen off, a single shot sample every 3 minutes logged to flash, advertising */
+static const trace_t quiet = {
+    "quiet",
+    3600,
+    {
+        {ENERGY_CPU, 1000, 0, 20000},
+        {ENERGY_SCD4X_IDLE, 3600000, 0, 3600000000u},
+        {ENERGY_SCD4X_MEAS, 180000, 500, 5000000},
+        {ENERGY_TWI, 180000, 5500, 900, true}, // six transfers of 150 us
+        {ENERGY_FLASH, 1000, 30, 700, true}, // a page program per second, 11.47 RTC ticks each
+        {ENERGY_BLE_ADV, 3600000, 0, 3600000000u},
+        {NONE},
+    },
+};
+
+/** Screen woken every 5 minutes, a sample per minute, alarms, connected */
+static const trace_t busy = {
+    "busy",
+    1800,
+    {
+        {ENERGY_CPU, 1000, 0, 50000},
+        {ENERGY_SCD4X_IDLE, 1800000, 0, 1800000000u},
+        {ENERGY_SCD4X_MEAS, 60000, 0, 5000000},
+        {ENERGY_TWI, 60000, 5000, 450, true},
+        {ENERGY_LCD_ON, 300000, 100, 10000000},
+        {ENERGY_LCD_HPM, 300000, 100, 2000000},
+        {ENERGY_LCD_REFRESH, 300000, 150, 31000},
+        {ENERGY_BUZZER, 600000, 200, 500000},
+        {ENERGY_VIBRATOR, 600000, 200, 500000},
+        {ENERGY_BLE_CONN, 1800000, 0, 1800000000u},
+        {NONE},
+    },
+};
+
+/** Default current model, energy_set_model() writes over it */
+static const uint32_t model_ua[ENERGY_CONSUMER_COUNT] = {
+    3000, 200, 15000, 450, 500, 40, 1500, 8000, 150, 250, 20000, 60000, 60,
+};
+
+static bool is_active(const activity_t *a, uint64_t t_us)
+{
+    uint64_t phase = t_us % ((uint64_t)a->period_ms * 1000);
+    uint64_t from  = (uint64_t)a->offset_ms * 1000;
+
+    return phase >= from && phase < from + a->duration_us;
+}
+
+/** Play a trace from a fresh ledger, return the expected active time and the begin / end intervals per consumer */
+static void play(const trace_t *tr, uint64_t expect_us[ENERGY_CONSUMER_COUNT], uint32_t intervals[ENERGY_CONSUMER_COUNT])
+{
+    uint64_t t0 = sim_now_us();
+    uint64_t end = (uint64_t)tr->duration_s * 1000000;
+    uint64_t t   = 0;
+
+    memset(expect_us, 0, sizeof(uint64_t) * ENERGY_CONSUMER_COUNT);
+    memset(intervals, 0, sizeof(uint32_t) * ENERGY_CONSUMER_COUNT);
+    for (const activity_t *a = tr->act; a->consumer != NONE; a++)
+    {
+        expect_us[a->consumer] += (uint64_t)a->duration_us * tr->duration_s * 1000 / a->period_ms;
+        if (!a->add) intervals[a->consumer] += tr->duration_s * 1000 / a->period_ms;
+    }
+
+    energy_init();
+    while (t < end)
+    {
+        uint64_t next = (t / 1000000 + 1) * 1000000; // the next second
+
+        // edges are on whole ms, step to the next one
+        for (const activity_t *a = tr->act; a->consumer != NONE; a++)
+        {
+            uint64_t period = (uint64_t)a->period_ms * 1000;
+            uint64_t base   = t / period * period;
+            uint64_t edges[] = {base + a->offset_ms * 1000ull, base + a->offset_ms * 1000ull + a->duration_us,
+                                base + period + a->offset_ms * 1000ull};
+
+            for (uint8_t i = 0; i < 3; i++)
+            {
+                if (edges[i] > t && edges[i] < next) next = edges[i];
+            }
+        }
+
+        for (const activity_t *a = tr->act; a->consumer != NONE; a++)
+        {
+            if (a->add)
+            {
+                if (t % ((uint64_t)a->period_ms * 1000) == (uint64_t)a->offset_ms * 1000)
+                {
+                    energy_add_us(a->consumer, a->duration_us);
+                }
+            }
+            else
+            {
+                energy_set(a->consumer, is_active(a, t));
+            }
+        }
+
+        nrf_delay_us((uint32_t)(next - t));
+        t = next;
+        if (t % 1000000 == 0) energy_tick_second();
+    }
+    CHECK(sim_now_us() - t0 == end, "%s: clock at %llu us", tr->name, (unsigned long long)(sim_now_us() - t0));
+}
+
+static void check_trace(const trace_t *tr)
+{
+    uint64_t expect_us[ENERGY_CONSUMER_COUNT];
+    uint32_t intervals[ENERGY_CONSUMER_COUNT];
+    uint64_t charge = 0; // uA * us
+    uint32_t avg_ua, expect_avg;
+    uint64_t expect_h;
+
+    play(tr, expect_us, intervals);
+
+    printf("%s, %u s\n%-12s %10s %10s %9s %9s\n", tr->name, tr->duration_s, "consumer", "exp 10ms", "10ms",
+           "exp uAh", "uAh");
+    for (uint8_t i = 0; i < ENERGY_CONSUMER_COUNT; i++)
+    {
+        energy_entry_t e         = energy_get_entry(i);
+        uint32_t       exp_10ms  = (uint32_t)(expect_us[i] / 10000);
+        uint32_t       exp_uah   = (uint32_t)(expect_us[i] * model_ua[i] / 3600000000ull);
+        uint64_t       slack_us  = (uint64_t)intervals[i] * 1000000 / 16384; // RTC resolution
+        uint32_t       slack_10  = 1 + (uint32_t)(slack_us / 10000);
+        uint32_t       slack_uah = 1 + (uint32_t)(slack_us * model_ua[i] / 3600000000ull);
+
+        charge += expect_us[i] * model_ua[i];
+        if (expect_us[i] == 0 && e.active_10ms == 0) continue;
+
+        printf("%-12s %10u %10u %9u %9u\n", names[i], exp_10ms, e.active_10ms, exp_uah, e.charge_uah);
+        CHECK(e.active_10ms + slack_10 >= exp_10ms && e.active_10ms <= exp_10ms + slack_10,
+              "%s: %s active %u x 10 ms, expected %u", tr->name, names[i], e.active_10ms, exp_10ms);
+        CHECK(e.charge_uah + slack_uah >= exp_uah && e.charge_uah <= exp_uah + slack_uah,
+              "%s: %s charge %u uAh, expected %u", tr->name, names[i], e.charge_uah, exp_uah);
+    }
+
+    avg_ua     = energy_get_average_ua();
+    expect_avg = ENERGY_BASE_CURRENT_UA + (uint32_t)(charge / ((uint64_t)tr->duration_s * 1000000));
+    printf("average %u uA, expected %u uA, uptime %u s\n", avg_ua, expect_avg, energy_get_uptime_s());
+    CHECK(energy_get_uptime_s() == tr->duration_s, "%s: uptime %u s", tr->name, energy_get_uptime_s());
+    CHECK_RANGE(avg_ua, expect_avg - 1, expect_avg + 1);
+
+    expect_h = (uint64_t)ENERGY_BATTERY_CAPACITY_MAH * 10 * get_battery_level() / avg_ua;
+    printf("remaining %u h at %u %%, expected %llu h\n\n", energy_get_remaining_hours(), get_battery_level(),
+           (unsigned long long)expect_h);
+    CHECK(energy_get_remaining_hours() == expect_h, "%s: %u h remaining, expected %llu", tr->name,
+          energy_get_remaining_hours(), (unsigned long long)expect_h);
+}
+
+int main(void)
+{
+    uint32_t avg_ua;
+    uint64_t expect_h;
+
+    battery_state_update();
+    CHECK(get_battery_level() > 0 && get_battery_level() <= 100, "battery level %u %%", get_battery_level());
+
+    check_trace(&quiet);
+    check_trace(&busy);
+
+    // 7 kAh: capacity * 10 * level no longer fits 32 bits, the result still does at a 100 mA draw
+    CHECK(energy_set_model(ENERGY_BLE_CONN, 100000) == 0, "model rejected");
+    CHECK(energy_set_model(ENERGY_MODEL_CAPACITY, 7000000) == 0, "capacity rejected");
+    avg_ua   = energy_get_average_ua();
+    expect_h = 7000000ull * 10 * get_battery_level() / avg_ua;
+    printf("7000000 mAh at %u uA: %u h, expected %llu h\n", avg_ua, energy_get_remaining_hours(),
+           (unsigned long long)expect_h);
+    CHECK(expect_h < 0xFFFF, "expected %llu h does not fit the result", (unsigned long long)expect_h);
+    CHECK(energy_get_remaining_hours() == expect_h, "%u h remaining, expected %llu", energy_get_remaining_hours(),
+          (unsigned long long)expect_h);
+
+    return check_failures();
+}
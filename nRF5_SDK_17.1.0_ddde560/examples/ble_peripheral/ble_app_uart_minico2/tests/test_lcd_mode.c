@@ -0,0 +1,171 @@
+/**
+ * ST7301 power modes over typical interactions on the simulator. The panel
+ * model records every 0x38 (HPM) and 0x39 (LPM) it receives; over the boot,
+ * a wake by key press with the CO2 value blinking and a settings blink the
+ * timeline must show:
+ *
+ *   - every frame written in HPM
+ *   - LPM entered only LCD_MODE_IDLE_MS after the last frame
+ *   - LPM entered at most IDLE_SLACK_MS later than that, the panel does not idle in HPM
+ *   - no LPM while an element blinks
+ *   - the energy ledger's HPM time equal to the time the model spent in HPM
+ *
+ * Per sequence the frames, the mode changes and the time in each mode are
+ * printed.
+ */
+
+#include <string.h>
+
+#include "check.h"
+#include "energy.h"
+#include "scd4x_model.h"
+#include "sim.h"
+#include "st7301_model.h"
+
+#define MS(m) ((uint64_t)(m) * 1000)
+#define S(s)  MS((s) * 1000)
+
+#define LCD_MODE_IDLE_MS 2000
+#define IDLE_SLACK_MS    300 // scheduler tick and SPI wait of task_lcd_mode
+#define LEDGER_SLACK_MS  20  // the ledger counts 10 ms units
+
+typedef struct
+{
+    uint32_t frames;
+    uint32_t hpm_entries;
+    uint32_t lpm_entries;
+    uint64_t first_lpm_us; // 0 if none
+    uint64_t last_lpm_us;
+    uint64_t last_frame_us;
+} seq_stats_t;
+
+static uint16_t office_co2(uint64_t t_us)
+{
+    (void)t_us;
+    return 850;
+}
+
+/** Check the timeline from index *pos on against the rules above, blink_from..blink_to is a blink period */
+static seq_stats_t check_timeline(const char *name, uint32_t *pos, uint64_t blink_from, uint64_t blink_to)
+{
+    static uint32_t mode       = 0; // 0 unpowered or not set yet
+    static uint64_t last_frame = 0;
+    static uint64_t hpm_since  = 0;
+    seq_stats_t     s          = {0};
+
+    for (; *pos < sim_tl_count(); (*pos)++)
+    {
+        const sim_tl_t *r = sim_tl_get(*pos);
+
+        if (r->type == SIM_TL_LCD_POWER)
+        {
+            mode = 0;
+        }
+        else if (r->type == SIM_TL_LCD_FRAME)
+        {
+            s.frames++;
+            s.last_frame_us = r->t_us;
+            last_frame      = r->t_us;
+            CHECK(mode == 0x38, "%s: frame at %.3f s in mode %02x", name, r->t_us / 1e6, mode);
+        }
+        else if (r->type == SIM_TL_LCD_MODE && r->a != mode)
+        {
+            if (r->a == 0x38)
+            {
+                s.hpm_entries++;
+                hpm_since = r->t_us;
+            }
+            else
+            {
+                s.lpm_entries++;
+                if (s.first_lpm_us == 0) s.first_lpm_us = r->t_us;
+                s.last_lpm_us = r->t_us;
+                CHECK(r->t_us >= last_frame + MS(LCD_MODE_IDLE_MS), "%s: LPM at %.3f s, %.3f s after a frame", name,
+                      r->t_us / 1e6, (r->t_us - last_frame) / 1e6);
+                CHECK(r->t_us <= (last_frame > hpm_since ? last_frame : hpm_since) + MS(LCD_MODE_IDLE_MS + IDLE_SLACK_MS),
+                      "%s: LPM only at %.3f s, idle since %.3f s", name, r->t_us / 1e6,
+                      (last_frame > hpm_since ? last_frame : hpm_since) / 1e6);
+                CHECK(r->t_us < blink_from || r->t_us >= blink_to, "%s: LPM at %.3f s while blinking", name,
+                      r->t_us / 1e6);
+            }
+            mode = r->a;
+        }
+    }
+    return s;
+}
+
+typedef struct
+{
+    st7301_model_state_t panel;
+    energy_entry_t       ledger;
+} snapshot_t;
+
+static snapshot_t snapshot(void)
+{
+    return (snapshot_t){st7301_model_state(), energy_get_entry(ENERGY_LCD_HPM)};
+}
+
+/** Run until the screen is off again, check and print the interaction started at snapshot s0 */
+static seq_stats_t run_seq(const char *name, uint32_t *pos, snapshot_t s0, uint64_t duration_us, uint64_t blink_from,
+                           uint64_t blink_to)
+{
+    snapshot_t  s1;
+    seq_stats_t s;
+    uint64_t    hpm_ms, ledger_ms;
+
+    CHECK(sim_run(duration_us) == SIM_EXIT_TIME, "%s: run ended early", name);
+    s1 = snapshot();
+    s  = check_timeline(name, pos, blink_from, blink_to);
+
+    hpm_ms    = (s1.panel.hpm_us - s0.panel.hpm_us) / 1000;
+    ledger_ms = (uint64_t)(s1.ledger.active_10ms - s0.ledger.active_10ms) * 10;
+    printf("%-10s %6u %5u %5u %8llu %8llu %9llu\n", name, s.frames, s.hpm_entries, s.lpm_entries,
+           (unsigned long long)hpm_ms, (unsigned long long)(s1.panel.lpm_us - s0.panel.lpm_us) / 1000,
+           (unsigned long long)ledger_ms);
+
+    CHECK(!s1.panel.powered, "%s: screen still on", name);
+    CHECK(ledger_ms + LEDGER_SLACK_MS >= hpm_ms && ledger_ms <= hpm_ms + LEDGER_SLACK_MS,
+          "%s: ledger %llu ms in HPM, the panel %llu ms", name, (unsigned long long)ledger_ms,
+          (unsigned long long)hpm_ms);
+    return s;
+}
+
+int main(void)
+{
+    uint32_t    pos = 0;
+    uint64_t    t;
+    snapshot_t  s0;
+    seq_stats_t s;
+
+    scd4x_model_co2 = office_co2;
+    s0              = snapshot();
+    CHECK(sim_boot() == SIM_EXIT_TIME, "boot failed");
+
+    printf("%-10s %6s %5s %5s %8s %8s %9s\n", "sequence", "frames", "->HPM", "->LPM", "HPM ms", "LPM ms",
+           "ledger ms");
+
+    // power on: animation, the static main page, screen off after the timeout
+    s = run_seq("boot", &pos, s0, S(40), 0, 0);
+    CHECK(s.lpm_entries >= 2, "boot: %u LPM entries, the animation and the main page each end in LPM",
+          s.lpm_entries);
+
+    // a press from screen off: the CO2 value blinks until a fresh sample or the screen goes off
+    s0 = snapshot();
+    t  = sim_now_us();
+    sim_press_key(100);
+    s = run_seq("wake", &pos, s0, S(20), t + MS(700), UINT64_MAX);
+    CHECK(s.frames >= 20, "wake: %u frames, the value did not blink", s.frames);
+
+    // wake, then a double press: the first setting blinks 5 s, then the page is static until the screen goes off
+    s0 = snapshot();
+    sim_press_key(100);
+    CHECK(sim_run(S(1)) == SIM_EXIT_TIME, "settings: run ended early");
+    sim_press_key(80);
+    CHECK(sim_run(MS(150)) == SIM_EXIT_TIME, "settings: run ended early");
+    sim_press_key(80);
+    t = sim_now_us();
+    s = run_seq("settings", &pos, s0, S(20), 0, t + S(5));
+    CHECK(s.lpm_entries >= 1, "settings: no LPM after the blink ended");
+
+    return check_failures();
+}
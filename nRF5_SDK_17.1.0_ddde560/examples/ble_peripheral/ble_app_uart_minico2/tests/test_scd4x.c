@@ -0,0 +1,479 @@
+/**
+ * The sensor stack of co2.c and driver_scd4x.c against the SCD4x model:
+ * startup command sequence, execution time budgets, command counts per
+ * sample, the sensor charge per sample of single shot against periodic
+ * measurement, the low power periodic profile of HI mode selected with
+ * CMD_SET_CO2_PROFILE, the CPU time of task_co2_read per sample (host time,
+ * no busy waits), the response to a CO2 step and the staged recovery
+ * from each injected fault. The phases share one boot and run in order.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "check.h"
+#include "co2.h"
+#include "protocol.h"
+#include "scd4x_model.h"
+#include "sim.h"
+#include "ttask.h"
+
+#define S(s)   ((uint64_t)(s) * 1000000)
+#define MIN(m) S((m) * 60)
+
+/** Host time of task_co2_read per sample, at -O2; about 1 ms, the slack is for loaded hosts */
+#define MAX_TASK_NS_PER_SAMPLE 10000000
+
+static uint16_t co2_level = 600;
+
+/** Sensor charge per sample in LOW mode, uA * s, and the interval between samples, from test_budget */
+static double low_uas_per_sample;
+static double low_interval_s;
+
+/** task_co2_read is wrapped (Makefile): its calls, host time and busy waits */
+static uint32_t co2_task_calls;
+static uint64_t co2_task_ns;
+static uint64_t co2_task_busy_us;
+
+unsigned char __real_task_co2_read(task_control_block_t *tcb);
+
+unsigned char __wrap_task_co2_read(task_control_block_t *tcb)
+{
+    uint64_t      busy = sim_busy_us;
+    uint64_t      t0   = sim_host_ns();
+    unsigned char ret  = __real_task_co2_read(tcb);
+
+    co2_task_ns += sim_host_ns() - t0;
+    co2_task_busy_us += sim_busy_us - busy;
+    co2_task_calls++;
+    return ret;
+}
+
+static uint16_t co2_wave(uint64_t t_us)
+{
+    (void)t_us;
+    return co2_level;
+}
+
+/** Run one second at a time until cond holds, returns false on timeout */
+#define RUN_UNTIL(cond, timeout_us)                                                         \
+    ({                                                                                      \
+        uint64_t end_ = sim_now_us() + (timeout_us);                                        \
+        while (!(cond) && sim_now_us() < end_ && sim_run(S(1)) == SIM_EXIT_TIME)            \
+        {                                                                                   \
+        }                                                                                   \
+        (bool)(cond);                                                                       \
+    })
+
+static uint32_t samples(void)
+{
+    return sim_tl_count_type(SIM_TL_CO2_SAMPLE);
+}
+
+static uint32_t power_cycles(void)
+{
+    return sim_tl_count_type_a(SIM_TL_CO2_POWER, 0);
+}
+
+static bool degraded(void)
+{
+    return EventGroupCheckBits(event_group_system, EVT_CO2_SENSOR_ERROR) && scd4x_model_mode() == SCD4X_MODEL_OFF;
+}
+
+/** A sample read and taken after the fault, the recovery stage back to retry */
+static bool recovered(uint32_t samples_before)
+{
+    return samples() > samples_before && get_sensor_recovery_attempt() == 0 && get_co2_value() != 0;
+}
+
+/** Longest time from a single shot to its read measurement and the most data ready polls in between */
+static void single_shot_timing(uint32_t from, uint64_t *max_us, uint32_t *max_polls)
+{
+    uint64_t start = 0;
+    uint32_t polls = 0;
+
+    *max_us    = 0;
+    *max_polls = 0;
+    for (uint32_t i = from; i < sim_tl_count(); i++)
+    {
+        const sim_tl_t *r = sim_tl_get(i);
+
+        if (r->type != SIM_TL_CO2_CMD || r->b != 0) continue;
+        if (r->a == 0x219D)
+        {
+            start = r->t_us;
+            polls = 0;
+        }
+        else if (r->a == 0xE4B8)
+        {
+            polls++;
+        }
+        else if (r->a == 0xEC05 && start != 0)
+        {
+            if (r->t_us - start > *max_us) *max_us = r->t_us - start;
+            if (polls > *max_polls) *max_polls = polls;
+            start = 0;
+        }
+    }
+}
+
+/** Shortest and longest time between sample reads from timeline record from on, returns the number of reads */
+static uint32_t sample_gaps(uint32_t from, uint64_t *min_us, uint64_t *max_us)
+{
+    uint64_t last  = 0;
+    uint32_t count = 0;
+
+    *min_us = UINT64_MAX;
+    *max_us = 0;
+    for (uint32_t i = from; i < sim_tl_count(); i++)
+    {
+        const sim_tl_t *r = sim_tl_get(i);
+
+        if (r->type != SIM_TL_CO2_SAMPLE) continue;
+        if (count++ > 0)
+        {
+            if (r->t_us - last < *min_us) *min_us = r->t_us - last;
+            if (r->t_us - last > *max_us) *max_us = r->t_us - last;
+        }
+        last = r->t_us;
+    }
+    return count;
+}
+
+/** Acknowledged command codes in order from timeline record from, up to n */
+static uint32_t commands_from(uint32_t from, uint16_t *cmds, uint32_t n)
+{
+    uint32_t count = 0;
+
+    for (uint32_t i = from; i < sim_tl_count() && count < n; i++)
+    {
+        const sim_tl_t *r = sim_tl_get(i);
+
+        if (r->type == SIM_TL_CO2_CMD && r->b == 0) cmds[count++] = (uint16_t)r->a;
+    }
+    return count;
+}
+
+static void test_startup(void)
+{
+    uint16_t cmds[8];
+    uint32_t n;
+
+    CHECK(sim_boot() == SIM_EXIT_TIME, "boot failed");
+    CHECK(RUN_UNTIL(samples() >= 1, S(60)), "no sample within 60 s of boot");
+
+    // a fresh board resets the sensor, then stops it before any configuration (datasheet 3.8), reads the
+    // variant and the serial number and takes a single shot in LOW mode
+    n = commands_from(0, cmds, 8);
+    CHECK(n >= 4 && cmds[0] == 0x3632 && cmds[1] == 0x3F86, "first commands 0x%04X 0x%04X", cmds[0], cmds[1]);
+    CHECK(scd4x_model_cmd_count(0x202F) == 1, "variant read %u times", scd4x_model_cmd_count(0x202F));
+    CHECK(scd4x_model_cmd_count(0x3682) == 1, "serial read %u times", scd4x_model_cmd_count(0x3682));
+    CHECK(scd4x_model_cmd_count(0x219D) == 1, "%u single shots", scd4x_model_cmd_count(0x219D));
+    CHECK(scd4x_model_cmd_count(0x21B1) == 0 && scd4x_model_cmd_count(0x21AC) == 0, "periodic measurement in LOW mode");
+
+    // every command waited for the power up and the execution time of the previous one
+    CHECK(scd4x_model_stats.early == 0, "%u commands sent too early", scd4x_model_stats.early);
+    CHECK(scd4x_model_stats.crc_errors == 0, "%u parameter CRC errors", scd4x_model_stats.crc_errors);
+    CHECK(get_co2_value() == 600, "CO2 %u ppm", get_co2_value());
+}
+
+static void test_budget(void)
+{
+    uint32_t from      = sim_tl_count();
+    uint32_t samples0  = samples();
+    uint32_t polls0    = scd4x_model_cmd_count(0xE4B8);
+    uint64_t bus0      = sim_twi_stats.bus_us;
+    uint32_t transfers = sim_twi_stats.transfers;
+    double   charge0   = scd4x_model_charge_uas();
+    uint32_t calls0    = co2_task_calls;
+    uint64_t task_ns   = co2_task_ns;
+    uint64_t busy_us   = co2_task_busy_us;
+    uint32_t n;
+    uint64_t max_us;
+    uint32_t max_polls;
+
+    sim_run(S(3600));
+    n = samples() - samples0;
+    single_shot_timing(from, &max_us, &max_polls);
+    low_uas_per_sample = (scd4x_model_charge_uas() - charge0) / n;
+    low_interval_s     = 3600.0 / n;
+    task_ns            = (co2_task_ns - task_ns) / n;
+    busy_us            = (co2_task_busy_us - busy_us) / n;
+
+    printf("budget: %u samples/h, %.1f data ready polls, %u TWI transfers and %.2f ms bus time per sample, "
+           "single shot to read %.2f s\n",
+           n, (double)(scd4x_model_cmd_count(0xE4B8) - polls0) / n, (sim_twi_stats.transfers - transfers) / n,
+           (sim_twi_stats.bus_us - bus0) / 1000.0 / n, max_us / 1e6);
+    printf("budget: task_co2_read %.1f runs, %.1f us host time and %llu us busy waits per sample\n",
+           (double)(co2_task_calls - calls0) / n, task_ns / 1e3, (unsigned long long)busy_us);
+
+    // 180..210 s in LOW mode with a flat reading
+    CHECK_RANGE(n, 3600 / 210, 3600 / 180 + 1);
+    CHECK(max_us >= S(5) && max_us <= S(5) + (CO2_DRDY_POLLS + 1) * CO2_DRDY_POLL_MS * 1000ull,
+          "single shot read after %llu us", (unsigned long long)max_us);
+    CHECK(max_polls <= CO2_DRDY_POLLS + 1, "%u data ready polls", max_polls);
+    CHECK((sim_twi_stats.transfers - transfers) / n <= 6, "%u TWI transfers per sample",
+          (sim_twi_stats.transfers - transfers) / n);
+    CHECK((sim_twi_stats.bus_us - bus0) / n < 5000, "%llu us bus time per sample",
+          (unsigned long long)((sim_twi_stats.bus_us - bus0) / n));
+    CHECK(scd4x_model_stats.early == 0 && scd4x_model_stats.nacks == 0, "%u early, %u NACKs", scd4x_model_stats.early,
+          scd4x_model_stats.nacks);
+
+    // the task sleeps through the transfers and the execution times, the CPU only polls and decodes
+    CHECK(busy_us == 0, "task_co2_read busy waited %llu us per sample", (unsigned long long)busy_us);
+    CHECK(task_ns < MAX_TASK_NS_PER_SAMPLE, "task_co2_read took %llu ns host time per sample",
+          (unsigned long long)task_ns);
+}
+
+/**
+ * The same samples with periodic measurement kept running, as HI mode does: the sensor draws the periodic
+ * current for the whole interval instead of one single shot and idle
+ */
+static void test_energy(void)
+{
+    uint32_t samples0;
+    double   charge0, periodic_ua, periodic_uas;
+
+    set_power_mode(PWR_MODE_HI);
+    CHECK(RUN_UNTIL(scd4x_model_mode() == SCD4X_MODEL_PERIODIC, S(30)), "no periodic measurement in HI mode");
+    sim_run(S(10));
+    samples0 = samples();
+    charge0  = scd4x_model_charge_uas();
+    sim_run(MIN(10));
+    periodic_ua  = (scd4x_model_charge_uas() - charge0) / 600;
+    periodic_uas = periodic_ua * low_interval_s;
+
+    printf("energy: single shot %.1f mAs per sample, periodic %.0f uA (%u samples in 10 min), %.1f mAs per %.0f s "
+           "sample, %.1fx saved\n",
+           low_uas_per_sample / 1000, periodic_ua, samples() - samples0, periodic_uas / 1000, low_interval_s,
+           periodic_uas / low_uas_per_sample);
+
+    // a shot is 75 mAs plus idle, periodic draws 15 mA for the whole interval
+    CHECK_RANGE(low_uas_per_sample, 75000, 75000 + 200 * (low_interval_s + 1));
+    CHECK(periodic_uas >= 10 * low_uas_per_sample, "single shot saves only %.1fx", periodic_uas / low_uas_per_sample);
+
+    set_power_mode(PWR_MODE_LOW);
+    CHECK(RUN_UNTIL(scd4x_model_mode() == SCD4X_MODEL_IDLE, S(30)), "periodic measurement kept running in LOW mode");
+    sim_run(MIN(10));
+}
+
+static uint8_t profile_reply = 0xFF;
+
+static void profile_rx(const uint8_t *frame, uint16_t len)
+{
+    if (len == 6 && frame[2] == CMD_SET_CO2_PROFILE) profile_reply = frame[4];
+}
+
+/** CMD_SET_CO2_PROFILE from the central, returns the profile the reply reports */
+static uint8_t send_profile(uint8_t profile)
+{
+    uint8_t frame[6] = {CMD_FIRST_BYTE, CMD_SECOND_BYTE, CMD_SET_CO2_PROFILE, 1, profile};
+
+    for (uint8_t i = 0; i < 5; i++) frame[5] += frame[i];
+    profile_reply = 0xFF;
+    sim_nus_rx(frame, sizeof(frame));
+    sim_run(S(1));
+    return profile_reply;
+}
+
+/** The HI mode measurement restarted with cmd: stopped first, then started, no other start in between */
+static void check_restart(uint32_t from, uint16_t cmd, const char *name)
+{
+    uint16_t cmds[64];
+    uint32_t n     = commands_from(from, cmds, 64);
+    uint32_t start = n;
+
+    for (uint32_t i = 0; i < n; i++)
+    {
+        CHECK(cmds[i] != (cmd == 0x21AC ? 0x21B1 : 0x21AC), "%s: 0x%04X sent", name, cmds[i]);
+        if (cmds[i] == cmd && start == n) start = i;
+    }
+    CHECK(start < n, "%s: no 0x%04X", name, cmd);
+    CHECK(start > 0 && cmds[start - 1] == 0x3F86, "%s: 0x%04X not preceded by stop", name, cmd);
+}
+
+/** HI mode with the low power periodic profile: a sample every 30 s at a fraction of the periodic current */
+static void test_low_power_periodic(void)
+{
+    uint32_t from;
+    uint64_t min_us, max_us;
+    uint32_t n, polls0;
+    double   charge0, lp_ua;
+
+    sim_nus_tx_hook = profile_rx;
+    sim_ble_connect(true);
+    set_power_mode(PWR_MODE_HI);
+    CHECK(RUN_UNTIL(scd4x_model_mode() == SCD4X_MODEL_PERIODIC, S(30)), "no periodic measurement in HI mode");
+    CHECK(send_profile(0xFF) == CO2_PROFILE_PERIODIC, "profile read back as %u", profile_reply);
+    CHECK(send_profile(CO2_PROFILE_SINGLE_SHOT) == CO2_PROFILE_PERIODIC, "single shot accepted as HI mode profile");
+
+    from = sim_tl_count();
+    CHECK(send_profile(CO2_PROFILE_LOW_POWER_PERIODIC) == CO2_PROFILE_LOW_POWER_PERIODIC, "profile reply %u",
+          profile_reply);
+    CHECK(RUN_UNTIL(scd4x_model_mode() == SCD4X_MODEL_LOW_POWER_PERIODIC, S(30)), "profile not switched");
+    check_restart(from, 0x21AC, "to low power");
+
+    // the gaps count from the first low power sample, 30 s after the restart
+    n = samples();
+    CHECK(RUN_UNTIL(samples() > n, S(40)), "no sample after the switch to low power");
+    from    = sim_tl_count();
+    polls0  = scd4x_model_cmd_count(0xE4B8);
+    charge0 = scd4x_model_charge_uas();
+    sim_run(MIN(10));
+    n     = sample_gaps(from, &min_us, &max_us);
+    lp_ua = (scd4x_model_charge_uas() - charge0) / 600;
+
+    printf("low power periodic: %u samples in 10 min, %.1f..%.1f s apart, %.1f data ready polls per sample, %.0f uA\n",
+           n, min_us / 1e6, max_us / 1e6, (double)(scd4x_model_cmd_count(0xE4B8) - polls0) / n, lp_ua);
+    CHECK_RANGE(n, 19, 21);
+    CHECK(min_us >= S(30) - S(1) && max_us <= S(30) + (CO2_DRDY_POLLS + 1) * CO2_DRDY_POLL_MS * 1000ull,
+          "samples %.1f..%.1f s apart", min_us / 1e6, max_us / 1e6);
+    CHECK((scd4x_model_cmd_count(0xE4B8) - polls0) <= n * (CO2_DRDY_POLLS + 1), "%u data ready polls for %u samples",
+          scd4x_model_cmd_count(0xE4B8) - polls0, n);
+    CHECK_RANGE(lp_ua, 3200 - 1, 3200 + 1);
+    CHECK(scd4x_model_stats.early == 0 && scd4x_model_stats.nacks == 0, "%u early, %u NACKs", scd4x_model_stats.early,
+          scd4x_model_stats.nacks);
+
+    // and back to periodic
+    from = sim_tl_count();
+    CHECK(send_profile(CO2_PROFILE_PERIODIC) == CO2_PROFILE_PERIODIC, "profile reply %u", profile_reply);
+    CHECK(RUN_UNTIL(scd4x_model_mode() == SCD4X_MODEL_PERIODIC, S(40)), "profile not switched back");
+    check_restart(from, 0x21B1, "to periodic");
+    from = sim_tl_count();
+    sim_run(MIN(1));
+    n = sample_gaps(from, &min_us, &max_us);
+    CHECK(n >= 11 && max_us <= S(6), "periodic again: %u samples, up to %.1f s apart", n, max_us / 1e6);
+
+    sim_ble_connect(false);
+    sim_nus_tx_hook = NULL;
+    set_power_mode(PWR_MODE_LOW);
+    CHECK(RUN_UNTIL(scd4x_model_mode() == SCD4X_MODEL_IDLE, S(30)), "periodic measurement kept running in LOW mode");
+    sim_run(MIN(10));
+}
+
+static void test_step(void)
+{
+    uint32_t samples0 = samples();
+
+    // a step shortens the adaptive interval, the filter follows within a few samples
+    co2_level = 1500;
+    CHECK(RUN_UNTIL(abs((int)get_co2_value() - 1500) <= 30, MIN(10)), "CO2 %u ppm 10 min after a step to 1500",
+          get_co2_value());
+    printf("step: 600 -> 1500 ppm followed after %u samples\n", samples() - samples0);
+    CHECK(samples() - samples0 <= 4, "%u samples to follow a step", samples() - samples0);
+    co2_level = 600;
+    CHECK(RUN_UNTIL(abs((int)get_co2_value() - 600) <= 30, MIN(10)), "CO2 %u ppm 10 min after a step back to 600",
+          get_co2_value());
+    sim_run(MIN(15));
+}
+
+/** A single transfer fault costs one error, reported with error_code, and is recovered by the retry */
+static void test_transient(scd4x_model_fault_t fault, const char *name, uint8_t error_code)
+{
+    uint32_t samples0;
+    uint32_t recovers = scd4x_model_stats.bus_recovers;
+    uint32_t reinits  = scd4x_model_cmd_count(0x3646);
+    uint32_t cycles   = power_cycles();
+
+    scd4x_model_inject(fault, 1);
+    CHECK(RUN_UNTIL(scd4x_model_fault() == SCD4X_MODEL_FAULT_NONE, MIN(5)), "%s fault not hit", name);
+    samples0 = samples();
+    CHECK(RUN_UNTIL(get_sensor_recovery_attempt() == 1, S(2)), "%s fault not detected", name);
+    CHECK(get_error_code() == error_code, "%s fault reported as error %u", name, get_error_code());
+    CHECK(RUN_UNTIL(recovered(samples0), MIN(5)), "no recovery from a %s fault", name);
+    CHECK(abs((int)get_co2_value() - 600) <= 30, "CO2 %u ppm after a %s fault", get_co2_value(), name);
+    CHECK(scd4x_model_stats.bus_recovers == recovers && scd4x_model_cmd_count(0x3646) == reinits &&
+              power_cycles() == cycles,
+          "%s fault escalated past the retry", name);
+}
+
+/** SDA held low until the first bus recovery: the bus clear stage fixes it */
+static void test_sda_low(void)
+{
+    uint32_t samples0 = samples();
+    uint32_t recovers = scd4x_model_stats.bus_recovers;
+    uint32_t reinits  = scd4x_model_cmd_count(0x3646);
+    uint32_t cycles   = power_cycles();
+
+    scd4x_model_inject(SCD4X_MODEL_FAULT_SDA_LOW, 0);
+    CHECK(RUN_UNTIL(recovered(samples0) && scd4x_model_fault() == SCD4X_MODEL_FAULT_NONE, MIN(5)),
+          "no recovery from SDA low");
+    CHECK(scd4x_model_stats.bus_recovers == recovers + 1, "%u bus recoveries", scd4x_model_stats.bus_recovers - recovers);
+    CHECK(scd4x_model_cmd_count(0x3646) == reinits && power_cycles() == cycles, "SDA low escalated past the bus clear");
+}
+
+/** A hung sensor ignores the bus clear and the reinit command, the power cycle brings it back */
+static void test_hang(void)
+{
+    uint32_t samples0 = samples();
+    uint32_t cycles   = power_cycles();
+    uint64_t t0       = sim_now_us();
+
+    scd4x_model_inject(SCD4X_MODEL_FAULT_HANG, 0);
+    CHECK(RUN_UNTIL(recovered(samples0), MIN(5)), "no recovery from a hung sensor");
+    printf("hang: recovered after %.1f s\n", (sim_now_us() - t0) / 1e6);
+    CHECK(power_cycles() == cycles + 1, "%u power cycles", power_cycles() - cycles);
+    CHECK(!degraded(), "degraded after a successful power cycle");
+}
+
+/** Data never ready: every stage fails, the sensor goes off until the degraded retry finds it working */
+static void test_not_ready(void)
+{
+    uint32_t samples0 = samples();
+    uint32_t recovers = scd4x_model_stats.bus_recovers;
+    uint32_t reinits  = scd4x_model_cmd_count(0x3646);
+    uint32_t cycles   = power_cycles();
+    uint64_t t0       = sim_now_us();
+
+    scd4x_model_inject(SCD4X_MODEL_FAULT_NOT_READY, SCD4X_MODEL_FAULT_FOREVER);
+    CHECK(RUN_UNTIL(degraded(), MIN(5)), "not degraded 5 min after data stopped");
+    printf("not ready: degraded after %.1f s\n", (sim_now_us() - t0) / 1e6);
+    CHECK(scd4x_model_stats.bus_recovers == recovers + 1, "%u bus clears", scd4x_model_stats.bus_recovers - recovers);
+    CHECK(scd4x_model_cmd_count(0x3646) == reinits + 1, "%u reinits", scd4x_model_cmd_count(0x3646) - reinits);
+    CHECK(power_cycles() == cycles + 2, "%u power cycles", power_cycles() - cycles); // the stage and degraded
+    CHECK(get_co2_value() == 0, "CO2 %u ppm shown while degraded", get_co2_value());
+
+    // the sensor stays off, then the degraded retry finds it working again
+    sim_run(MIN(5));
+    CHECK(degraded() && samples() == samples0, "sensor used while degraded");
+    scd4x_model_inject(SCD4X_MODEL_FAULT_NONE, 0);
+    CHECK(RUN_UNTIL(recovered(samples0), CO2_RECOVERY_DEGRADED_RETRY_MS * 1000ull), "degraded retry did not recover");
+    printf("not ready: recovered after %.1f s\n", (sim_now_us() - t0) / 1e6);
+}
+
+/** Another sensor answers after the power cycle: degraded right away, without waiting for a fifth error */
+static void test_swapped(void)
+{
+    uint32_t cycles = power_cycles();
+    uint32_t reads  = scd4x_model_cmd_count(0x3682);
+
+    // hung until the power cycle, which brings up the other sensor
+    scd4x_model_inject(SCD4X_MODEL_FAULT_SWAPPED, 0);
+    scd4x_model_inject(SCD4X_MODEL_FAULT_HANG, 0);
+    CHECK(RUN_UNTIL(power_cycles() == cycles + 1, MIN(5)), "no power cycle");
+    CHECK(RUN_UNTIL(degraded(), S(30)), "a swapped sensor was not detected");
+    CHECK(scd4x_model_cmd_count(0x3682) == reads + 1, "serial not checked after the power cycle");
+    scd4x_model_inject(SCD4X_MODEL_FAULT_NONE, 0);
+}
+
+int main(void)
+{
+    scd4x_model_co2 = co2_wave;
+
+    test_startup();
+    test_budget();
+    test_energy();
+    test_low_power_periodic();
+    test_step();
+    test_transient(SCD4X_MODEL_FAULT_NACK, "NACK", ERROR_CODE_SENSOR_I2C_COMM_FAILURE);
+    test_transient(SCD4X_MODEL_FAULT_CRC, "CRC", ERROR_CODE_SENSOR_CRC_FAILURE);
+    test_transient(SCD4X_MODEL_FAULT_STATUS, "status", ERROR_CODE_SENSOR_NOT_READY);
+    test_sda_low();
+    test_hang();
+    test_not_ready();
+    test_swapped();
+
+    CHECK(sim_tl_count_type(SIM_TL_ERROR) == 0 && sim_tl_count_type(SIM_TL_RESET) == 0, "error or reset");
+    CHECK(sim_wdt_max_gap_ms < 2000, "watchdog fed after %u ms", sim_wdt_max_gap_ms);
+    return check_failures();
+}
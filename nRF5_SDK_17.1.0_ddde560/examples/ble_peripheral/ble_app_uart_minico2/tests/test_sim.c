@@ -0,0 +1,246 @@
+/**
+ * Seven days in LOW power mode on the simulator: the application boots on a
+ * fresh board, samples a daily CO2 profile, stores history, shows the screen
+ * after a key press and answers a phone on day 2. The timeline is checked
+ * against what the firmware is expected to do over that week.
+ *
+ *   build/test_sim [timeline.csv]
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "check.h"
+#include "co2.h"
+#include "energy.h"
+#include "protocol.h"
+#include "scd4x_model.h"
+#include "sim.h"
+#include "st7301_model.h"
+#include "zb25d16_model.h"
+
+#define S(s)   ((uint64_t)(s) * 1000000)
+#define MIN(m) S((m) * 60)
+#define HOUR   S(3600)
+#define DAY    (24 * HOUR)
+
+#define DAYS 7
+
+/** Occupied office: 450 ppm at night, a ramp to 1400 ppm between 9:00 and 10:00, back down by 18:00 */
+static uint16_t office_co2(uint64_t t_us)
+{
+    uint32_t s = (uint32_t)((t_us / 1000000) % 86400);
+
+    if (s < 9 * 3600 || s >= 18 * 3600) return 450;
+    if (s < 10 * 3600) return (uint16_t)(450 + (s - 9 * 3600) * 950 / 3600);
+    if (s < 15 * 3600) return 1400;
+    return (uint16_t)(1400 - (s - 15 * 3600) * 950 / (3 * 3600));
+}
+
+static uint32_t rx_co2_frames = 0;
+static uint16_t rx_co2_ppm    = 0;
+
+static void nus_tx(const uint8_t *frame, uint16_t len)
+{
+    if (len == 11 && frame[0] == CMD_FIRST_BYTE && frame[2] == CMD_GET_CO2_VALUE)
+    {
+        rx_co2_frames++;
+        rx_co2_ppm = (uint16_t)(frame[8] << 8 | frame[9]);
+    }
+}
+
+static void send_command(uint8_t cmd, const uint8_t *payload, uint8_t len)
+{
+    uint8_t  frame[32] = {CMD_FIRST_BYTE, CMD_SECOND_BYTE, cmd, len};
+    uint32_t sum       = 0;
+
+    memcpy(frame + 4, payload, len);
+    for (uint8_t i = 0; i < 4 + len; i++)
+    {
+        sum += frame[i];
+    }
+    frame[4 + len] = (uint8_t)sum;
+    sim_nus_rx(frame, (uint16_t)(5 + len));
+}
+
+/** Run in one hour steps so a failure is reported near where it happened */
+static sim_exit_t run_checked(uint64_t duration_us)
+{
+    sim_exit_t exit = SIM_EXIT_TIME;
+
+    while (duration_us > 0 && exit == SIM_EXIT_TIME)
+    {
+        uint64_t step = duration_us < HOUR ? duration_us : HOUR;
+
+        exit = sim_run(step);
+        duration_us -= step;
+    }
+    CHECK(exit == SIM_EXIT_TIME, "run ended with %d at %llu s (%s:%d)", exit,
+          (unsigned long long)(sim_now_us() / 1000000), sim_error_file ? sim_error_file : "-", sim_error_line);
+    return exit;
+}
+
+/** Gaps between consecutive samples, seconds */
+static void sample_gaps(uint32_t *min_s, uint32_t *max_s)
+{
+    uint64_t last = 0;
+
+    *min_s = UINT32_MAX;
+    *max_s = 0;
+    for (uint32_t i = 0; i < sim_tl_count(); i++)
+    {
+        const sim_tl_t *r = sim_tl_get(i);
+
+        if (r->type != SIM_TL_CO2_SAMPLE) continue;
+        if (last != 0)
+        {
+            uint32_t gap = (uint32_t)((r->t_us - last + 500000) / 1000000);
+            if (gap < *min_s) *min_s = gap;
+            if (gap > *max_s) *max_s = gap;
+        }
+        last = r->t_us;
+    }
+}
+
+/** Screen power ups other than at boot, at t_key and while the CO2 rises or stays high (predicted and crossed alarms) */
+static uint32_t lcd_unexpected_ups(uint64_t t_key)
+{
+    uint32_t n = 0;
+
+    for (uint32_t i = 0; i < sim_tl_count(); i++)
+    {
+        const sim_tl_t *r = sim_tl_get(i);
+        uint32_t        s = (uint32_t)((r->t_us / 1000000) % 86400);
+
+        if (r->type != SIM_TL_LCD_POWER || r->a == 0) continue;
+        if (r->t_us < S(1) || (r->t_us >= t_key && r->t_us < t_key + S(1))) continue;
+        if (s >= 9 * 3600 && s < 15 * 3600) continue;
+        n++;
+    }
+    return n;
+}
+
+/** Time the panel was powered, seconds */
+static uint32_t lcd_on_s(void)
+{
+    uint64_t on_us = 0;
+    uint64_t since = 0;
+    bool     on    = false;
+
+    for (uint32_t i = 0; i < sim_tl_count(); i++)
+    {
+        const sim_tl_t *r = sim_tl_get(i);
+
+        if (r->type != SIM_TL_LCD_POWER || (r->a != 0) == on) continue;
+        on = r->a != 0;
+        if (on)
+        {
+            since = r->t_us;
+        }
+        else
+        {
+            on_us += r->t_us - since;
+        }
+    }
+    if (on) on_us += sim_now_us() - since;
+    return (uint32_t)(on_us / 1000000);
+}
+
+int main(int argc, char **argv)
+{
+    uint64_t host_ns = sim_host_ns();
+    uint32_t gap_min_s, gap_max_s;
+    uint32_t samples, lcd_ups;
+    uint64_t t_key;
+
+    scd4x_model_co2 = office_co2;
+    sim_nus_tx_hook = nus_tx;
+
+    CHECK(sim_boot() == SIM_EXIT_TIME, "boot failed");
+    CHECK(get_power_mode() == PWR_MODE_LOW, "power mode %d after a fresh boot", get_power_mode());
+
+    // day 1: the screen times out after boot, a key press at 12:00 shows it again
+    run_checked(12 * HOUR);
+    CHECK(!st7301_model_state().powered, "screen still on at 12:00");
+    lcd_ups = st7301_model_state().power_ups;
+    t_key = sim_now_us();
+    sim_press_key(100);
+    run_checked(MIN(5));
+    CHECK(st7301_model_state().power_ups == lcd_ups + 1, "key press did not power the screen up");
+    CHECK(!st7301_model_state().powered, "screen still on 5 min after a key press");
+    run_checked(DAY - 12 * HOUR - MIN(5));
+
+    // day 2, 10:00: a phone connects for 30 minutes and polls the CO2 value
+    run_checked(10 * HOUR);
+    sim_ble_connect(true);
+    CHECK(sim_tl_count_type_a(SIM_TL_CONN, 1) == 1, "not advertising at day 2 10:00");
+    run_checked(S(2));
+    for (int i = 0; i < 30; i++)
+    {
+        send_command(CMD_GET_CO2_VALUE, NULL, 0);
+        run_checked(MIN(1));
+    }
+    // answers plus the value pushed with every sample while connected
+    CHECK(rx_co2_frames >= 30 && rx_co2_frames <= 30 + 30 * 60 / 60, "%u CO2 frames for 30 requests", rx_co2_frames);
+    CHECK_RANGE(rx_co2_ppm, 450, 1400);
+    sim_ble_connect(false);
+    run_checked(DAY - 10 * HOUR - S(2) - MIN(30));
+
+    // the rest of the week untouched
+    run_checked((DAYS - 2) * DAY);
+
+    host_ns = sim_host_ns() - host_ns;
+    samples = sim_tl_count_type(SIM_TL_CO2_SAMPLE);
+    sample_gaps(&gap_min_s, &gap_max_s);
+
+    printf("%d days in %.2f s host time (%.0fx), %u timeline records\n", DAYS, host_ns / 1e9,
+           (double)DAYS * 86400 / (host_ns / 1e9), sim_tl_count());
+    printf("co2: %u samples, gap %u..%u s, %u commands, %u NACKs\n", samples, gap_min_s, gap_max_s,
+           scd4x_model_stats.commands, scd4x_model_stats.nacks);
+    printf("flash: %u programs (%u bytes), %u erases, %u reads\n", zb25d16_model_stats.programs,
+           zb25d16_model_stats.program_bytes, zb25d16_model_stats.erases, zb25d16_model_stats.reads);
+    printf("lcd: %u power ups, %u s on; nus: %u tx, %u rx; wdt: %u ms longest gap\n",
+           st7301_model_state().power_ups, lcd_on_s(), sim_tl_count_type(SIM_TL_NUS_TX),
+           sim_tl_count_type(SIM_TL_NUS_RX), sim_wdt_max_gap_ms);
+    printf("energy: %u uA average\n", energy_get_average_ua());
+
+    // nothing went wrong
+    CHECK(sim_tl_count_type(SIM_TL_ERROR) == 0, "APP_ERROR_CHECK failed");
+    CHECK(sim_tl_count_type(SIM_TL_RESET) == 0, "reset");
+    CHECK(sim_tl_count_type(SIM_TL_WDT_STARVED) == 0, "watchdog starved");
+    CHECK(sim_wdt_max_gap_ms < 2000, "watchdog fed after %u ms", sim_wdt_max_gap_ms);
+    CHECK(sim_tl_count_type(SIM_TL_BOOT) == 1, "booted more than once");
+    CHECK(scd4x_model_stats.nacks == 0, "%u sensor NACKs", scd4x_model_stats.nacks);
+
+    // LOW mode samples adaptively between 60 s and 210 s, single shot, sensor powered throughout; the key
+    // press asks for one more sample, which can follow the previous one by the single shot time
+    CHECK_RANGE(samples, DAYS * 86400 / 210 - 2, DAYS * 86400 / 60);
+    CHECK(gap_min_s >= 5 && gap_max_s <= 212, "sample gaps %u..%u s", gap_min_s, gap_max_s);
+    CHECK(sim_tl_count_type_a(SIM_TL_CO2_CMD, 0x219D) >= samples, "not single shot");
+    CHECK(sim_tl_count_type_a(SIM_TL_CO2_CMD, 0x21B1) == 0 && sim_tl_count_type_a(SIM_TL_CO2_CMD, 0x21AC) == 0,
+          "periodic measurement started in LOW mode");
+    CHECK(sim_tl_count_type(SIM_TL_CO2_POWER) == 1, "sensor power cycled");
+    CHECK(abs((int)get_co2_value() - 450) <= 20, "CO2 %u ppm at midnight", get_co2_value());
+
+    // every sample is stored, history pages are erased as they are reused
+    CHECK(zb25d16_model_stats.programs >= samples, "%u programs for %u samples", zb25d16_model_stats.programs,
+          samples);
+    CHECK(zb25d16_model_stats.erases <= 1 + zb25d16_model_stats.program_bytes / 4096 + 1, "%u erases",
+          zb25d16_model_stats.erases);
+
+    // the screen is on after boot, after the key press and for the CO2 alarms of the working days
+    CHECK(lcd_unexpected_ups(t_key) == 0, "%u unexpected screen power ups", lcd_unexpected_ups(t_key));
+    CHECK(!st7301_model_state().powered, "screen on at the end");
+    CHECK(lcd_on_s() < DAYS * 120, "screen on for %u s", lcd_on_s());
+
+    if (argc > 1)
+    {
+        FILE *f = fopen(argv[1], "w");
+        if (f != NULL)
+        {
+            sim_tl_dump(f);
+            fclose(f);
+        }
+    }
+    return check_failures();
+}
@@ -0,0 +1,169 @@
+/**
+ * Retained event trace across resets. No boot: the ring is driven through
+ * trace_init / trace_add the way main() and the application do, and a reset
+ * is a longjmp out of trace_add at its __DMB(), after the entry is stored and
+ * before seq is advanced. Over many cut-off writes at every ring position:
+ *
+ *   - trace_init after each reset keeps the ring and counts the boot
+ *   - the entry cut off is never read back, the count and the order of the
+ *     others are unchanged
+ *   - CMD_GET_TRACE frames (proto_send_trace) carry the same entries, the
+ *     boot count and the chunking described in protocol.c
+ *
+ * The frames of the last chunked read are printed as hex, they decode with
+ * tools/trace_decode.py:
+ *
+ *   build/test_trace | python3 ../tools/trace_decode.py -
+ */
+
+#include <setjmp.h>
+#include <string.h>
+
+#include "check.h"
+#include "protocol.h"
+#include "sim.h"
+#include "trace.h"
+#include "ttask.h"
+
+#define RESETS 150
+
+static jmp_buf reset_jmp;
+static uint8_t frames[8][256];
+static uint8_t frame_len[8];
+static uint8_t frame_count;
+
+static void cut_off(void)
+{
+    longjmp(reset_jmp, 1);
+}
+
+static void capture(const uint8_t *frame, uint16_t len)
+{
+    if (frame_count < 8 && len <= sizeof(frames[0]))
+    {
+        memcpy(frames[frame_count], frame, len);
+        frame_len[frame_count++] = (uint8_t)len;
+    }
+}
+
+/** Add an entry and reset in the middle of it, then boot the ring again */
+static uint16_t add_and_reset(uint16_t arg16)
+{
+    sim_dmb_hook = cut_off;
+    if (setjmp(reset_jmp) == 0)
+    {
+        trace_add(TRACE_EVT_CO2_ERROR, 0xEE, arg16);
+        CHECK(false, "trace_add %u was not cut off", arg16);
+    }
+    sim_dmb_hook         = NULL;
+    sim_critical_nesting = 0;
+
+    return trace_init();
+}
+
+/** The ring must hold exactly the entries numbered first..next-1 in arg16, in order */
+static void check_ring(uint32_t first, uint32_t next, uint16_t boot)
+{
+    trace_entry_t e[TRACE_SIZE];
+    uint8_t       n = trace_read(0, e, TRACE_SIZE);
+
+    CHECK(trace_get_boot_count() == boot, "boot count %u, expected %u", trace_get_boot_count(), boot);
+    CHECK(n == next - first && trace_get_count() == n, "%u entries (count %u), expected %u", n, trace_get_count(),
+          next - first);
+    for (uint8_t i = 0; i < n; i++)
+    {
+        CHECK(e[i].arg16 == (uint16_t)(first + i) && e[i].event == TRACE_EVT_SCREEN_ON && e[i].tick == first + i,
+              "entry %u: event %u arg16 %u tick %u, expected %u", i, e[i].event, e[i].arg16, e[i].tick, first + i);
+    }
+}
+
+/** Read the trace in CMD_GET_TRACE chunks as the app does and compare with trace_read */
+static void check_frames(uint16_t boot)
+{
+    trace_entry_t e[TRACE_SIZE];
+    uint8_t       n     = trace_read(0, e, TRACE_SIZE);
+    uint8_t       start = 0;
+    uint8_t       got   = 0;
+
+    frame_count     = 0;
+    ble_state       = CONNECTED;
+    sim_nus_tx_hook = capture;
+    for (uint8_t f = 0; f < 8; f++)
+    {
+        uint8_t before = frame_count;
+
+        proto_send_trace(start);
+        if (frame_count == before) break;
+
+        const uint8_t *p = frames[before];
+        uint8_t        k = (uint8_t)(p[3] - 4) / 8;
+        uint8_t        sum = 0;
+
+        for (uint8_t i = 0; i < frame_len[before] - 1; i++) sum += p[i];
+        CHECK(p[0] == CMD_FIRST_BYTE && p[1] == CMD_SECOND_BYTE && p[2] == CMD_GET_TRACE, "frame %u header", f);
+        CHECK(frame_len[before] == p[3] + 5 && sum == p[frame_len[before] - 1], "frame %u length or checksum", f);
+        CHECK(((p[4] << 8) | p[5]) == boot && p[6] == n && p[7] == start, "frame %u: boot %u count %u start %u", f,
+              (p[4] << 8) | p[5], p[6], p[7]);
+        for (uint8_t i = 0; i < k && got + i < n; i++)
+        {
+            const uint8_t *q = p + 8 + i * 8;
+
+            CHECK(((uint32_t)q[0] << 24 | q[1] << 16 | q[2] << 8 | q[3]) == e[got + i].tick && q[4] == e[got + i].event &&
+                      ((q[6] << 8) | q[7]) == e[got + i].arg16,
+                  "frame %u entry %u differs from the ring", f, i);
+        }
+        got += k;
+        start += k;
+        if (k == 0) break;
+    }
+    sim_nus_tx_hook = NULL;
+    ble_state       = IDLE;
+
+    CHECK(got == n, "frames carried %u entries, the ring %u", got, n);
+}
+
+int main(void)
+{
+    uint32_t first = 0, next = 0;
+    uint16_t boot;
+    uint32_t rng = 12345;
+
+    // power-on: the retained RAM holds no valid ring
+    boot = trace_init();
+    CHECK(boot == 0 && trace_get_count() == 0, "power-on: boot %u, %u entries", boot, trace_get_count());
+
+    for (uint16_t r = 1; r <= RESETS; r++)
+    {
+        uint8_t adds;
+
+        rng  = rng * 1103515245 + 12345;
+        adds = (uint8_t)((rng >> 16) % 7); // walks the head over every ring position
+
+        for (uint8_t i = 0; i < adds; i++)
+        {
+            systemTickCount = next;
+            trace_add(TRACE_EVT_SCREEN_ON, 0, (uint16_t)next++);
+        }
+        if (next - first > TRACE_SIZE - 1) first = next - (TRACE_SIZE - 1);
+
+        boot = add_and_reset(0xDEAD);
+        CHECK(boot == r, "reset %u: trace_init returned boot %u", r, boot);
+        check_ring(first, next, r);
+    }
+
+    check_frames(boot);
+    printf("%u resets, %u entries written, %u kept, boot count %u, %u CMD_GET_TRACE frames\n", RESETS, next,
+           trace_get_count(), trace_get_boot_count(), frame_count);
+    for (uint8_t f = 0; f < frame_count; f++)
+    {
+        for (uint8_t i = 0; i < frame_len[f]; i++) printf("%02X%s", frames[f][i], i + 1 < frame_len[f] ? " " : "\n");
+    }
+
+    // CMD_GET_TRACE 0xFF clears, the boot count with it
+    trace_clear();
+    CHECK(trace_get_count() == 0 && trace_get_boot_count() == 0, "clear left %u entries, boot %u", trace_get_count(),
+          trace_get_boot_count());
+    CHECK(trace_init() == 1, "boot after clear");
+
+    return check_failures();
+}
@@ -0,0 +1,188 @@
+/**
+ * Every page and main page state rendered through the ST7301 model and
+ * compared with the golden images in golden/. Each frame's counters are
+ * printed: panel pixels changed, bytes sent, config getter calls.
+ *
+ *   build/test_ui                        compare, images go to build/ui/
+ *   UI_GOLDEN_UPDATE=1 build/test_ui     rewrite golden/ (make golden)
+ *
+ * A changed golden image is reviewed like code: look at build/ui/<name>.ppm.
+ */
+
+#include <string.h>
+
+#include "battery.h"
+#include "cfg_fstorage.h"
+#include "check.h"
+#include "co2.h"
+#include "sim.h"
+#include "ttask.h"
+#include "ui_host.h"
+#include "user.h"
+
+extern uint16_t co2_history[BAR_COUNT];
+
+/** 10:42 on 2025-03-01 */
+#define TIME_BASE (25 * 365 * 86400u + 59 * 86400u + 10 * 3600 + 42 * 60)
+
+static const char *blink_names[] = {
+    [UI_BLINK_CO2_FREQUENCY] = "frequency",
+    [UI_BLINK_ALARM]         = "alarm",
+    [UI_BLINK_VIBRATOR]      = "vibrator",
+    [UI_BLINK_HOUR]          = "hour",
+    [UI_BLINK_MINUTE]        = "minute",
+    [UI_BLINK_BLE]           = "ble",
+    [UI_BLINK_CO2_PPM_LABEL] = "ppm_label",
+    [UI_BLINK_CO2_VALUE]     = "co2_value",
+};
+
+/** A working day: the last hours of history rising from 500 to the current value */
+static void set_main_state(uint8_t ui_mode, uint16_t ppm)
+{
+    cfg_fstorage_set_ui_mode(ui_mode, cfg_fstorage_get_graph_max_value(), cfg_fstorage_get_graph_min_value());
+    update_elements_position(ui_mode);
+    ui_host_co2_ppm = ppm;
+    for (uint8_t i = 0; i < BAR_COUNT; i++)
+    {
+        co2_history[i] = ppm == 0 || i >= 24 ? 0 : (uint16_t)(ppm - (ppm - 500) * i / 24);
+    }
+}
+
+static void draw_main(void)
+{
+    ui_draw_main_page();
+}
+
+static void draw_recalibrating(void)
+{
+    ui_set_disp_page(UI_PAGE_RECALIBRATING);
+    ui_draw_bkg();
+    ui_draw_text(-1, 15, "CALIBRATING", true);
+    ui_draw_text(-1, 150, "Calibrate  outdoors", true);
+    ui_draw_recalibrating_countdown(540);
+}
+
+static void draw_correction(void)
+{
+    ui_draw_bkg();
+    ui_draw_text(-1, 15, "CORRECTION", true);
+    ui_draw_cc_value(-35);
+}
+
+static void draw_color_plate(void)
+{
+    ui_set_disp_page(UI_PAGE_COLOR_PLATE);
+    ui_draw_color_plate();
+}
+
+static void draw_passkey(void)
+{
+    uint8_t key[6] = {1, 2, 3, 4, 5, 6};
+
+    ui_set_disp_page(UI_PAGE_PASSKEY);
+    ui_draw_bkg();
+    ui_draw_passkey(key);
+}
+
+static void draw_bat_low(void)
+{
+    ui_set_disp_page(UI_PAGE_BAT_LOW);
+    ui_draw_bkg();
+    ui_draw_battery_low();
+}
+
+static void draw_power_on(void)
+{
+    ui_set_disp_page(UI_PAGE_POWER_ON);
+    ui_draw_bkg();
+    ui_draw_power_on();
+}
+
+/** Draw and refresh the full screen, compare with the golden image and print the counters */
+static ui_host_frame_t show(const char *name, void (*draw)(void))
+{
+    ui_host_frame_t f;
+    int             diff;
+
+    ui_host_begin();
+    draw();
+    f    = ui_host_flush(&rect_full_screen);
+    diff = ui_host_golden(name);
+
+    printf("%-22s %6u %6u %4u %5u %6llu %4u\n", name, f.pixels_changed, f.pixel_bytes, f.cmd_bytes,
+           f.spi_transfers, (unsigned long long)f.bus_us, f.getter_calls);
+    CHECK(diff == 0, "%s: %d pixels differ from golden/%s.pgm, see build/ui/%s.ppm", name, diff, name, name);
+    return f;
+}
+
+int main(void)
+{
+    ui_host_frame_t f;
+    char            name[32];
+
+    ui_host_init();
+    set_timebase(TIME_BASE);
+    set_time_set(true);
+    set_buzzer_state(1);
+    set_vibrator_state(0);
+    set_power_mode(PWR_MODE_LOW);
+    ble_state = ADVERTISING;
+
+    printf("%-22s %6s %6s %4s %5s %6s %4s\n", "frame", "pixels", "bytes", "cmd", "xfers", "bus_us", "cfg");
+
+    // main page in the three view modes; the first frame after power up sends every row
+    set_main_state(0, 850);
+    f = show("main_graph", draw_main);
+    CHECK(f.pixel_bytes == LCD_WIDTH * LCD_HIGHT, "first frame sent %u bytes", f.pixel_bytes);
+
+    // the colours are resolved once per frame, not per pixel; drawing the graph reads the scale per bar
+    CHECK(f.getter_calls < 4 * BAR_COUNT, "%u config reads for one frame", f.getter_calls);
+
+    // nothing changed, nothing is sent
+    f = show("main_graph", draw_main);
+    CHECK(f.pixel_bytes == 0 && f.pixels_changed == 0, "unchanged frame sent %u bytes", f.pixel_bytes);
+
+    set_main_state(1, 850);
+    show("main_bar", draw_main);
+    set_main_state(2, 850);
+    show("main_plain", draw_main);
+
+    // alarm level colours, connected, no data yet with the clock unset, do not disturb
+    set_main_state(0, 1650);
+    ble_state = CONNECTED;
+    show("main_red_connected", draw_main);
+    set_main_state(0, 0);
+    ble_state = IDLE;
+    set_time_set(false);
+    show("main_no_data", draw_main);
+    set_time_set(true);
+    set_main_state(0, 850);
+    ble_state = ADVERTISING;
+    cfg_fstorage_set_dnd_mode(1);
+    show("main_dnd", draw_main);
+    cfg_fstorage_set_dnd_mode(0);
+
+    // every blinking element in its hidden phase
+    for (ui_blink_t b = UI_BLINK_FIRST; b <= UI_BLINK_CO2_VALUE; b++)
+    {
+        ui_host_set_blink(b, UI_BOOL_FALSE);
+        snprintf(name, sizeof(name), "blink_%s", blink_names[b]);
+        show(name, draw_main);
+    }
+    ui_host_set_blink(UI_BLINK_NONE, UI_BOOL_TRUE);
+
+    // the other pages
+    EventGroupSetBits(event_group_system, EVT_CO2_SENSOR_ERROR);
+    show("sensor_error", draw_main);
+    EventGroupClearBits(event_group_system, EVT_CO2_SENSOR_ERROR);
+    show("recalibrating", draw_recalibrating);
+    show("correction", draw_correction);
+    show("color_plate", draw_color_plate);
+    show("passkey", draw_passkey);
+    show("bat_low", draw_bat_low);
+    show("power_on", draw_power_on);
+    f = show("off", ui_draw_off_screen);
+    CHECK(f.getter_calls == 0, "%u config reads for the off page", f.getter_calls);
+
+    return check_failures();
+}
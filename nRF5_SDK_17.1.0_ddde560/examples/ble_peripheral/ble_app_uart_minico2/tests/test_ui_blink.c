@@ -0,0 +1,120 @@
+/**
+ * Cost of one blink toggle for every blinking element of the main page, three
+ * ways: the blink layer redrawing only the element and refreshing its rows,
+ * the whole main page redrawn and refreshed dirty, and the whole page redrawn
+ * and sent in full as every toggle did before. CPU is the drawing plus the
+ * refresh in the task, host nanoseconds averaged over TOGGLES toggles; the
+ * ratio is what carries over to the target.
+ *
+ * After each layer toggle the page is redrawn in full: the canvas must not
+ * change, i.e. the layer drew what the page would have.
+ */
+
+#include <string.h>
+
+#include "cfg_fstorage.h"
+#include "check.h"
+#include "co2.h"
+#include "sim.h"
+#include "ui_host.h"
+#include "user.h"
+
+extern uint16_t co2_history[BAR_COUNT];
+
+#define TOGGLES 20
+
+static const char *blink_names[] = {
+    [UI_BLINK_CO2_FREQUENCY] = "frequency",
+    [UI_BLINK_ALARM]         = "alarm",
+    [UI_BLINK_VIBRATOR]      = "vibrator",
+    [UI_BLINK_HOUR]          = "hour",
+    [UI_BLINK_MINUTE]        = "minute",
+    [UI_BLINK_BLE]           = "ble",
+    [UI_BLINK_CO2_PPM_LABEL] = "ppm_label",
+    [UI_BLINK_CO2_VALUE]     = "co2_value",
+};
+
+typedef struct
+{
+    uint64_t ns;
+    uint32_t bytes;
+    uint32_t getters;
+} cost_t;
+
+/** 0 blink layer, 1 page redrawn and sent dirty, 2 page redrawn and sent in full */
+static cost_t toggle(ui_blink_t b, int how)
+{
+    cost_t          c = {0};
+    ui_host_frame_t f, check;
+
+    ui_host_set_blink(b, UI_BOOL_TRUE);
+    ui_host_begin();
+    ui_draw_main_page();
+    ui_host_flush(&rect_full_screen);
+
+    for (int i = 0; i < TOGGLES; i++)
+    {
+        if (how == 2) ui_refresh_invalidate();
+        f = ui_host_blink_toggle(how == 0);
+        c.ns += f.draw_ns + f.task_ns;
+        c.bytes += f.spi_bytes;
+        c.getters += f.getter_calls;
+
+        if (how == 0)
+        {
+            ui_host_begin();
+            ui_draw_main_page();
+            check = ui_host_flush(&rect_full_screen);
+            CHECK(check.pixel_bytes == 0, "%s toggle %d: the page redraw sent %u more bytes", blink_names[b], i,
+                  check.pixel_bytes);
+        }
+    }
+    c.ns /= TOGGLES;
+    c.bytes /= TOGGLES;
+    c.getters /= TOGGLES;
+    return c;
+}
+
+int main(void)
+{
+    cost_t layer, page, full;
+    double layer_total = 0, page_total = 0;
+
+    ui_host_init();
+    set_timebase(10 * 3600 + 42 * 60);
+    set_time_set(true);
+    set_buzzer_state(1);
+    set_power_mode(PWR_MODE_LOW);
+    ble_state       = ADVERTISING;
+    ui_host_co2_ppm = 850;
+    for (uint8_t i = 0; i < 20; i++)
+    {
+        co2_history[i] = (uint16_t)(850 - i * 15);
+    }
+
+    printf("%-10s %9s %9s %9s %7s %7s %7s %5s %5s\n", "blink", "layer ns", "page ns", "full ns", "layer B",
+           "page B", "full B", "cfg", "cfg<");
+    for (ui_blink_t b = UI_BLINK_FIRST; b <= UI_BLINK_CO2_VALUE; b++)
+    {
+        layer = toggle(b, 0);
+        page  = toggle(b, 1);
+        full  = toggle(b, 2);
+        layer_total += layer.ns;
+        page_total += page.ns;
+
+        printf("%-10s %9llu %9llu %9llu %7u %7u %7u %5u %5u\n", blink_names[b], (unsigned long long)layer.ns,
+               (unsigned long long)page.ns, (unsigned long long)full.ns, layer.bytes, page.bytes, full.bytes,
+               layer.getters, page.getters);
+
+        CHECK(layer.bytes <= page.bytes, "%s: the layer sent %u bytes, the page %u", blink_names[b], layer.bytes,
+              page.bytes);
+        CHECK(layer.getters < page.getters, "%s: %u config reads for the layer, %u for the page", blink_names[b],
+              layer.getters, page.getters);
+        CHECK(layer.ns < page.ns, "%s: the layer took %llu ns, the page %llu ns", blink_names[b],
+              (unsigned long long)layer.ns, (unsigned long long)page.ns);
+    }
+    ui_host_set_blink(UI_BLINK_NONE, UI_BOOL_TRUE);
+    printf("blink layer: %.1fx less CPU than a page redraw (host ns, -O2)\n",
+           page_total / (layer_total ? layer_total : 1));
+    return check_failures();
+}
@@ -0,0 +1,277 @@
+/**
+ * The byte-shifting blitter against the pixel loop it replaced. The old
+ * ui_draw_elem(), ui_draw_elem_inverted(), ui_undraw_rect() and
+ * ui_draw_fill_rect() are kept here, drawing the raw bitmaps into a second
+ * canvas; the blitter draws the stored assets, run-length encoded where
+ * ui_res.c holds them so.
+ *
+ * Every element of ui_res.c, every frame of its bitmap tables and every font
+ * character is drawn at its own position, at the eight bit offsets and
+ * clipped at the right and bottom edges, copied and inverted, over a random
+ * canvas; then RANDOM_CASES random bitmaps and assets at random places with
+ * all four operations. The canvases must be equal after every draw. The old
+ * loop wrote past the row end when not clipped, the reference clips like the
+ * blitter, so draws inside the canvas are compared exactly as before.
+ *
+ * The benchmark draws each element at its position; host nanoseconds, the
+ * ratio is what carries over to the target.
+ */
+
+#include <string.h>
+
+#include "check.h"
+#include "sim.h"
+#include "ui_host.h"
+
+#define RANDOM_CASES 200000
+#define BENCH_ITER   2000
+#define MAX_ASSETS   384
+
+typedef struct
+{
+    const char    *name;
+    ui_rect_t      rect; // own position
+    const uint8_t *pix;  // as stored
+    uint8_t        rle;
+    uint8_t        raw[2200]; // decoded, what the old loop drew
+} asset_t;
+
+static asset_t  assets[MAX_ASSETS];
+static uint32_t asset_count = 0;
+static uint8_t  ref[LCD_HIGHT][UI_HOST_STRIDE];
+static uint32_t seed = 0x2545F491;
+
+static uint32_t rnd(void)
+{
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+static void add(const char *name, const ui_rect_t *rect, const uint8_t *pix, uint8_t rle)
+{
+    asset_t *a   = &assets[asset_count];
+    uint16_t len = (rect->w + 7) / 8 * rect->h;
+
+    if (asset_count == MAX_ASSETS || len > sizeof(a->raw))
+    {
+        CHECK(0, "%s: no room for the asset", name);
+        return;
+    }
+    asset_count++;
+    a->name = name;
+    a->rect = *rect;
+    a->pix  = pix;
+    a->rle  = rle;
+    if (rle)
+    {
+        ui_host_rle_decode(pix, a->raw, len);
+    }
+    else
+    {
+        memcpy(a->raw, pix, len);
+    }
+}
+
+static void add_elem(const char *name, const ui_elem_t *elem)
+{
+    if (elem->pix != NULL)
+    {
+        add(name, &elem->rect, elem->pix, elem->rle);
+    }
+}
+
+/** Every element with each bitmap it is drawn with */
+static void add_assets(void)
+{
+    ui_elem_t *time[]    = {&elem_time_h10, &elem_time_h0, &elem_time_m10, &elem_time_m0};
+    ui_elem_t *ppm[]     = {&elem_ppm_1000x, &elem_ppm_100x, &elem_ppm_10x, &elem_ppm_1x, &elem_cali_sign_1000x,
+                            &elem_cali_time_100x, &elem_cali_time_10x, &elem_cali_time_1x};
+    ui_elem_t *passkey[] = {&passkey_1x, &passkey_10x, &passkey_100x, &passkey_1000x, &passkey_10000x, &passkey_100000x};
+    ui_rect_t  glyph     = {.x = 3, .y = 40, .w = FONT_WIDTH, .h = FONT_HEIGHT};
+
+    for (uint8_t e = 0; e < 4; e++)
+    {
+        for (uint8_t i = 0; i < 10; i++) add("time digit", &time[e]->rect, pix_time_num[i], 0);
+    }
+    for (uint8_t e = 0; e < 8; e++)
+    {
+        for (uint8_t i = 0; i < 12; i++) add("co2 digit", &ppm[e]->rect, UI_RLE_PIX(pix_co2_ppm_num, i), 1);
+    }
+    for (uint8_t e = 0; e < 6; e++)
+    {
+        for (uint8_t i = 0; i < 10; i++) add("passkey digit", &passkey[e]->rect, UI_RLE_PIX(pix_passkey_num, i), 1);
+    }
+    for (uint8_t i = 0; i < 4; i++) add("power mode", &elem_power_mode.rect, pix_power_mode[i], 0);
+    for (uint8_t i = 0; i < 96; i++)
+    {
+        glyph.x = 3 + i % 13;
+        add("font", &glyph, UI_RLE_PIX(font, i), 1);
+    }
+    add("ble off", &elem_ble.rect, pix_ble_off, 0);
+    add("alarm off", &elem_alarm.rect, pix_alarm_off, 0);
+    add("vibrator off", &elem_vibrator.rect, pix_vibrator_off, 0);
+    add("time dash", &elem_time_h10.rect, pixdash, 0);
+    add_elem("time split", &elem_time_split);
+    add_elem("alarm", &elem_alarm);
+    add_elem("vibrator", &elem_vibrator);
+    add_elem("flight mode", &elem_flight_mode);
+    add_elem("dnd", &elem_dnd);
+    add_elem("dnd off", &elem_dnd_off);
+    add_elem("battery", &elem_battery);
+    add_elem("ppm label", &elem_co2_ppm_label);
+    add_elem("ble", &elem_ble);
+    add_elem("indicator", &elem_indicator);
+    add_elem("sensor error", &elem_sensor_error);
+    add_elem("error code", &elem_sensor_error_code);
+    add_elem("bat low frame", &elem_bat_low_frame);
+    add_elem("bat low red", &elem_bat_low_red);
+    add_elem("bat low text", &elem_bat_low_text);
+    add_elem("airspot text", &elem_airspot_text);
+    add_elem("power on text", &elem_power_on_text);
+    add_elem("down arrow", &elem_down_arrow);
+    add_elem("calib off", &elem_calib_off);
+    add_elem("calib on", &elem_calib_on);
+}
+
+/** The old pixel loop, clipped to the canvas */
+static void ref_blit(const ui_rect_t *rect, const uint8_t *raw, uint8_t op)
+{
+    uint8_t stride = (rect->w + 7) / 8;
+
+    for (int row = 0; row < rect->h; row++)
+    {
+        for (int col = 0; col < rect->w; col++)
+        {
+            int  y = rect->y + row, x = rect->x + col;
+            bool set;
+
+            if (y >= LCD_HIGHT || x >= LCD_WIDTH) continue;
+            set = op == 2 || (op < 2 && (raw[row * stride + col / 8] & (1 << (col % 8))));
+            if (op == 1)
+            {
+                if (set) ref[y][x / 8] ^= 1 << (x % 8);
+            }
+            else if (set)
+            {
+                ref[y][x / 8] |= 1 << (x % 8);
+            }
+            else
+            {
+                ref[y][x / 8] &= ~(1 << (x % 8));
+            }
+        }
+    }
+}
+
+static void random_canvas(void)
+{
+    uint8_t *gram = ui_host_gram();
+
+    for (uint32_t i = 0; i < sizeof(ref); i++)
+    {
+        gram[i] = (uint8_t)rnd();
+    }
+    memcpy(ref, gram, sizeof(ref));
+}
+
+/** Draw both ways, returns 1 if the canvases differ */
+static uint32_t compare(const ui_rect_t *rect, const uint8_t *pix, uint8_t rle, const uint8_t *raw, uint8_t op)
+{
+    ref_blit(rect, raw, op);
+    ui_host_blit(rect, pix, rle, op);
+    return memcmp(ref, ui_host_gram(), sizeof(ref)) != 0;
+}
+
+int main(void)
+{
+    static const char *ops[] = {"copy", "xor", "set", "clear"};
+    static uint8_t     bits[64 * 8];
+    uint32_t           diff = 0, cases = 0;
+    ui_rect_t          r;
+    uint64_t           t, ref_ns, new_ns;
+    double             ref_total = 0, new_total = 0;
+
+    add_assets();
+
+    // every asset at its position, each bit offset, clipped right and bottom, copied and inverted
+    for (uint32_t i = 0; i < asset_count; i++)
+    {
+        asset_t *a = &assets[i];
+
+        for (uint8_t op = 0; op < 2; op++)
+        {
+            for (int k = -1; k < 10; k++)
+            {
+                r = a->rect;
+                if (k >= 0 && k < 8) r.x = (r.x & ~7) + k;
+                if (k == 8) r.x = LCD_WIDTH - (r.w + 1) / 2;
+                if (k == 9) r.y = LCD_HIGHT - (r.h + 1) / 2;
+                if (r.x + r.w > LCD_WIDTH && k < 8) continue; // the own position of a wide asset is not clipped
+                random_canvas();
+                if (compare(&r, a->pix, a->rle, a->raw, op))
+                {
+                    diff++;
+                    CHECK(0, "%s #%u %s at %u,%u differs", a->name, i, ops[op], r.x, r.y);
+                }
+                cases++;
+            }
+        }
+    }
+    printf("%u assets, %u placements, %u differ\n", asset_count, cases, diff);
+
+    // random bitmaps and assets, random place and operation
+    diff = 0;
+    random_canvas();
+    for (uint32_t n = 0; n < RANDOM_CASES; n++)
+    {
+        uint8_t op = rnd() % 4;
+
+        if (n % 2 == 0)
+        {
+            r.w = 1 + rnd() % 64;
+            r.h = 1 + rnd() % 8;
+            for (uint32_t i = 0; i < sizeof(bits); i++) bits[i] = (uint8_t)rnd();
+            r.x = rnd() % LCD_WIDTH;
+            r.y = rnd() % LCD_HIGHT;
+            diff += compare(&r, bits, 0, bits, op);
+        }
+        else
+        {
+            asset_t *a = &assets[rnd() % asset_count];
+
+            r   = a->rect;
+            r.x = rnd() % LCD_WIDTH;
+            r.y = rnd() % LCD_HIGHT;
+            diff += compare(&r, a->pix, a->rle, a->raw, op);
+        }
+        if (diff != 0)
+        {
+            CHECK(0, "random case %u: %s %ux%u at %u,%u differs", n, ops[op], r.w, r.h, r.x, r.y);
+            break;
+        }
+    }
+    printf("%u random cases, %u differ\n\n", RANDOM_CASES, diff);
+
+    // speed at the own position, first bitmap of each element
+    printf("%-16s %6s %9s %9s %7s\n", "asset", "pixels", "before ns", "after ns", "speedup");
+    for (uint32_t i = 0; i < asset_count; i++)
+    {
+        asset_t *a = &assets[i];
+
+        if (i > 0 && strcmp(a->name, assets[i - 1].name) == 0) continue;
+        t = sim_host_ns();
+        for (int n = 0; n < BENCH_ITER; n++) ref_blit(&a->rect, a->raw, 0);
+        ref_ns = (sim_host_ns() - t) / BENCH_ITER;
+        t      = sim_host_ns();
+        for (int n = 0; n < BENCH_ITER; n++) ui_host_blit(&a->rect, a->pix, a->rle, 0);
+        new_ns = (sim_host_ns() - t) / BENCH_ITER;
+        ref_total += ref_ns;
+        new_total += new_ns;
+        printf("%-16s %6u %9llu %9llu %6.1fx%s\n", a->name, a->rect.w * a->rect.h, (unsigned long long)ref_ns,
+               (unsigned long long)new_ns, (double)ref_ns / (new_ns ? new_ns : 1), a->rle ? " rle" : "");
+    }
+    printf("all assets: %.1fx faster (host ns, -O2)\n", ref_total / (new_total ? new_total : 1));
+    return check_failures();
+}
@@ -0,0 +1,243 @@
+/**
+ * Row conversion before and after the per-frame colour table. The old
+ * per-pixel ui_get_pix_forcolor() is kept here as the reference: every row of
+ * every page must convert to the same display bytes, and the cost per row and
+ * per frame is printed for both, with the config reads each frame makes.
+ *
+ * Timings are host nanoseconds, the ratio is what carries over to the target.
+ */
+
+#include <string.h>
+
+#include "cfg_fstorage.h"
+#include "check.h"
+#include "sim.h"
+#include "ui_host.h"
+#include "user.h"
+
+extern uint16_t co2_history[BAR_COUNT];
+extern uint8_t  get_ble_state(void);
+
+#define FRAMES 200
+
+/** ui_get_pix_forcolor() as it was before the colour table */
+static uint8_t ref_pix_forcolor(uint8_t x, uint8_t y)
+{
+    ui_page_t page = ui_get_disp_page();
+
+    if (page == UI_PAGE_MAIN)
+    {
+        if (cfg_fstorage_get_ui_mode() == 0)
+        {
+            if (x >= BAR_START_X && x < LCD_WIDTH && y >= BAR_START_Y && y <= LCD_HIGHT)
+            {
+                uint8_t  bar_index = (x - BAR_START_X) / (BAR_WIDTH + BAR_SPACING);
+                uint16_t ppm       = co2_history[BAR_COUNT - 1 - bar_index];
+
+                if (ppm == 0)
+                {
+                    return COLOR_BKG;
+                }
+                if ((uint8_t)(BAR_START_Y + BAR_HEIGHT - y) <= ui_get_bar_height_from_ppm(ppm))
+                {
+                    if (ppm < cfg_fstorage_get_graph_yellow_start()) return COLOR_GREEN;
+                    if (ppm < cfg_fstorage_get_graph_red_start()) return COLOR_YELLOW;
+                    return COLOR_RED;
+                }
+                return (x + y) % 4 == 0 ? COLOR_GRAY : COLOR_BKG;
+            }
+        }
+        else if (cfg_fstorage_get_ui_mode() == 1)
+        {
+            if (INRECT(x, y, &elem_rect_g)) return COLOR_GREEN;
+            if (INRECT(x, y, &elem_rect_y)) return COLOR_YELLOW;
+            if (INRECT(x, y, &elem_rect_r)) return COLOR_RED;
+        }
+
+        if (INRECT(x, y, &elem_ble.rect))
+        {
+            if (get_ble_state() == CONNECTED) return COLOR_BLE_CONN;
+            if (get_ble_state() == ADVERTISING) return COLOR_BLE_ADV;
+            return COLOR_BLE_DISCON;
+        }
+
+        if (INRECT(x, y, &elem_ppm_1000x.rect) || INRECT(x, y, &elem_ppm_100x.rect) ||
+            INRECT(x, y, &elem_ppm_10x.rect) || INRECT(x, y, &elem_ppm_1x.rect))
+        {
+            uint16_t ppm = get_co2_value();
+
+            if (ppm == 0) return COLOR_WHITE;
+            if (ppm < cfg_fstorage_get_graph_yellow_start()) return COLOR_GREEN;
+            if (ppm < cfg_fstorage_get_graph_red_start()) return COLOR_YELLOW;
+            return COLOR_RED;
+        }
+    }
+    else if (page == UI_PAGE_COLOR_PLATE)
+    {
+        return (y / 22) * 8 + x / 22;
+    }
+    else if (page == UI_PAGE_BAT_LOW)
+    {
+        if (INRECT(x, y, &elem_bat_low_red.rect)) return COLOR_RED;
+    }
+    else if (page == UI_PAGE_POWER_ON)
+    {
+        if (INRECT(x, y, &logo_g)) return COLOR_GREEN;
+        if (INRECT(x, y, &logo_y)) return COLOR_YELLOW;
+        if (INRECT(x, y, &logo_r)) return COLOR_RED;
+    }
+    return COLOR_WHITE;
+}
+
+/** ui_refresh_row() as it was: one colour lookup per set pixel */
+static void ref_render_row(uint8_t y, uint8_t *buf)
+{
+    const uint8_t *gram = ui_host_gram() + y * UI_HOST_STRIDE;
+
+    for (uint8_t col = 0; col < LCD_WIDTH; col++)
+    {
+        if (gram[col / 8] & (1 << (col % 8)))
+        {
+            buf[col] = ST7301_COLOR(ref_pix_forcolor(col, y));
+        }
+        else
+        {
+            buf[col] = ST7301_COLOR(COLOR_BKG);
+        }
+    }
+}
+
+static void set_main_state(uint8_t ui_mode, uint16_t ppm, uint8_t ble)
+{
+    cfg_fstorage_set_ui_mode(ui_mode, cfg_fstorage_get_graph_max_value(), cfg_fstorage_get_graph_min_value());
+    update_elements_position(ui_mode);
+    ui_host_co2_ppm = ppm;
+    ble_state       = ble;
+    for (uint8_t i = 0; i < BAR_COUNT; i++)
+    {
+        co2_history[i] = ppm == 0 || i >= 24 ? 0 : (uint16_t)(ppm + 40 * i - (i % 3) * 300);
+    }
+    ui_draw_main_page();
+}
+
+static void scene_graph(void)       { set_main_state(0, 850, 2); }
+static void scene_graph_red(void)   { set_main_state(0, 1650, 1); }
+static void scene_bar(void)         { set_main_state(1, 1100, 0); }
+static void scene_plain(void)       { set_main_state(2, 0, 2); }
+
+static void scene_color_plate(void)
+{
+    ui_set_disp_page(UI_PAGE_COLOR_PLATE);
+    ui_draw_color_plate();
+}
+
+static void scene_bat_low(void)
+{
+    ui_set_disp_page(UI_PAGE_BAT_LOW);
+    ui_draw_bkg();
+    ui_draw_battery_low();
+}
+
+static void scene_power_on(void)
+{
+    ui_set_disp_page(UI_PAGE_POWER_ON);
+    ui_draw_bkg();
+    ui_draw_power_on();
+}
+
+static const struct
+{
+    const char *name;
+    void (*draw)(void);
+} scenes[] = {
+    {"main graph", scene_graph},
+    {"main graph, red", scene_graph_red},
+    {"main bar", scene_bar},
+    {"main plain, no data", scene_plain},
+    {"colour plate", scene_color_plate},
+    {"low battery", scene_bat_low},
+    {"power on", scene_power_on},
+};
+
+int main(void)
+{
+    static uint8_t ref[LCD_HIGHT][LCD_WIDTH];
+    static uint8_t out[LCD_HIGHT][LCD_WIDTH];
+    uint64_t       t, ref_ns, new_ns;
+    uint32_t       ref_reads, new_reads, rows_diff;
+    double         ref_total = 0, new_total = 0;
+
+    ui_host_init();
+    set_timebase(10 * 3600 + 42 * 60);
+    set_time_set(true);
+
+    printf("%-22s %9s %9s %9s %9s %7s %9s %9s\n", "frame", "before/row", "after/row", "before", "after", "speedup",
+           "cfg before", "cfg after");
+    for (uint32_t s = 0; s < sizeof(scenes) / sizeof(scenes[0]); s++)
+    {
+        scenes[s].draw();
+
+        // same bytes for every row
+        for (uint8_t y = 0; y < LCD_HIGHT; y++)
+        {
+            ref_render_row(y, ref[y]);
+        }
+        ui_host_color_update();
+        for (uint8_t y = 0; y < LCD_HIGHT; y++)
+        {
+            ui_host_render_row(y, out[y]);
+        }
+        rows_diff = 0;
+        for (uint8_t y = 0; y < LCD_HIGHT; y++)
+        {
+            rows_diff += memcmp(ref[y], out[y], LCD_WIDTH) != 0;
+        }
+        CHECK(rows_diff == 0, "%s: %u rows convert differently", scenes[s].name, rows_diff);
+
+        // one frame each way, config reads counted
+        ui_host_getter_calls = 0;
+        for (uint8_t y = 0; y < LCD_HIGHT; y++)
+        {
+            ref_render_row(y, ref[y]);
+        }
+        ref_reads            = ui_host_getter_calls;
+        ui_host_getter_calls = 0;
+        ui_host_color_update();
+        for (uint8_t y = 0; y < LCD_HIGHT; y++)
+        {
+            ui_host_render_row(y, out[y]);
+        }
+        new_reads = ui_host_getter_calls;
+
+        t = sim_host_ns();
+        for (int f = 0; f < FRAMES; f++)
+        {
+            for (uint8_t y = 0; y < LCD_HIGHT; y++)
+            {
+                ref_render_row(y, ref[y]);
+            }
+        }
+        ref_ns = (sim_host_ns() - t) / FRAMES;
+        t      = sim_host_ns();
+        for (int f = 0; f < FRAMES; f++)
+        {
+            ui_host_color_update();
+            for (uint8_t y = 0; y < LCD_HIGHT; y++)
+            {
+                ui_host_render_row(y, out[y]);
+            }
+        }
+        new_ns = (sim_host_ns() - t) / FRAMES;
+        ref_total += ref_ns;
+        new_total += new_ns;
+
+        printf("%-22s %9.0f %9.0f %9llu %9llu %6.1fx %9u %9u\n", scenes[s].name, (double)ref_ns / LCD_HIGHT,
+               (double)new_ns / LCD_HIGHT, (unsigned long long)ref_ns, (unsigned long long)new_ns,
+               (double)ref_ns / (new_ns ? new_ns : 1), ref_reads, new_reads);
+
+        // the table reads each setting once per frame, not per pixel or per bar
+        CHECK(new_reads <= 5, "%s: %u config reads per frame", scenes[s].name, new_reads);
+    }
+    printf("all frames: %.1fx faster (host ns, -O2)\n", ref_total / (new_total ? new_total : 1));
+    return check_failures();
+}
@@ -0,0 +1,135 @@
+/**
+ * Bytes sent per typical UI event on the main page, dirty refresh against
+ * the full-screen refresh every event used to cost. Each event is sent dirty,
+ * then the same canvas is sent again in full after ui_refresh_invalidate();
+ * the panel must show the same image both times.
+ */
+
+#include <string.h>
+
+#include "battery.h"
+#include "cfg_fstorage.h"
+#include "check.h"
+#include "co2.h"
+#include "sim.h"
+#include "ui_host.h"
+#include "user.h"
+
+extern uint16_t co2_history[BAR_COUNT];
+
+#define TIME_BASE (25 * 365 * 86400u + 10 * 3600 + 42 * 60)
+
+static uint8_t img_dirty[ST7301_MODEL_H][ST7301_MODEL_W];
+static uint8_t img_full[ST7301_MODEL_H][ST7301_MODEL_W];
+
+static void minute_tick(void)
+{
+    set_timebase(get_time_now() + 60);
+}
+
+static void hour_tick(void)
+{
+    set_timebase(get_time_now() + 18 * 60);
+}
+
+/** New sample: the value changes and the graph shifts by one bar */
+static void co2_sample(void)
+{
+    memmove(co2_history + 1, co2_history, sizeof(co2_history) - sizeof(co2_history[0]));
+    ui_host_co2_ppm += 37;
+    co2_history[0] = ui_host_co2_ppm;
+}
+
+static void co2_same(void)
+{
+}
+
+static void ble_connect(void)
+{
+    ble_state = CONNECTED;
+}
+
+static void battery_drop(void)
+{
+    sim_config.battery_mv -= 120;
+    battery_state_update();
+}
+
+static void blink_on(void)
+{
+    ui_host_set_blink(UI_BLINK_MINUTE, UI_BOOL_FALSE);
+}
+
+static void blink_off(void)
+{
+    ui_host_set_blink(UI_BLINK_MINUTE, UI_BOOL_TRUE);
+}
+
+/** Events in order, with the most a dirty refresh may cost, percent of a full one */
+static const struct
+{
+    const char *name;
+    void (*apply)(void);
+    uint8_t max_pct;
+} events[] = {
+    {"minute tick", minute_tick, 5},
+    {"clock 10:43 -> 11:01", hour_tick, 5},
+    {"co2 sample", co2_sample, 50}, // the digits and every bar move
+    {"co2 sample, same value", co2_same, 0},
+    {"ble connected", ble_connect, 5},
+    {"battery level", battery_drop, 5},
+    {"blink minute hidden", blink_on, 5},
+    {"blink minute shown", blink_off, 5},
+};
+
+int main(void)
+{
+    ui_host_frame_t dirty, full;
+    uint32_t        dirty_total = 0, full_total = 0;
+
+    ui_host_init();
+    set_timebase(TIME_BASE);
+    set_time_set(true);
+    set_power_mode(PWR_MODE_LOW);
+    ble_state       = ADVERTISING;
+    ui_host_co2_ppm = 850;
+    for (uint8_t i = 0; i < 20; i++)
+    {
+        co2_history[i] = (uint16_t)(850 - i * 15);
+    }
+
+    ui_host_begin();
+    ui_draw_main_page();
+    ui_host_flush(&rect_full_screen);
+
+    printf("%-24s %7s %7s %6s\n", "event", "full", "dirty", "saved");
+    for (uint32_t i = 0; i < sizeof(events) / sizeof(events[0]); i++)
+    {
+        events[i].apply();
+
+        ui_host_begin();
+        ui_draw_main_page();
+        dirty = ui_host_flush(&rect_full_screen);
+        st7301_model_image(img_dirty);
+
+        ui_refresh_invalidate();
+        ui_host_begin();
+        full = ui_host_flush(&rect_full_screen);
+        st7301_model_image(img_full);
+
+        printf("%-24s %7u %7u %5.1f%%\n", events[i].name, full.spi_bytes, dirty.spi_bytes,
+               100.0 * (full.spi_bytes - dirty.spi_bytes) / full.spi_bytes);
+        dirty_total += dirty.spi_bytes;
+        full_total += full.spi_bytes;
+
+        CHECK(memcmp(img_dirty, img_full, sizeof(img_full)) == 0, "%s: dirty refresh left a different image",
+              events[i].name);
+        CHECK(full.pixel_bytes == LCD_WIDTH * LCD_HIGHT, "%s: full refresh sent %u pixel bytes", events[i].name,
+              full.pixel_bytes);
+        CHECK(dirty.spi_bytes <= full.spi_bytes * events[i].max_pct / 100, "%s: %u of %u bytes", events[i].name,
+              dirty.spi_bytes, full.spi_bytes);
+    }
+    printf("%-24s %7u %7u %5.1f%%\n", "total", full_total, dirty_total,
+           100.0 * (full_total - dirty_total) / full_total);
+    return check_failures();
+}
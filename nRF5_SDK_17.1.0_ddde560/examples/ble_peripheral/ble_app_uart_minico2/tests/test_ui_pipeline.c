@@ -0,0 +1,121 @@
+/**
+ * The refresh pipeline on the mock SPIM: rows are converted in the task into
+ * two send buffers while the SPIM sends the other one, the SPI interrupt only
+ * starts the next buffer. For a full and for partial refreshes this prints
+ * the bus and wall time, the longest and total interrupt time and the task's
+ * conversion time, and checks that no buffer is rewritten while the SPIM reads
+ * it and the panel ends up showing the canvas.
+ *
+ * The simulated CPU is infinitely fast, so the virtual wall time is the bus
+ * time. The "ISR render" column estimates the old design, converting each row
+ * in the interrupt while the bus waits: bus time plus the conversion time,
+ * which is measured on the host and stands in for the target's.
+ */
+
+#include <string.h>
+
+#include "battery.h"
+#include "cfg_fstorage.h"
+#include "check.h"
+#include "co2.h"
+#include "sim.h"
+#include "ui_host.h"
+#include "user.h"
+
+extern uint16_t co2_history[BAR_COUNT];
+
+/** Panel pixels that differ from the canvas converted with the current colours */
+static uint32_t panel_diff(void)
+{
+    uint8_t  row[LCD_WIDTH];
+    uint32_t n = 0;
+
+    ui_host_color_update();
+    for (uint8_t y = 0; y < LCD_HIGHT; y++)
+    {
+        ui_host_render_row(y, row);
+        for (uint8_t x = 0; x < LCD_WIDTH; x++)
+        {
+            n += ST7301_COLOR(st7301_model_pixel(x, y)) != row[x];
+        }
+    }
+    return n;
+}
+
+static void report(const char *name, const ui_host_frame_t *f)
+{
+    uint64_t render_us = f->task_ns / 1000;
+
+    printf("%-18s %6u %5u %7llu %7llu %8llu %8llu %8llu %9llu\n", name, f->pixel_bytes, f->spi_transfers,
+           (unsigned long long)f->bus_us, (unsigned long long)f->wall_us, (unsigned long long)f->isr_max_ns,
+           (unsigned long long)f->isr_total_ns / 1000, (unsigned long long)render_us,
+           (unsigned long long)(f->bus_us + render_us));
+
+    CHECK(f->dma_overwrites == 0, "%s: %u send buffers rewritten while sent", name, f->dma_overwrites);
+    CHECK(f->busy_rejects == 0, "%s: %u transfers started on a busy SPIM", name, f->busy_rejects);
+    CHECK(f->wall_us <= f->bus_us + 1, "%s: %llu us wall for %llu us on the bus", name,
+          (unsigned long long)f->wall_us, (unsigned long long)f->bus_us);
+    CHECK(panel_diff() == 0, "%s: %u panel pixels differ from the canvas", name, panel_diff());
+}
+
+int main(void)
+{
+    ui_host_frame_t f;
+    ui_host_frame_t full[20];
+    uint64_t        isr_total = 0, task_total = 0;
+
+    ui_host_init();
+    set_timebase(10 * 3600 + 42 * 60);
+    set_time_set(true);
+    set_power_mode(PWR_MODE_LOW);
+    ble_state       = ADVERTISING;
+    ui_host_co2_ppm = 850;
+    for (uint8_t i = 0; i < 20; i++)
+    {
+        co2_history[i] = (uint16_t)(850 - i * 15);
+    }
+
+    printf("%-18s %6s %5s %7s %7s %8s %8s %8s %9s\n", "refresh", "bytes", "xfers", "bus_us", "wall_us",
+           "isr_max", "isr_us", "task_us", "ISR render");
+
+    // full screen, repeated to average the host timings
+    for (int i = 0; i < 20; i++)
+    {
+        ui_refresh_invalidate();
+        ui_host_begin();
+        ui_draw_main_page();
+        full[i] = ui_host_flush(&rect_full_screen);
+        isr_total += full[i].isr_total_ns;
+        task_total += full[i].task_ns;
+    }
+    report("full screen", &full[19]);
+
+    // the interrupt only chains buffers, the conversion runs in the task
+    CHECK(isr_total < task_total / 2, "interrupts took %llu ns against %llu ns of conversion",
+          (unsigned long long)isr_total, (unsigned long long)task_total);
+
+    // partial: one run of rows, two separate runs, the blink rows
+    set_timebase(get_time_now() + 60);
+    ui_host_begin();
+    ui_draw_main_page();
+    f = ui_host_flush(&rect_full_screen);
+    report("minute tick", &f);
+
+    set_timebase(get_time_now() + 60);
+    sim_config.battery_mv -= 150;
+    battery_state_update();
+    ui_host_begin();
+    ui_draw_main_page();
+    f = ui_host_flush(&rect_full_screen);
+    report("minute + battery", &f);
+    CHECK(f.windows >= 1, "no window set");
+
+    ui_host_set_blink(UI_BLINK_CO2_VALUE, UI_BOOL_TRUE);
+    ui_host_begin();
+    ui_draw_main_page();
+    ui_host_flush(&rect_full_screen);
+    f = ui_host_blink_toggle(true);
+    report("co2 blink", &f);
+
+    return check_failures();
+}
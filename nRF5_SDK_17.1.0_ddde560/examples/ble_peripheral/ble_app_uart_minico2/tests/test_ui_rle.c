@@ -0,0 +1,116 @@
+/**
+ * The run-length encoded bitmaps of lcd/ui_res_rle.c against the originals in
+ * tools/ui_assets.c: every asset and every entry of the 2D tables must decode
+ * with ui_rle_read() to the original bytes. Per asset the flash taken before
+ * and after (the encoded bytes plus the _idx table) and the decode time are
+ * printed; host nanoseconds, the ratio to a plain copy is what carries over
+ * to the target.
+ */
+
+#include <string.h>
+
+#include "check.h"
+#include "sim.h"
+#include "ui_host.h"
+
+// the originals, renamed next to the encoded assets
+#define CODE_SECTION
+#define pix_co2_ppm_num   raw_co2_ppm_num
+#define pix_passkey_num   raw_passkey_num
+#define pix_sensor_error  raw_sensor_error
+#define pix_airspot_text  raw_airspot_text
+#define font              raw_font
+#define pix_power_on_text raw_power_on_text
+#include "tools/ui_assets.c"
+#undef pix_co2_ppm_num
+#undef pix_passkey_num
+#undef pix_sensor_error
+#undef pix_airspot_text
+#undef font
+#undef pix_power_on_text
+
+#define BENCH_ITER 2000
+
+static const struct
+{
+    const char     *name;
+    const uint8_t  *raw;     // original, entries of entry_len bytes
+    uint16_t        entries; // 1 for a 1D asset
+    uint16_t        entry_len;
+    const uint8_t  *rle;
+    const uint16_t *idx; // NULL for a 1D asset
+} assets[] = {
+    {"pix_co2_ppm_num", raw_co2_ppm_num[0], 12, sizeof(raw_co2_ppm_num[0]), pix_co2_ppm_num, pix_co2_ppm_num_idx},
+    {"pix_passkey_num", raw_passkey_num[0], 10, sizeof(raw_passkey_num[0]), pix_passkey_num, pix_passkey_num_idx},
+    {"pix_sensor_error", raw_sensor_error, 1, sizeof(raw_sensor_error), pix_sensor_error, NULL},
+    {"pix_airspot_text", raw_airspot_text, 1, sizeof(raw_airspot_text), pix_airspot_text, NULL},
+    {"font", raw_font[0], 96, sizeof(raw_font[0]), font, font_idx},
+    {"pix_power_on_text", raw_power_on_text, 1, sizeof(raw_power_on_text), pix_power_on_text, NULL},
+};
+
+int main(void)
+{
+    static uint8_t dst[2048];
+    uint32_t       raw_total = 0, rle_total = 0;
+    uint64_t       t, dec_ns, copy_ns;
+
+    printf("%-18s %7s %6s %6s %6s %9s %9s %7s\n", "asset", "entries", "raw B", "rle B", "saved", "decode ns",
+           "ns/byte", "x copy");
+    for (uint32_t a = 0; a < sizeof(assets) / sizeof(assets[0]); a++)
+    {
+        uint32_t raw = assets[a].entries * assets[a].entry_len;
+        uint32_t rle = assets[a].idx != NULL ? assets[a].entries * sizeof(uint16_t) : 0;
+
+        for (uint16_t e = 0; e < assets[a].entries; e++)
+        {
+            const uint8_t *src = assets[a].rle + (assets[a].idx != NULL ? assets[a].idx[e] : 0);
+            uint16_t       used;
+
+            memset(dst, 0xA5, sizeof(dst));
+            used = ui_host_rle_decode(src, dst, assets[a].entry_len);
+            rle += used;
+            CHECK(memcmp(dst, assets[a].raw + e * assets[a].entry_len, assets[a].entry_len) == 0,
+                  "%s[%u] does not decode to the original", assets[a].name, e);
+
+            // entries are packed back to back, each starts where the previous one ended
+            if (assets[a].idx != NULL && e + 1 < assets[a].entries)
+            {
+                CHECK(assets[a].idx[e + 1] == assets[a].idx[e] + used, "%s[%u]: %u bytes, the next starts at %u",
+                      assets[a].name, e, used, assets[a].idx[e + 1]);
+            }
+        }
+
+        // every entry once per iteration
+        t = sim_host_ns();
+        for (int n = 0; n < BENCH_ITER; n++)
+        {
+            for (uint16_t e = 0; e < assets[a].entries; e++)
+            {
+                ui_host_rle_decode(assets[a].rle + (assets[a].idx != NULL ? assets[a].idx[e] : 0), dst,
+                                   assets[a].entry_len);
+            }
+        }
+        dec_ns = (sim_host_ns() - t) / BENCH_ITER / assets[a].entries;
+        t      = sim_host_ns();
+        for (int n = 0; n < BENCH_ITER; n++)
+        {
+            for (uint16_t e = 0; e < assets[a].entries; e++)
+            {
+                memcpy(dst, assets[a].raw + e * assets[a].entry_len, assets[a].entry_len);
+                __asm__ volatile("" : : "r"(dst) : "memory");
+            }
+        }
+        copy_ns = (sim_host_ns() - t) / BENCH_ITER / assets[a].entries;
+
+        raw_total += raw;
+        rle_total += rle;
+        printf("%-18s %7u %6u %6u %5.1f%% %9llu %9.2f %6.0fx\n", assets[a].name, assets[a].entries, raw, rle,
+               100.0 * (raw - rle) / raw, (unsigned long long)dec_ns, (double)dec_ns / assets[a].entry_len,
+               (double)dec_ns / (copy_ns ? copy_ns : 1));
+        CHECK(rle < raw, "%s: %u encoded bytes for %u", assets[a].name, rle, raw);
+    }
+    printf("%-18s %7s %6u %6u %5.1f%%\n", "total", "", raw_total, rle_total,
+           100.0 * (raw_total - rle_total) / raw_total);
+    printf("flash saved: %u bytes\n", raw_total - rle_total);
+    return check_failures();
+}
@@ -0,0 +1,108 @@
+/**
+ * SPI transactions per refresh. The refresh streams several rows per write,
+ * split only at the 255 byte EasyDMA limit, and sends each command's
+ * parameters in one transfer. The old driver is counted from the same frame:
+ * one transfer per command or parameter byte, one per row.
+ *
+ * The SPIM asserts CS for every transfer, so CS toggles equal transfers. Bus
+ * time is the clocking time at 8 MHz plus XFER_GAP_US per transfer for CS,
+ * the event handler and the restart; the gap is an estimate, not measured.
+ */
+
+#include <string.h>
+
+#include "battery.h"
+#include "cfg_fstorage.h"
+#include "check.h"
+#include "co2.h"
+#include "sim.h"
+#include "spi.h"
+#include "ui_host.h"
+#include "user.h"
+
+extern uint16_t co2_history[BAR_COUNT];
+
+/** Time between two transfers of one write */
+#define XFER_GAP_US 4
+
+/** Transactions of one address window before: 0x2A, 2 params, 0x2B, 2 params, 0x2C one byte each */
+#define OLD_WINDOW_XFERS 7
+
+/** Transactions of one address window now: 0x2A, params, 0x2B, params, 0x2C */
+#define NEW_WINDOW_XFERS 5
+
+static void report(const char *name, const ui_host_frame_t *f, uint32_t max_pct)
+{
+    uint32_t old_xfers = f->windows * OLD_WINDOW_XFERS + f->rows;
+    uint32_t old_us    = (uint32_t)f->bus_us + old_xfers * XFER_GAP_US;
+    uint32_t new_us    = (uint32_t)f->bus_us + f->spi_transfers * XFER_GAP_US;
+    uint32_t pix_xfers = f->spi_transfers - f->windows * NEW_WINDOW_XFERS;
+
+    printf("%-18s %5u %4u %6u %6u %6u %6u %6u %6u\n", name, f->rows, f->windows, f->spi_bytes, old_xfers,
+           f->spi_transfers, f->cs_toggles, old_us, new_us);
+
+    CHECK(f->cs_toggles == f->spi_transfers, "%s: %u CS toggles for %u transfers", name, f->cs_toggles,
+          f->spi_transfers);
+    CHECK(st7301_model_stats.cs_assertions == f->spi_transfers, "%s: the panel saw %u transfers of %u", name,
+          st7301_model_stats.cs_assertions, f->spi_transfers);
+
+    // pixel data splits only at the EasyDMA limit, at worst once more per send buffer
+    CHECK(pix_xfers <= (f->pixel_bytes + SPI_MAX_XFER - 1) / SPI_MAX_XFER + (f->rows + 3) / 4,
+          "%s: %u pixel transfers for %u bytes", name, pix_xfers, f->pixel_bytes);
+    CHECK(f->spi_transfers * 100 <= old_xfers * max_pct, "%s: %u transfers, %u before", name, f->spi_transfers,
+          old_xfers);
+}
+
+int main(void)
+{
+    ui_host_frame_t f;
+
+    ui_host_init();
+    set_timebase(10 * 3600 + 42 * 60);
+    set_time_set(true);
+    set_power_mode(PWR_MODE_LOW);
+    ble_state       = ADVERTISING;
+    ui_host_co2_ppm = 850;
+    for (uint8_t i = 0; i < 20; i++)
+    {
+        co2_history[i] = (uint16_t)(850 - i * 15);
+    }
+
+    printf("%-18s %5s %4s %6s %6s %6s %6s %6s %6s\n", "refresh", "rows", "wins", "bytes", "xfers<", "xfers",
+           "cs", "bus_us<", "bus_us");
+
+    ui_refresh_invalidate();
+    ui_host_begin();
+    ui_draw_main_page();
+    f = ui_host_flush(&rect_full_screen);
+    report("full screen", &f, 80);
+    CHECK(f.windows == 1 && f.rows == LCD_HIGHT, "full screen: %u rows in %u windows", f.rows, f.windows);
+
+    set_timebase(get_time_now() + 60);
+    ui_host_begin();
+    ui_draw_main_page();
+    f = ui_host_flush(&rect_full_screen);
+    report("minute tick", &f, 60);
+
+    set_timebase(get_time_now() + 60);
+    sim_config.battery_mv -= 150;
+    battery_state_update();
+    ui_host_begin();
+    ui_draw_main_page();
+    f = ui_host_flush(&rect_full_screen);
+    report("minute + battery", &f, 60);
+
+    memmove(co2_history + 1, co2_history, sizeof(co2_history) - sizeof(co2_history[0]));
+    ui_host_co2_ppm = 910;
+    co2_history[0]  = ui_host_co2_ppm;
+    ui_host_begin();
+    ui_draw_main_page();
+    f = ui_host_flush(&rect_full_screen);
+    report("co2 sample", &f, 80);
+
+    ui_host_set_blink(UI_BLINK_MINUTE, UI_BOOL_TRUE);
+    f = ui_host_blink_toggle(true);
+    report("minute blink", &f, 60);
+
+    return check_failures();
+}
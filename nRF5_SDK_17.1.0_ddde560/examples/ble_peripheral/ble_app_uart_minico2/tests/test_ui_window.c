@@ -0,0 +1,136 @@
+/**
+ * Column windows on the ST7301 model. Each typical main page update is sent
+ * through the narrowed address windows, then the same canvas is sent in full
+ * after ui_refresh_invalidate(): the panel must show the same image, so the
+ * pixels outside the windows were already right. The bytes a full-row window
+ * would have sent for the same rows are printed next to the bytes sent.
+ */
+
+#include <string.h>
+
+#include "battery.h"
+#include "cfg_fstorage.h"
+#include "check.h"
+#include "co2.h"
+#include "sim.h"
+#include "ui_host.h"
+#include "user.h"
+
+extern uint16_t co2_history[BAR_COUNT];
+
+#define TIME_BASE (25 * 365 * 86400u + 10 * 3600 + 42 * 60)
+
+static uint8_t img_window[ST7301_MODEL_H][ST7301_MODEL_W];
+static uint8_t img_full[ST7301_MODEL_H][ST7301_MODEL_W];
+
+static void minute_tick(void)
+{
+    set_timebase(get_time_now() + 60);
+}
+
+static void hour_tick(void)
+{
+    set_timebase(get_time_now() + 18 * 60);
+}
+
+static void co2_value(void)
+{
+    ui_host_co2_ppm += 7;
+}
+
+static void ble_connect(void)
+{
+    ble_state = CONNECTED;
+}
+
+static void battery_drop(void)
+{
+    sim_config.battery_mv -= 120;
+    battery_state_update();
+}
+
+static void alarm_off(void)
+{
+    set_buzzer_state(0);
+}
+
+static void blink_on(void)
+{
+    ui_host_set_blink(UI_BLINK_MINUTE, UI_BOOL_FALSE);
+}
+
+static void blink_off(void)
+{
+    ui_host_set_blink(UI_BLINK_MINUTE, UI_BOOL_TRUE);
+}
+
+/** Updates in order, with the least share of the full-row bytes a window must save */
+static const struct
+{
+    const char *name;
+    void (*apply)(void);
+    uint8_t min_saved_pct;
+} updates[] = {
+    {"minute tick", minute_tick, 75},
+    {"clock 10:43 -> 11:01", hour_tick, 50},
+    {"co2 value", co2_value, 40},
+    {"ble connected", ble_connect, 75},
+    {"battery level", battery_drop, 75},
+    {"alarm off", alarm_off, 75},
+    {"blink minute hidden", blink_on, 75},
+    {"blink minute shown", blink_off, 75},
+};
+
+int main(void)
+{
+    ui_host_frame_t f, full;
+    uint32_t        rows_bytes, total = 0, total_rows = 0;
+
+    ui_host_init();
+    set_timebase(TIME_BASE);
+    set_time_set(true);
+    set_buzzer_state(1);
+    set_power_mode(PWR_MODE_LOW);
+    ble_state       = ADVERTISING;
+    ui_host_co2_ppm = 850;
+    for (uint8_t i = 0; i < 20; i++)
+    {
+        co2_history[i] = (uint16_t)(850 - i * 15);
+    }
+
+    ui_host_begin();
+    ui_draw_main_page();
+    ui_host_flush(&rect_full_screen);
+
+    printf("%-24s %5s %4s %7s %7s %6s\n", "update", "rows", "wins", "rows_B", "window", "saved");
+    for (uint32_t i = 0; i < sizeof(updates) / sizeof(updates[0]); i++)
+    {
+        updates[i].apply();
+
+        ui_host_begin();
+        ui_draw_main_page();
+        f = ui_host_flush(&rect_full_screen);
+        st7301_model_image(img_window);
+
+        ui_refresh_invalidate();
+        ui_host_begin();
+        full = ui_host_flush(&rect_full_screen);
+        st7301_model_image(img_full);
+
+        rows_bytes = f.rows * LCD_WIDTH;
+        printf("%-24s %5u %4u %7u %7u %5.1f%%\n", updates[i].name, f.rows, f.windows, rows_bytes, f.pixel_bytes,
+               rows_bytes ? 100.0 * (rows_bytes - f.pixel_bytes) / rows_bytes : 0.0);
+        total += f.pixel_bytes;
+        total_rows += rows_bytes;
+
+        CHECK(memcmp(img_window, img_full, sizeof(img_full)) == 0, "%s: the windows left a different image",
+              updates[i].name);
+        CHECK(full.pixel_bytes == LCD_WIDTH * LCD_HIGHT, "%s: full refresh sent %u pixel bytes", updates[i].name,
+              full.pixel_bytes);
+        CHECK(f.rows != 0 && f.pixel_bytes * 100 <= rows_bytes * (100 - updates[i].min_saved_pct),
+              "%s: %u of %u bytes", updates[i].name, f.pixel_bytes, rows_bytes);
+    }
+    printf("%-24s %5s %4s %7u %7u %5.1f%%\n", "total", "", "", total_rows, total,
+           100.0 * (total_rows - total) / total_rows);
+    return check_failures();
+}
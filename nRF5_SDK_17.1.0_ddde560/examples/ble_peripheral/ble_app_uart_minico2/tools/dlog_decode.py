@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+"""Decode the deferred log (RTT up buffer 1) written by dlog_x() in log.h.
+
+Capture the channel with the J-Link RTT logger, then decode it against the
+.axf of the same build:
+
+    JLinkRTTLogger -Device NRF52832_XXAA -If SWD -Speed 4000 -RTTChannel 1 dlog.bin
+    python3 dlog_decode.py _build/nrf52832_xxaa.axf dlog.bin
+
+Requires pyelftools (pip install pyelftools).
+"""
+
+import re
+import struct
+import sys
+
+from elftools.elf.elffile import ELFFile
+
+MODULES = ["MAIN", "CO2", "HISTORY", "PROTOCOL", "UI"]
+LEVELS = ["NONE", "E", "W", "I", "D"]
+
+
+class Image:
+    def __init__(self, path):
+        self.segments = []
+        with open(path, "rb") as f:
+            elf = ELFFile(f)
+            for seg in elf.iter_segments():
+                if seg["p_type"] == "PT_LOAD" and seg["p_filesz"]:
+                    self.segments.append((seg["p_paddr"], seg.data()))
+
+    def string(self, addr):
+        for base, data in self.segments:
+            if base <= addr < base + len(data):
+                end = data.index(b"\0", addr - base)
+                return data[addr - base : end].decode("utf-8", "replace")
+        return "<unknown format 0x%08X>" % addr
+
+
+def format_message(image, fmt, args):
+    # only the integer conversions used in the firmware, %s reads a string from flash
+    specs = re.findall(r"%[-0 #+]*\d*(?:\.\d+)?(?:hh|h|ll|l|z)?([diuxXcsp%])", fmt)
+    values = []
+    for conv in [c for c in specs if c != "%"]:
+        value = args.pop(0) if args else 0
+        if conv in "di":
+            value = struct.unpack("<i", struct.pack("<I", value))[0]
+        elif conv == "s":
+            value = image.string(value)
+        values.append(value)
+    fmt = re.sub(r"%([-0 #+]*\d*(?:\.\d+)?)(?:hh|h|ll|l|z)?([diuxXcsp])",
+                 lambda m: "%" + m.group(1) + ("x" if m.group(2) == "p" else "d" if m.group(2) == "u" else m.group(2)), fmt)
+    return fmt % tuple(values)
+
+
+def decode(image, raw):
+    offset = 0
+    while offset + 8 <= len(raw):
+        addr, header = struct.unpack_from("<II", raw, offset)
+        offset += 8
+
+        tick = header >> 16
+        module = (header >> 12) & 0x0F
+        level = (header >> 9) & 0x07
+        hexdump = (header >> 8) & 0x01
+        count = header & 0xFF
+        text = image.string(addr)
+        name = MODULES[module] if module < len(MODULES) else str(module)
+        prefix = "%7.2f %s/%-8s " % (tick / 100.0, LEVELS[level] if level < len(LEVELS) else level, name)
+
+        if hexdump:
+            data = raw[offset : offset + count]
+            offset += (count + 3) & ~3
+            print(prefix + "[%s] %s" % (text, " ".join("%02X" % b for b in data)))
+        else:
+            args = list(struct.unpack_from("<%dI" % count, raw, offset))
+            offset += count * 4
+            try:
+                print(prefix + format_message(image, text, args).rstrip("\n"))
+            except (TypeError, ValueError):
+                print(prefix + "%r %r" % (text, args))
+
+
+def main():
+    if len(sys.argv) != 3:
+        print(__doc__)
+        return 1
+
+    image = Image(sys.argv[1])
+    with open(sys.argv[2], "rb") as f:
+        decode(image, f.read())
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+"""Decode the retained event trace read with CMD_GET_TRACE (0x35), see trace.h.
+
+Send FF AA 35 01 <start> <checksum> with start 0, then again with the start
+of the next chunk, until a chunk without entries comes back. Save the
+notifications as hex, one frame per line (nRF Connect log lines and
+"FF-AA-35-..." or "FFAA35..." are fine, lines that are no CMD_GET_TRACE
+frame are skipped), and decode them:
+
+    python3 trace_decode.py notifications.txt
+    build/test_trace | python3 ../tools/trace_decode.py -
+
+Frame payload (protocol.c, proto_send_trace): boot count (2 bytes), total
+entries (1 byte), start index (1 byte), then entries of tick (4 bytes),
+event, arg8, arg16 (2 bytes). All values are big-endian, ticks are 10 ms.
+"""
+
+import re
+import struct
+import sys
+
+CMD_GET_TRACE = 0x35
+
+# trace_event_t in trace.h
+EVENTS = [
+    None,
+    "BOOT",
+    "RESET",
+    "SLEEP",
+    "BLE_ADV_START",
+    "BLE_ADV_STOP",
+    "BLE_CONNECTED",
+    "BLE_DISCONNECTED",
+    "CO2_ERROR",
+    "CO2_POWER_CYCLE",
+    "POWER_MODE",
+    "FLASH_ERASE",
+    "BAT_LOW",
+    "BAT_LOW_EXIT",
+    "SCREEN_ON",
+    "SCREEN_OFF",
+    "TIMER_SLOW",
+    "CO2_RECOVERY",
+]
+
+# reset_reason_code in main.c
+RESET_REASONS = {
+    0: "unknown",
+    1: "pin",
+    2: "watchdog",
+    3: "soft",
+    4: "lockup",
+    5: "power on",
+    6: "lpcomp",
+    7: "debug",
+    8: "nfc",
+    9: "factory test",
+}
+RESET_CAUSES = {1: "sensor error", 2: "protocol", 3: "factory", 4: "factory test"}
+POWER_MODES = ["ON_DEMAND", "LOW", "MID", "HI"]
+RECOVERY = ["RETRY", "BUS_CLEAR", "REINIT", "POWER_CYCLE", "DEGRADED"]
+
+
+def parse_frame(line):
+    """Return the bytes of a CMD_GET_TRACE frame on the line, or None."""
+    text = re.sub(r"0x", "", line, flags=re.I)
+    match = re.search(r"FF[\s:-]*AA[\s:-]*35(?:[\s:-]*[0-9A-F]{2})+", text, flags=re.I)
+    if not match:
+        return None
+    frame = bytes.fromhex(re.sub(r"[\s:-]", "", match.group(0)))
+    if len(frame) < 9 or len(frame) != frame[3] + 5 or sum(frame[:-1]) & 0xFF != frame[-1]:
+        print("bad frame: %s" % frame.hex(" ").upper(), file=sys.stderr)
+        return None
+    return frame
+
+
+def describe(event, arg8, arg16):
+    name = EVENTS[event] if event < len(EVENTS) and EVENTS[event] else "EVENT_%d" % event
+    if name == "BOOT":
+        return name, "reason %s, RESETREAS 0x%02X" % (RESET_REASONS.get(arg8, arg8), arg16)
+    if name == "RESET":
+        return name, RESET_CAUSES.get(arg8, str(arg8))
+    if name == "BLE_DISCONNECTED":
+        return name, "HCI reason 0x%02X" % arg8
+    if name == "CO2_ERROR":
+        return name, "error %d, %d consecutive" % (arg8, arg16)
+    if name == "CO2_POWER_CYCLE":
+        return name, "serial number verified" if arg8 else "serial number check failed"
+    if name == "POWER_MODE":
+        return name, POWER_MODES[arg8] if arg8 < len(POWER_MODES) else str(arg8)
+    if name == "FLASH_ERASE":
+        return name, "sector %d" % arg16
+    if name == "BAT_LOW":
+        return name, "%d mV" % arg16
+    if name == "TIMER_SLOW":
+        return name, "slow" if arg8 else "normal"
+    if name == "CO2_RECOVERY":
+        stage = RECOVERY[arg8] if arg8 < len(RECOVERY) else str(arg8)
+        return name, "%s %s" % (stage, "failed" if arg16 else "ok")
+    return name, "arg8 %d, arg16 %d" % (arg8, arg16) if arg8 or arg16 else ""
+
+
+def decode(lines):
+    entries = {}
+    boot_count = total = None
+    for line in lines:
+        frame = parse_frame(line)
+        if frame is None:
+            continue
+        boot_count, total, start = struct.unpack_from(">HBB", frame, 4)
+        for i, offset in enumerate(range(8, len(frame) - 1, 8)):
+            entries[start + i] = struct.unpack_from(">IBBH", frame, offset)
+
+    if total is None:
+        print("no CMD_GET_TRACE frames found", file=sys.stderr)
+        return 1
+
+    print("boot count %d, %d entries" % (boot_count, total))
+    missing = [i for i in range(total) if i not in entries]
+    if missing:
+        print("missing entries %s, read the chunks starting there" % missing, file=sys.stderr)
+    for index in sorted(entries):
+        tick, event, arg8, arg16 = entries[index]
+        name, detail = describe(event, arg8, arg16)
+        print("%3d %10.2f s  %-17s %s" % (index, tick / 100.0, name, detail))
+    return 1 if missing else 0
+
+
+def main():
+    if len(sys.argv) != 2:
+        print(__doc__)
+        return 1
+    if sys.argv[1] == "-":
+        return decode(sys.stdin)
+    with open(sys.argv[1]) as f:
+        return decode(f)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+"""Compress the 1bpp UI bitmaps for ui_blit() (lcd/ui.c).
+
+Reads the exported bitmaps in tools/ui_assets.c and writes lcd/ui_res_rle.c:
+
+    python3 tools/ui_rle.py tools/ui_assets.c lcd/ui_res_rle.c
+
+Format: the bitmap bytes are read as one bit stream, LSB first, with the row
+padding included, so the decoder never needs the bitmap width. The stream is
+stored as alternating runs of 0 and 1 pixels, starting with 0. Every run is one
+nibble, low nibble first. A nibble of 15 means "15 pixels, the run goes on in
+the next nibble", any other value ends the run and flips the pixel value.
+
+A 2D array becomes one blob plus a <name>_idx[] table holding the byte offset
+of every entry; each entry starts on a byte boundary with pixel value 0.
+
+Every asset is decoded back the same way ui_rle_read() does it and compared
+with the original before anything is written. The size report goes to stderr.
+"""
+
+import re
+import sys
+
+RUN_EXT = 15
+
+
+def parse_arrays(text):
+    """Yield (name, rows, data) for each const uint8_t array: rows for 2D arrays, data for 1D ones."""
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    text = re.sub(r"//[^\n]*", "", text)
+    for m in re.finditer(r"const\s+uint8_t\s+(\w+)((?:\[\d*\])+)[^=]*=\s*\{", text):
+        depth, i = 1, m.end()
+        while depth:
+            depth += {"{": 1, "}": -1}.get(text[i], 0)
+            i += 1
+        body = text[m.end() : i - 1]
+        values = lambda s: bytes(int(v, 0) for v in re.findall(r"0[xX][0-9a-fA-F]+|\d+", s))
+        if m.group(2).count("[") == 1:
+            yield m.group(1), None, values(body)
+        else:
+            yield m.group(1), [values(r) for r in re.findall(r"\{([^{}]*)\}", body)], None
+
+
+def encode(data):
+    nibbles, value, run = [], 0, 0
+    for byte in data:
+        for k in range(8):
+            if (byte >> k) & 1 == value:
+                run += 1
+                continue
+            while run >= RUN_EXT:
+                nibbles.append(RUN_EXT)
+                run -= RUN_EXT
+            nibbles.append(run)
+            value, run = value ^ 1, 1
+    while run >= RUN_EXT:
+        nibbles.append(RUN_EXT)
+        run -= RUN_EXT
+    if run:  # the decoder stops at the length, the last run needs no closing 0
+        nibbles.append(run)
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    return bytes(nibbles[i] | nibbles[i + 1] << 4 for i in range(0, len(nibbles), 2)), len(nibbles)
+
+
+def decode(src, length):
+    """Python copy of ui_rle_read() in lcd/ui.c."""
+    pos, high, nxt, color, left = 0, 0, 0, 0, 0
+    out = bytearray()
+    for _ in range(length):
+        byte, b = 0, 0
+        while b < 8:
+            while left == 0:
+                run = src[pos] >> 4 if high else src[pos] & 0x0F
+                pos += high
+                high ^= 1
+                left, color = run, nxt
+                if run != RUN_EXT:
+                    nxt ^= 1
+            n = min(left, 8 - b)
+            if color:
+                byte |= ((1 << n) - 1) << b
+            left -= n
+            b += n
+        out.append(byte)
+    return bytes(out)
+
+
+def c_values(values, fmt, per_line=20):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(fmt % v for v in values[i : i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+
+    out = [
+        "/**",
+        " * UI位图, 游程编码, 由tools/ui_rle.py从tools/ui_assets.c生成, 不要手工修改",
+        " */",
+        "#include \"stdint.h\"",
+        "#include \"ui.h\"",
+    ]
+    raw_total = rle_total = 0
+    print("%-20s %6s %6s %6s %7s" % ("asset", "raw", "rle", "saved", "nibbles"), file=sys.stderr)
+
+    with open(sys.argv[1], encoding="utf-8") as f:
+        arrays = list(parse_arrays(f.read()))
+
+    for name, rows, data in arrays:
+        entries = rows if rows is not None else [data]
+        blob, offsets, nibbles = bytearray(), [], 0
+        for entry in entries:
+            packed, count = encode(entry)
+            if decode(packed, len(entry)) != entry:
+                sys.exit("%s: decode mismatch" % name)
+            offsets.append(len(blob))
+            blob += packed
+            nibbles += count
+
+        raw = sum(len(e) for e in entries)
+        size = len(blob) + (2 * len(offsets) if rows is not None else 0)
+        raw_total += raw
+        rle_total += size
+        print("%-20s %6d %6d %6d %7d" % (name, raw, size, raw - size, nibbles), file=sys.stderr)
+
+        out.append("")
+        out.append("const uint8_t %s[%d] = {" % (name, len(blob)))
+        out.append(c_values(blob, "0x%02x"))
+        out.append("};")
+        if rows is not None:
+            out.append("const uint16_t %s_idx[%d] = {" % (name, len(offsets)))
+            out.append(c_values(offsets, "%d", 16))
+            out.append("};")
+
+    print("%-20s %6d %6d %6d" % ("total", raw_total, rle_total, raw_total - rle_total), file=sys.stderr)
+
+    with open(sys.argv[2], "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(out) + "\n")
+
+
+if __name__ == "__main__":
+    main()
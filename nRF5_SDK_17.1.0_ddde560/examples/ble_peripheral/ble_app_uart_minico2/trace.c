@@ -0,0 +1,86 @@
+#include "trace.h"
+#include "app_util_platform.h"
+#include "log.h"
+#include "ttask.h"
+#include <string.h>
+
+#define TRACE_MAGIC 0x54524331 // "TRC1"
+
+/**
+ * The ring is committed by a single 32-bit store of seq after the entry is
+ * complete, so a reset in the middle of trace_add never exposes a torn entry.
+ * The slot at the head is the one being written, it is never read back, even
+ * when the ring is full.
+ */
+typedef struct
+{
+    uint32_t      magic;
+    uint32_t      seq;        // total number of entries written, head = seq % TRACE_SIZE
+    uint16_t      boot_count; // resets seen since the ring was cleared
+    uint16_t      check;      // ~boot_count, detects random RAM after power-on
+    trace_entry_t entries[TRACE_SIZE];
+} trace_ring_t;
+
+static __attribute__((section(".bss.noinit"), zero_init)) trace_ring_t trace_ring;
+
+void trace_clear(void)
+{
+    memset(&trace_ring, 0, sizeof(trace_ring));
+    trace_ring.check = (uint16_t)~trace_ring.boot_count;
+    trace_ring.magic = TRACE_MAGIC;
+}
+
+uint16_t trace_init(void)
+{
+    if (trace_ring.magic != TRACE_MAGIC || trace_ring.check != (uint16_t)~trace_ring.boot_count)
+    {
+        print("trace ring invalid, clear\n");
+        trace_clear();
+    }
+    else
+    {
+        trace_ring.boot_count += 1;
+        trace_ring.check = (uint16_t)~trace_ring.boot_count;
+    }
+
+    print("trace ring: boot %d, %d entries\n", trace_ring.boot_count, trace_get_count());
+    return trace_ring.boot_count;
+}
+
+void trace_add(trace_event_t event, uint8_t arg8, uint16_t arg16)
+{
+    CRITICAL_REGION_ENTER();
+    trace_entry_t *entry = &trace_ring.entries[trace_ring.seq % TRACE_SIZE];
+
+    entry->tick  = GetSystemTickCount();
+    entry->event = (uint8_t)event;
+    entry->arg8  = arg8;
+    entry->arg16 = arg16;
+    __DMB();
+    trace_ring.seq += 1;
+    CRITICAL_REGION_EXIT();
+}
+
+uint8_t trace_get_count(void)
+{
+    return trace_ring.seq < TRACE_SIZE - 1 ? (uint8_t)trace_ring.seq : TRACE_SIZE - 1;
+}
+
+uint16_t trace_get_boot_count(void)
+{
+    return trace_ring.boot_count;
+}
+
+uint8_t trace_read(uint8_t start, trace_entry_t *entries, uint8_t max)
+{
+    uint8_t  count  = trace_get_count();
+    uint32_t oldest = trace_ring.seq - count;
+    uint8_t  n      = 0;
+
+    while (start + n < count && n < max)
+    {
+        entries[n] = trace_ring.entries[(oldest + start + n) % TRACE_SIZE];
+        n += 1;
+    }
+    return n;
+}
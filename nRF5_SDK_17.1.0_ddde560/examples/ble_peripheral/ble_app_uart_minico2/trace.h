@@ -0,0 +1,81 @@
+#ifndef __TRACE_H__
+#define __TRACE_H__
+
+#include <stdint.h>
+
+/**
+ * Binary event trace kept in retained (.noinit) RAM.
+ * It survives soft, WDT and pin resets so the events leading to a reset can be
+ * read back over the protocol after reconnecting.
+ */
+
+/** Number of entries in the ring, must be a power of two; the last TRACE_SIZE - 1 can be read back */
+#define TRACE_SIZE (64)
+
+/** Trace events */
+typedef enum
+{
+    TRACE_EVT_BOOT = 1,         // arg8: reset reason code, arg16: RESETREAS bits 0-3 and 16-19
+    TRACE_EVT_RESET,            // arg8: TRACE_RESET_xxx, software reset requested
+    TRACE_EVT_SLEEP,            // system off entered
+    TRACE_EVT_BLE_ADV_START,
+    TRACE_EVT_BLE_ADV_STOP,
+    TRACE_EVT_BLE_CONNECTED,
+    TRACE_EVT_BLE_DISCONNECTED, // arg8: HCI reason
+    TRACE_EVT_CO2_ERROR,        // arg8: error code, arg16: consecutive errors
+    TRACE_EVT_CO2_POWER_CYCLE,  // arg8: 1 serial number verified, 0 failed
+    TRACE_EVT_POWER_MODE,       // arg8: power_mode_t
+    TRACE_EVT_FLASH_ERASE,      // arg16: sector
+    TRACE_EVT_BAT_LOW,          // arg16: battery voltage mV
+    TRACE_EVT_BAT_LOW_EXIT,
+    TRACE_EVT_SCREEN_ON,
+    TRACE_EVT_SCREEN_OFF,
+    TRACE_EVT_TIMER_SLOW,       // arg8: 1 slow (200 ms) tick, 0 normal tick
+    TRACE_EVT_CO2_RECOVERY,     // arg8: co2_recovery_t stage entered, arg16: 0 success, 1 failed
+} trace_event_t;
+
+/** Software reset causes for TRACE_EVT_RESET */
+#define TRACE_RESET_SENSOR_ERROR 1 // no longer used, the sensor recovers without a reset
+#define TRACE_RESET_PROTOCOL     2
+#define TRACE_RESET_FACTORY      3
+#define TRACE_RESET_FACTORY_TEST 4
+
+/** Trace entry, 8 bytes */
+typedef struct
+{
+    uint32_t tick;  // system tick count (10 ms) since boot
+    uint8_t  event; // trace_event_t
+    uint8_t  arg8;
+    uint16_t arg16;
+} trace_entry_t;
+
+/**
+ * @brief Validate the retained ring after a reset, clear it when it is corrupt (power-on)
+ *
+ * @return uint16_t Boot count since the ring was last cleared
+ */
+uint16_t trace_init(void);
+
+/** Add an event to the ring */
+void trace_add(trace_event_t event, uint8_t arg8, uint16_t arg16);
+
+/** Clear the ring */
+void trace_clear(void);
+
+/** Number of valid entries in the ring */
+uint8_t trace_get_count(void);
+
+/** Boot count since the ring was last cleared */
+uint16_t trace_get_boot_count(void);
+
+/**
+ * @brief Copy entries, oldest first
+ *
+ * @param start Index of the first entry to copy (0 = oldest)
+ * @param entries Destination
+ * @param max Maximum number of entries to copy
+ * @return uint8_t Number of entries copied
+ */
+uint8_t trace_read(uint8_t start, trace_entry_t *entries, uint8_t max);
+
+#endif // __TRACE_H__
@@ -0,0 +1,250 @@
+#include "app_timer.h"
+#include "cfg_fstorage.h"
+#include "energy.h"
+#include "history.h"
+#include "log.h"
+#include "trace.h"
+#include "ttask.h"
+#include "user.h"
+
+/**
+ * Scheduler timer, tick and task order, shared by main.c and the host
+ * simulator (tests/host/sim.c) so both run the same task sequence.
+ */
+
+extern uint16_t reset_reason_code;
+extern uint8_t  get_ble_state(void);
+extern void     advertising_start(void);
+extern void     advertising_stop(void);
+
+// BLE connection interval tracker (main.c)
+extern bool     is_fast_interval;
+extern uint16_t fast_interval_timer_ticks;
+extern void     toggle_connection_interval(void);
+
+uint8_t ttask_slow_mode = 0; // ttask 200ms
+
+// Add this flag at module level
+static volatile bool timer_mode_change_pending = false;
+static volatile bool new_timer_mode_slow       = false;
+
+// main loop timer
+APP_TIMER_DEF(ttask_timer);
+
+static void tick_tasks()
+{
+    TaskTick(task_protocol);
+    TaskTick(task_ui);
+    TaskTick(task_lcd_mode);
+    TaskTick(task_co2_read);
+    TaskTick(task_co2_alarm);
+    TaskTick(task_batery);
+    TaskTick(task_history_recover);
+    TaskTick(task_history_storage);
+    TaskTick(task_history_upload);
+    TaskTick(task_populate_fake_records);
+    TaskTick(task_factory_test);
+}
+
+static void tick_factory_test_tasks()
+{
+    TaskTick(task_protocol);
+    TaskTick(task_factory_test);
+}
+
+/**
+ * @brief Advance the wall clock and the task ticks by one timer period
+ *
+ * Kept separate from the app_timer handler so the task bodies can be driven
+ * from any time source, not only RTC1.
+ *
+ * @param elapsed_ms Milliseconds covered by this tick (10, or 200 in slow mode)
+ */
+void ttask_tick(uint32_t elapsed_ms)
+{
+    static uint32_t drift_correction = 0; // drift correction
+    static uint32_t ms               = 0;
+
+    ms += elapsed_ms;
+
+    if (ms >= 1000)
+    {
+        ms = 0;
+        inc_second(); // Increase the second counter
+
+        // Adjust drift correction based on actual ms increment
+        drift_correction += 960; //  Adjust for slow mode timing
+
+        if (drift_correction >= 1000000) // Every ~10 minutes
+        {
+            print("drift correction applied\n");
+            inc_second(); // Increment second counter to account for drift
+            drift_correction = 0;
+        }
+
+        energy_set(ENERGY_BLE_ADV, get_ble_state() == ADVERTISING);
+        energy_set(ENERGY_BLE_CONN, get_ble_state() == CONNECTED);
+        energy_tick_second();
+
+        if (fast_interval_timer_ticks > 0)
+        {
+            fast_interval_timer_ticks--;
+            if (fast_interval_timer_ticks == 0)
+            {
+                print("fast interval timer timeout, toggle connection interval\n");
+                toggle_connection_interval();
+            }
+        }
+    }
+
+    IncSystemTickCount();
+    tick_tasks();
+}
+
+void run_task(void)
+{
+    if (reset_reason_code == RESET_REASON_CODE_POWER_ON)
+    {
+        // print("task_power_on\n");
+        TaskRun(task_power_on);
+        return;
+    }
+
+    if (reset_reason_code == RESET_REASON_CODE_FACTORY_TEST)
+    {
+        TaskRun(task_protocol);
+        TaskRun(task_factory_test);
+        return;
+    }
+
+    // print("task_protocol\n");
+    TaskRun(task_protocol);
+
+    // print("task_ui\n");
+    TaskRun(task_ui);
+
+    TaskRun(task_lcd_mode);
+
+    // print("task_co2_read\n");
+    TaskRun(task_co2_read);
+
+    // print("task_co2_alarm\n");
+    TaskRun(task_co2_alarm);
+
+    // print("task_batery\n");
+    TaskRun(task_batery);
+
+    // print("task_history_storage\n");
+    TaskRun(task_history_storage);
+
+    // print("task_history_upload\n");
+    TaskRun(task_history_upload);
+
+    TaskRun(task_populate_fake_records);
+}
+
+void ttask_timer_timerout_handler(void *pcontext)
+{
+    ttask_tick((ttask_slow_mode == 0) ? 10 : 200);
+
+    // Apply any pending timer mode change at top of handler
+    if (timer_mode_change_pending)
+    {
+        timer_mode_change_pending = false;
+        app_timer_stop(ttask_timer);
+
+        if (new_timer_mode_slow)
+        {
+            app_timer_start(ttask_timer, APP_TIMER_TICKS(200), NULL);
+            ttask_slow_mode = 1;
+        }
+        else
+        {
+            app_timer_start(ttask_timer, APP_TIMER_TICKS(10), NULL);
+            ttask_slow_mode = 0;
+        }
+    }
+}
+
+void power_on_timer_timeout_handler(void *pcontext)
+{
+    IncSystemTickCount();
+    TaskTick(task_power_on);
+}
+
+void factory_test_timer_timeout_handler(void *pcontext)
+{
+    IncSystemTickCount();
+    tick_factory_test_tasks();
+}
+
+void ttask_timer_create(app_timer_timeout_handler_t handler)
+{
+    app_timer_create(&ttask_timer, APP_TIMER_MODE_REPEATED, handler);
+}
+
+void ttask_timer_start(void)
+{
+    app_timer_stop(ttask_timer);
+    app_timer_start(ttask_timer, APP_TIMER_TICKS(10), NULL);
+}
+
+/**@brief Function for putting the chip into sleep mode.
+ *
+ * @note This function will not return.
+ */
+void sleep_mode_enter(uint16_t bat_vol_mv)
+{
+    print("sleep_mode_enter\n");
+    if (EventGroupCheckBits(event_group_system, EVT_BAT_LOW | EVT_BAT_LOW_WARNING)) return;
+
+    EventGroupClearBits(event_group_system, EVT_SCREEN_FORCE_ON | EVT_CHARGING);
+    EventGroupSetBits(event_group_system, EVT_BAT_LOW_WARNING | EVT_SCREEN_ON_ONETIME);
+    add_record(bat_vol_mv, RECORD_TYPE_BATTERY_LOW);
+    trace_add(TRACE_EVT_BAT_LOW, 0, bat_vol_mv);
+
+    if (cfg_fstorage_get_flight_mode())
+    {
+        // Disable flight mode and add history record
+        cfg_fstorage_set_flight_mode(0);
+        update_flight_mode_activation_time();
+        add_record(0, RECORD_TYPE_FLIGHT_MODE);
+    }
+
+    EventGroupSetBits(event_group_system, EVT_CO2_UP_HIS);
+
+    advertising_stop();
+
+    app_timer_stop(ttask_timer);
+    ttask_slow_mode = 1;
+
+    fast_interval_timer_ticks = 0;
+    is_fast_interval          = false;
+
+    app_timer_start(ttask_timer, APP_TIMER_TICKS(200), NULL);
+}
+
+void sleep_mode_exit(void)
+{
+    print("sleep_mode_exit called, ttask_slow_mode: %d\n", ttask_slow_mode);
+    if (!EventGroupCheckBits(event_group_system, EVT_BAT_LOW | EVT_BAT_LOW_WARNING)) return;
+
+    ttask_slow_mode = 0;
+    trace_add(TRACE_EVT_BAT_LOW_EXIT, 0, 0);
+    advertising_start();
+    user_init();
+    EventGroupClearBits(event_group_system, EVT_BAT_LOW | EVT_BAT_LOW_WARNING);
+    TaskStart(task_co2_read);
+    TaskStart(task_history_storage);
+    TaskStart(task_co2_alarm);
+    // Power up peripherals
+    app_timer_stop(ttask_timer);
+    app_timer_start(ttask_timer, APP_TIMER_TICKS(10), NULL);
+}
+
+void change_timer_power_mode(bool is_sleep)
+{
+    timer_mode_change_pending = true;
+    new_timer_mode_slow       = is_sleep;
+    trace_add(TRACE_EVT_TIMER_SLOW, is_sleep, 0);
+}
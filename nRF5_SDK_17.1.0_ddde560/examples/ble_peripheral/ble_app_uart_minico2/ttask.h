@@ -374,6 +374,30 @@ TaskDeclare(task_power_on);
 // factory test task that runs in factory test mode
 TaskDeclare(task_factory_test);
 
+// switches the ST7301 to low power mode while the picture is static
+TaskDeclare(task_lcd_mode);
+
+/** Advance wall clock and task ticks by one timer period (ttask.c) */
+void ttask_tick(uint32_t elapsed_ms);
+
+/** Run every ready task once, called from the main loop (ttask.c) */
+void run_task(void);
+
+/** Scheduler timer handlers for normal operation, the power on animation and the factory test (ttask.c) */
+void ttask_timer_timerout_handler(void *pcontext);
+void power_on_timer_timeout_handler(void *pcontext);
+void factory_test_timer_timeout_handler(void *pcontext);
+
+/** Create the scheduler timer with one of the handlers above */
+void ttask_timer_create(void (*handler)(void *pcontext));
+
+/** (Re)start the scheduler timer at the 10 ms tick */
+void ttask_timer_start(void);
+
+/** reset_reason_code values that select the task set in run_task() */
+#define RESET_REASON_CODE_POWER_ON     5
+#define RESET_REASON_CODE_FACTORY_TEST 9
+
 #define DEVICE_NAME       "AirSpot" /**< Name of device. Will be included in the advertising data. */
 #define MANUFACTURER_NAME "MinTec"  /**< Manufacturer. Will be passed to Device Information Service. */
 #define HARDWARE_REVISION "1.1.0"
@@ -228,12 +228,14 @@ void pwm_uninit(void)
 void pwm_ch0_on(void)
 {
     app_pwm_channel_duty_set(&PWM1, 0, 50);
+    energy_begin(ENERGY_BUZZER);
 }
 
 /** Turn off PWM channel 0 */
 void pwm_ch0_off(void)
 {
     app_pwm_channel_duty_set(&PWM1, 0, 0);
+    energy_end(ENERGY_BUZZER);
 }
 
 /** Uninitialize SPI */
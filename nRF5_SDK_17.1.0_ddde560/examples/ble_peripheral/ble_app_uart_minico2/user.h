@@ -4,6 +4,7 @@
 #include "app_pwm.h"
 #include "cfg_fstorage.h"
 #include "custom_board.h"
+#include "energy.h"
 #include "flash_spi.h"
 #include "nrf_drv_gpiote.h"
 #include "nrf_gpio.h"
@@ -17,8 +18,8 @@
 // Macros for controlling buzzer and vibrator
 #define BUZZER_ON()    pwm_ch0_on()
 #define BUZZER_OFF()   pwm_ch0_off()
-#define VIBRATOR_ON()  nrf_gpio_pin_set(PIN_VIBRATOR)
-#define VIBRATOR_OFF() nrf_gpio_pin_clear(PIN_VIBRATOR)
+#define VIBRATOR_ON()  do { nrf_gpio_pin_set(PIN_VIBRATOR); energy_begin(ENERGY_VIBRATOR); } while (0)
+#define VIBRATOR_OFF() do { nrf_gpio_pin_clear(PIN_VIBRATOR); energy_end(ENERGY_VIBRATOR); } while (0)
 
 // Error codes
 #define ERROR_CODE_SENSOR_READ                   0x01